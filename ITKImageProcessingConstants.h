@@ -153,6 +153,9 @@ const QString k_DataContainerPrefixDefaultName("Mosaic_");
 const QString k_TileAttributeMatrixDefaultName("Tile Data");
 const QString k_TileDataArrayDefaultName("Image");
 const QString k_GrayScaleTempArrayName("gray_scale_temp");
+const QString k_TileSourceAttributeMatrixName("Tile Source");
+const QString k_TileSourceFilePathArrayName("File Path");
+const QString k_TileSourcePixelTypeArrayName("Pixel Type");
 
 const QString k_MontageDataContainerDefaultName("Mosaic");
 const QString k_MontageAttributeMatrixDefaultName("Mosaic Data");
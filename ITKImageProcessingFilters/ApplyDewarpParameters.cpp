@@ -32,6 +32,10 @@
 
 #include "ApplyDewarpParameters.h"
 
+#include <algorithm>
+#include <array>
+#include <map>
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
 #include "tbb/queuing_mutex.h"
 using MutexType = tbb::queuing_mutex;
@@ -60,11 +64,13 @@ using MutexType = tbb::queuing_mutex;
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Montages/GridMontage.h"
 #include "SIMPLib/Utilities/ParallelData2DAlgorithm.h"
-#include "SIMPLib/Utilities/ParallelTaskAlgorithm.h"
 
 #include "ITKImageProcessing/FilterParameters/EbsdWarpPolynomialFilterParameter.h"
 #include "ITKImageProcessing/ITKImageProcessingConstants.h"
 #include "ITKImageProcessing/ITKImageProcessingFilters/util/FFTDewarpHelper.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/ITKExecutionPolicy.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/ITKFilterTelemetry.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/MontageImportHelper.h"
 #include "ITKImageProcessing/ITKImageProcessingVersion.h"
 
 using Grayscale_T = uint8_t;
@@ -110,145 +116,75 @@ FFTDewarpHelper::ParametersType convertVec2Params(const std::vector<double>& vec
 //{
 //  return FFTDewarpHelper::pixelIndex(sizeVec[0], sizeVec[1]);
 //}
-SizeVec2Type pixelIndexToSizeVec(const FFTDewarpHelper::PixelIndex& pixelType)
-{
-  return SizeVec2Type(static_cast<size_t>(pixelType[0]), static_cast<size_t>(pixelType[1]));
-}
-size_t flatten(const SizeVec2Type& xyPos, const SizeVec3Type& dimensions)
-{
-  const size_t x = xyPos[0];
-  const size_t y = xyPos[1];
-
-  const size_t width = dimensions[0];
-
-  return x + y * width;
-}
-size_t flatten(const FFTDewarpHelper::PixelIndex& xyPos, const SizeVec3Type& dimensions)
-{
-  return flatten(pixelIndexToSizeVec(xyPos), dimensions);
-}
-
-template <typename T>
-void clearTuple(const typename DataArray<T>::Pointer& da, size_t numComponents, size_t tupleId)
-{
-  T initValue = da->getInitValue();
-  typename std::vector<T> blankTuple(numComponents, initValue);
-  da->setTuple(tupleId, blankTuple);
-}
-
-template <typename T>
-void transformDataPixel(double x_trans, double y_trans, const SizeVec2Type& newPixel, const FFTDewarpHelper::ParametersType& parameters, const SizeVec3Type& dimensions,
-                        const typename DataArray<T>::Pointer& da, const typename DataArray<T>::Pointer& tempDACopy)
-{
-  FFTDewarpHelper::PixelIndex offset = FFTDewarpHelper::pixelIndex(x_trans, y_trans);
-  FFTDewarpHelper::PixelIndex oldPixelIndex = FFTDewarpHelper::getOldIndex(FFTDewarpHelper::pixelIndex(newPixel[0], newPixel[1]), offset, parameters);
-
-  auto compDims = tempDACopy->getComponentDimensions();
-  size_t numComponents = std::accumulate(compDims.begin(), compDims.end(), 0);
-  size_t newIndex = flatten(newPixel, dimensions);
-
-  // Cannot flatten invalid { X,Y } positions
-  if(oldPixelIndex[0] < 0 || oldPixelIndex[1] < 0 || oldPixelIndex[0] >= dimensions[0] || oldPixelIndex[1] >= dimensions[1])
-  {
-    clearTuple<T>(da, numComponents, newIndex);
-    return;
-  }
-
-  size_t oldIndex = flatten(oldPixelIndex, dimensions);
-  if((oldIndex >= da->getNumberOfTuples()) || (newIndex >= da->getNumberOfTuples()))
-  {
-    return;
-  }
-
-  T* oldTuplePtr = tempDACopy->getTuplePointer(oldIndex);
-  da->setTuple(newIndex, oldTuplePtr);
-}
 
 template <typename T>
-void transformDataArray(const FFTDewarpHelper::ParametersType& parameters, const SizeVec3Type& dimensions, double x_trans, double y_trans, const typename DataArray<T>::Pointer& da)
+void transformDataArray(const FFTDewarpHelper::IndexMap& indexMap, const typename DataArray<T>::Pointer& da)
 {
   // Do not resize items that do not match the geometry.
-  size_t flattenedDims = std::accumulate(dimensions.begin(), dimensions.end(), 1, std::multiplies<double>());
   size_t numComps = da->getNumberOfComponents();
   size_t totalItems = da->getNumberOfTuples() * numComps;
-  if(totalItems / numComps != flattenedDims)
+  if(da->getNumberOfTuples() != indexMap.Width * indexMap.Height)
   {
     return;
   }
 
-  typename DataArray<T>::Pointer daCopy = std::dynamic_pointer_cast<DataArray<T>>(da->deepCopy());
-
-  const size_t width = dimensions[0];
-  const size_t height = dimensions[1];
-
-  ParallelTaskAlgorithm taskAlg;
-  std::function<void(void)> fn;
-
-  // Loop over pixels
-  for(size_t x = 0; x < width; x++)
-  {
-    for(size_t y = 0; y < height; y++)
-    {
-      SizeVec2Type newPixel{x, y};
-
-      fn = std::bind(&transformDataPixel<T>, x_trans, y_trans, newPixel, parameters, dimensions, da, daCopy);
-      taskAlg.execute(fn);
-    }
-  }
-  taskAlg.wait();
+  // The tuples are gathered from a copy of the original values
+  T* destination = da->getPointer(0);
+  const std::vector<T> source(destination, destination + totalItems);
+  FFTDewarpHelper::gatherTuples<T>(indexMap, source.data(), destination, numComps, da->getInitValue());
 }
 
-void transformIDataArray(const FFTDewarpHelper::ParametersType& parameters, const SizeVec3Type& dimensions, double x_trans, double y_trans, const IDataArray::Pointer& da)
+void transformIDataArray(const FFTDewarpHelper::IndexMap& indexMap, const IDataArray::Pointer& da)
 {
   if(std::dynamic_pointer_cast<Int8ArrayType>(da))
   {
     Int8ArrayType::Pointer array = std::dynamic_pointer_cast<Int8ArrayType>(da);
-    transformDataArray<int8_t>(parameters, dimensions, x_trans, y_trans, array);
+    transformDataArray<int8_t>(indexMap, array);
   }
   else if(std::dynamic_pointer_cast<UInt8ArrayType>(da))
   {
     UInt8ArrayType::Pointer array = std::dynamic_pointer_cast<UInt8ArrayType>(da);
-    transformDataArray<uint8_t>(parameters, dimensions, x_trans, y_trans, array);
+    transformDataArray<uint8_t>(indexMap, array);
   }
   else if(std::dynamic_pointer_cast<Int16ArrayType>(da))
   {
     Int16ArrayType::Pointer array = std::dynamic_pointer_cast<Int16ArrayType>(da);
-    transformDataArray<int16_t>(parameters, dimensions, x_trans, y_trans, array);
+    transformDataArray<int16_t>(indexMap, array);
   }
   else if(std::dynamic_pointer_cast<UInt16ArrayType>(da))
   {
     UInt16ArrayType::Pointer array = std::dynamic_pointer_cast<UInt16ArrayType>(da);
-    transformDataArray<uint16_t>(parameters, dimensions, x_trans, y_trans, array);
+    transformDataArray<uint16_t>(indexMap, array);
   }
   else if(std::dynamic_pointer_cast<Int32ArrayType>(da))
   {
     Int32ArrayType::Pointer array = std::dynamic_pointer_cast<Int32ArrayType>(da);
-    transformDataArray<int32_t>(parameters, dimensions, x_trans, y_trans, array);
+    transformDataArray<int32_t>(indexMap, array);
   }
   else if(std::dynamic_pointer_cast<UInt32ArrayType>(da))
   {
     UInt32ArrayType::Pointer array = std::dynamic_pointer_cast<UInt32ArrayType>(da);
-    transformDataArray<uint32_t>(parameters, dimensions, x_trans, y_trans, array);
+    transformDataArray<uint32_t>(indexMap, array);
   }
   else if(std::dynamic_pointer_cast<Int64ArrayType>(da))
   {
     Int64ArrayType::Pointer array = std::dynamic_pointer_cast<Int64ArrayType>(da);
-    transformDataArray<int64_t>(parameters, dimensions, x_trans, y_trans, array);
+    transformDataArray<int64_t>(indexMap, array);
   }
   else if(std::dynamic_pointer_cast<UInt64ArrayType>(da))
   {
     UInt64ArrayType::Pointer array = std::dynamic_pointer_cast<UInt64ArrayType>(da);
-    transformDataArray<uint64_t>(parameters, dimensions, x_trans, y_trans, array);
+    transformDataArray<uint64_t>(indexMap, array);
   }
   else if(std::dynamic_pointer_cast<FloatArrayType>(da))
   {
     FloatArrayType::Pointer array = std::dynamic_pointer_cast<FloatArrayType>(da);
-    transformDataArray<float>(parameters, dimensions, x_trans, y_trans, array);
+    transformDataArray<float>(indexMap, array);
   }
   else if(std::dynamic_pointer_cast<DoubleArrayType>(da))
   {
     DoubleArrayType::Pointer array = std::dynamic_pointer_cast<DoubleArrayType>(da);
-    transformDataArray<double>(parameters, dimensions, x_trans, y_trans, array);
+    transformDataArray<double>(indexMap, array);
   }
 }
 } // namespace
@@ -366,6 +302,8 @@ void ApplyDewarpParameters::execute()
   {
     return;
   }
+  ITKExecutionPolicy::Apply();
+  ITKFilterTelemetry telemetry(this);
 
   std::vector<double> pxy = getPxyVec();
 
@@ -410,6 +348,12 @@ bool ApplyDewarpParameters::checkMontageRequirements()
       setErrorCondition(-66720, QString("AttributeMatrix: %1 / %2 required").arg(dc->getName()).arg(m_AttributeMatrixName));
       return false;
     }
+
+    if(!MontageImportHelper::GetTileSourceFilePath(dc).isEmpty())
+    {
+      setErrorCondition(-66725, QString("Tile %1 is loaded on demand, its pixels must be imported to be dewarped").arg(dc->getName()));
+      return false;
+    }
   }
 
   return true;
@@ -462,6 +406,7 @@ void ApplyDewarpParameters::warpDataContainers(const FFTDewarpHelper::Parameters
 {
   // Duplicate the DataContainers used and Warp them based on the transformVector generated.
   AbstractMontage::Pointer montage = getDataContainerArray()->getMontage(m_MontageName);
+  std::map<std::array<int64_t, 4>, FFTDewarpHelper::IndexMap> indexMaps;
   for(const auto& dcOrig : *montage)
   {
     DataContainerShPtr dc = getDataContainerArray()->getDataContainer(m_TransformPrefix + dcOrig->getName());
@@ -474,6 +419,15 @@ void ApplyDewarpParameters::warpDataContainers(const FFTDewarpHelper::Parameters
     double x_trans = (imageDimX - 1) / 2.0 + xDif;
     double y_trans = (imageDimY - 1) / 2.0 + yDif;
 
+    // The index map only depends on the tile dimensions and translation, usually all the tiles share one
+    const FFTDewarpHelper::PixelIndex offset = FFTDewarpHelper::pixelIndex(x_trans, y_trans);
+    const std::array<int64_t, 4> indexMapKey = {static_cast<int64_t>(dimensions[0]), static_cast<int64_t>(dimensions[1]), offset[0], offset[1]};
+    auto indexMapIter = indexMaps.find(indexMapKey);
+    if(indexMapIter == indexMaps.end())
+    {
+      indexMapIter = indexMaps.emplace(indexMapKey, FFTDewarpHelper::createIndexMap(parameters, dimensions[0], dimensions[1], offset)).first;
+    }
+
     AttributeMatrix::Pointer am = dc->getAttributeMatrix(m_AttributeMatrixName);
     {
       // Mask Array is initialized with true values.  Use false when warping.
@@ -482,7 +436,7 @@ void ApplyDewarpParameters::warpDataContainers(const FFTDewarpHelper::Parameters
 
       for(const auto& da : *am)
       {
-        transformIDataArray(parameters, dimensions, x_trans, y_trans, da);
+        transformIDataArray(indexMapIter->second, da);
       }
     }
   }
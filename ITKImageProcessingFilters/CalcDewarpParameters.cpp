@@ -69,6 +69,9 @@ using MutexType = tbb::queuing_mutex;
 #include "ITKImageProcessing/ITKImageProcessingConstants.h"
 #include "ITKImageProcessing/ITKImageProcessingFilters/util/FFTConvolutionCostFunction.h"
 #include "ITKImageProcessing/ITKImageProcessingFilters/util/FFTDewarpHelper.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/ITKExecutionPolicy.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/ITKFilterTelemetry.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/MontageImportHelper.h"
 #include "ITKImageProcessing/ITKImageProcessingVersion.h"
 
 using Grayscale_T = uint8_t;
@@ -173,6 +176,8 @@ void CalcDewarpParameters::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_INTEGER_FP("Max Iterations", MaxIterations, FilterParameter::Category::Parameter, CalcDewarpParameters));
   parameters.push_back(SIMPL_NEW_INTEGER_FP("Delta", Delta, FilterParameter::Category::Parameter, CalcDewarpParameters));
   parameters.push_back(SIMPL_NEW_DOUBLE_FP("Fractional Convergence Tolerance", FractionalTolerance, FilterParameter::Category::Parameter, CalcDewarpParameters));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Evaluate Simplex Points in Parallel", ParallelEvaluation, FilterParameter::Category::Parameter, CalcDewarpParameters));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Parallel Starts", NumberOfStarts, FilterParameter::Category::Parameter, CalcDewarpParameters));
 
   std::vector<QString> linkedSpecifySimplexProps{"XFactors", "YFactors"};
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Specify Initial Simplex", SpecifyInitialSimplex, FilterParameter::Category::Parameter, CalcDewarpParameters, linkedSpecifySimplexProps));
@@ -205,6 +210,12 @@ void CalcDewarpParameters::dataCheck()
     return;
   }
 
+  if(m_NumberOfStarts < 1)
+  {
+    setErrorCondition(-66760, QObject::tr("The number of parallel starts must be at least 1"));
+    return;
+  }
+
   // The data container holds a single output attribute matrix with 3 data arrays
   // One for the number of iterations taken
   // One for the transform array
@@ -232,6 +243,8 @@ void CalcDewarpParameters::execute()
   {
     return;
   }
+  ITKExecutionPolicy::Apply();
+  ITKFilterTelemetry telemetry(this);
 
   // Generate internal grayscale values
   int err = generateGrayscaleIPF();
@@ -263,6 +276,9 @@ void CalcDewarpParameters::execute()
   m_Optimizer->SetFractionalTolerance(m_FractionalTolerance);
   m_Optimizer->SetInitialPosition(initialParams);
   m_Optimizer->SetInitialSimplexDelta(stepSizes);
+  // The cost function keeps separate buffers for each concurrent evaluation
+  m_Optimizer->SetParallelEvaluation(m_ParallelEvaluation);
+  m_Optimizer->SetNumberOfStarts(static_cast<unsigned int>(m_NumberOfStarts));
   // m_Optimizer->SetOptimizeWithRestarts(true);
 
   m_Optimizer->SetSIMPLFilter(this);
@@ -346,6 +362,12 @@ bool CalcDewarpParameters::checkMontageRequirements()
       return false;
     }
 
+    if(!MontageImportHelper::GetTileSourceFilePath(dc).isEmpty())
+    {
+      setErrorCondition(-66725, QString("Tile %1 is loaded on demand, its pixels must be imported to be dewarped").arg(dc->getName()));
+      return false;
+    }
+
     DataArray<Grayscale_T>::Pointer da = am->getAttributeArrayAs<DataArray<Grayscale_T>>(m_IPFColorsArrayName);
     if(nullptr == da)
     {
@@ -730,6 +752,38 @@ void CalcDewarpParameters::setSpecifyInitialSimplex(bool value)
   m_SpecifyInitialSimplex = value;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool CalcDewarpParameters::getParallelEvaluation() const
+{
+  return m_ParallelEvaluation;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CalcDewarpParameters::setParallelEvaluation(bool value)
+{
+  m_ParallelEvaluation = value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int CalcDewarpParameters::getNumberOfStarts() const
+{
+  return m_NumberOfStarts;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CalcDewarpParameters::setNumberOfStarts(int value)
+{
+  m_NumberOfStarts = value;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
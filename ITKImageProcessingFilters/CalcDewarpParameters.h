@@ -71,6 +71,8 @@ class ITKImageProcessing_EXPORT CalcDewarpParameters : public AbstractFilter
   PYB11_PROPERTY(double FractionalTolerance READ getFractionalTolerance WRITE setFractionalTolerance)
   PYB11_PROPERTY(int Delta READ getDelta WRITE setDelta)
   PYB11_PROPERTY(bool SpecifyInitialSimplex READ getSpecifyInitialSimplex WRITE setSpecifyInitialSimplex)
+  PYB11_PROPERTY(bool ParallelEvaluation READ getParallelEvaluation WRITE setParallelEvaluation)
+  PYB11_PROPERTY(int NumberOfStarts READ getNumberOfStarts WRITE setNumberOfStarts)
   PYB11_PROPERTY(FloatVec7Type XFactors READ getXFactors WRITE setXFactors)
   PYB11_PROPERTY(FloatVec7Type YFactors READ getYFactors WRITE setYFactors)
   PYB11_PROPERTY(QString AttributeMatrixName READ getAttributeMatrixName WRITE setAttributeMatrixName)
@@ -128,6 +130,14 @@ public:
   void setSpecifyInitialSimplex(bool value);
   Q_PROPERTY(bool SpecifyInitialSimplex READ getSpecifyInitialSimplex WRITE setSpecifyInitialSimplex)
 
+  bool getParallelEvaluation() const;
+  void setParallelEvaluation(bool value);
+  Q_PROPERTY(bool ParallelEvaluation READ getParallelEvaluation WRITE setParallelEvaluation)
+
+  int getNumberOfStarts() const;
+  void setNumberOfStarts(int value);
+  Q_PROPERTY(int NumberOfStarts READ getNumberOfStarts WRITE setNumberOfStarts)
+
   FloatVec7Type getXFactors() const;
   void setXFactors(const FloatVec7Type& value);
   Q_PROPERTY(FloatVec7Type XFactors READ getXFactors WRITE setXFactors)
@@ -294,6 +304,8 @@ private:
   double m_FractionalTolerance = 1E-5;
   int m_StepDelta = 5;
   bool m_SpecifyInitialSimplex = true;
+  bool m_ParallelEvaluation = false;
+  int m_NumberOfStarts = 1;
   QString m_AttributeMatrixName;
   QString m_IPFColorsArrayName = "IPFColor";
   QString m_TransformDCName = "Dewarp Data";
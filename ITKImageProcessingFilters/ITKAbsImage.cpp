@@ -35,6 +35,7 @@ void ITKAbsImage::setupFilterParameters()
 
   std::vector<QString> linkedProps;
   linkedProps.push_back("NewCellArrayName");
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Category::Parameter, ITKAbsImage, linkedProps));
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -44,6 +45,8 @@ void ITKAbsImage::setupFilterParameters()
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::CreatedArray));
   parameters.push_back(SIMPL_NEW_STRING_FP("Filtered Array", NewCellArrayName, FilterParameter::Category::CreatedArray, ITKAbsImage));
 
+  setupExecutionFilterParameters(parameters);
+
   setFilterParameters(parameters);
 }
 
@@ -55,6 +58,8 @@ void ITKAbsImage::readFilterParameters(AbstractFilterParametersReader* reader, i
   reader->openFilterGroup(this, index);
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
+  setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
 
   reader->closeFilterGroup();
 }
@@ -104,6 +109,14 @@ void ITKAbsImage::filterInternal()
   Dream3DArraySwitchMacro(this->filter, getSelectedCellArrayPath(), -4);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKAbsImage::isStreamable() const
+{
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -114,6 +114,11 @@ protected:
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageProcessingBase class
+   */
+  bool isStreamable() const override;
+
 public:
   ITKAbsImage(const ITKAbsImage&) = delete;            // Copy Constructor Not Implemented
   ITKAbsImage(ITKAbsImage&&) = delete;                 // Move Constructor Not Implemented
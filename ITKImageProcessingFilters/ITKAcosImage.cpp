@@ -35,6 +35,7 @@ void ITKAcosImage::setupFilterParameters()
 
   std::vector<QString> linkedProps;
   linkedProps.push_back("NewCellArrayName");
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Category::Parameter, ITKAcosImage, linkedProps));
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -44,6 +45,8 @@ void ITKAcosImage::setupFilterParameters()
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::CreatedArray));
   parameters.push_back(SIMPL_NEW_STRING_FP("Filtered Array", NewCellArrayName, FilterParameter::Category::CreatedArray, ITKAcosImage));
 
+  setupExecutionFilterParameters(parameters);
+
   setFilterParameters(parameters);
 }
 
@@ -55,6 +58,8 @@ void ITKAcosImage::readFilterParameters(AbstractFilterParametersReader* reader,
   reader->openFilterGroup(this, index);
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
+  setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
 
   reader->closeFilterGroup();
 }
@@ -92,7 +97,7 @@ void ITKAcosImage::filter()
   // define filter
   typedef itk::AcosImageFilter<InputImageType, OutputImageType> FilterType;
   typename FilterType::Pointer filter = FilterType::New();
-  this->ITKImageProcessingBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter);
+  this->ITKImageProcessingBase::filterUnary<InputPixelType, OutputPixelType, Dimension, FilterType>(filter, ITKUnaryKernels::Operation::Acos);
 }
 
 // -----------------------------------------------------------------------------
@@ -103,6 +108,14 @@ void ITKAcosImage::filterInternal()
   Dream3DArraySwitchMacro(this->filter, getSelectedCellArrayPath(), -4);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKAcosImage::isStreamable() const
+{
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
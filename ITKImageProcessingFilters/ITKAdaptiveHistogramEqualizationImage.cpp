@@ -44,6 +44,7 @@ void ITKAdaptiveHistogramEqualizationImage::setupFilterParameters()
 
   std::vector<QString> linkedProps;
   linkedProps.push_back("NewCellArrayName");
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Category::Parameter, ITKAdaptiveHistogramEqualizationImage, linkedProps));
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -53,6 +54,8 @@ void ITKAdaptiveHistogramEqualizationImage::setupFilterParameters()
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::CreatedArray));
   parameters.push_back(SIMPL_NEW_STRING_FP("Filtered Array", NewCellArrayName, FilterParameter::Category::CreatedArray, ITKAdaptiveHistogramEqualizationImage));
 
+  setupExecutionFilterParameters(parameters);
+
   setFilterParameters(parameters);
 }
 
@@ -64,9 +67,11 @@ void ITKAdaptiveHistogramEqualizationImage::readFilterParameters(AbstractFilterP
   reader->openFilterGroup(this, index);
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
+  setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
   setRadius(reader->readFloatVec3("Radius", getRadius()));
   setAlpha(reader->readValue("Alpha", getAlpha()));
   setBeta(reader->readValue("Beta", getBeta()));
+  readExecutionFilterParameters(reader);
 
   reader->closeFilterGroup();
 }
@@ -5,6 +5,9 @@
  */
 
 #include "ITKImageProcessing/ITKImageProcessingFilters/ITKApproximateSignedDistanceMapImage.h"
+
+#include <cmath>
+
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
@@ -42,6 +45,7 @@ void ITKApproximateSignedDistanceMapImage::setupFilterParameters()
 
   std::vector<QString> linkedProps;
   linkedProps.push_back("NewCellArrayName");
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Category::Parameter, ITKApproximateSignedDistanceMapImage, linkedProps));
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -51,6 +55,8 @@ void ITKApproximateSignedDistanceMapImage::setupFilterParameters()
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::CreatedArray));
   parameters.push_back(SIMPL_NEW_STRING_FP("Filtered Array", NewCellArrayName, FilterParameter::Category::CreatedArray, ITKApproximateSignedDistanceMapImage));
 
+  setupExecutionFilterParameters(parameters);
+
   setFilterParameters(parameters);
 }
 
@@ -62,8 +68,10 @@ void ITKApproximateSignedDistanceMapImage::readFilterParameters(AbstractFilterPa
   reader->openFilterGroup(this, index);
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
+  setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
   setInsideValue(reader->readValue("InsideValue", getInsideValue()));
   setOutsideValue(reader->readValue("OutsideValue", getOutsideValue()));
+  readExecutionFilterParameters(reader);
 
   reader->closeFilterGroup();
 }
@@ -114,6 +122,23 @@ void ITKApproximateSignedDistanceMapImage::filterInternal()
   Dream3DArraySwitchMacroOutputType(this->filter, getSelectedCellArrayPath(), -4, float, 0);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKApproximateSignedDistanceMapImage::getWorkingMemoryPerPixel(size_t /*inputPixelSize*/, size_t outputPixelSize, unsigned int /*dimension*/) const
+{
+  // Iso-contour distance image the chamfer distance is computed in
+  return static_cast<double>(outputPixelSize);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKApproximateSignedDistanceMapImage::getRelativeCost(unsigned int dimension) const
+{
+  return std::pow(3.0, dimension) + 2.0;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -114,6 +114,11 @@ protected:
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageProcessingBase class
+   */
+  bool isStreamable() const override;
+
 public:
   ITKAsinImage(const ITKAsinImage&) = delete;            // Copy Constructor Not Implemented
   ITKAsinImage(ITKAsinImage&&) = delete;                 // Move Constructor Not Implemented
@@ -151,6 +151,16 @@ protected:
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
 
+  /**
+   * @brief getRelativeCost Reimplemented from @see ITKImageProcessingBase class
+   */
+  double getRelativeCost(unsigned int dimension) const override;
+
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageProcessingBase class
+   */
+  bool isStreamable() const override;
+
 public:
   ITKBilateralImage(const ITKBilateralImage&) = delete;            // Copy Constructor Not Implemented
   ITKBilateralImage(ITKBilateralImage&&) = delete;                 // Move Constructor Not Implemented
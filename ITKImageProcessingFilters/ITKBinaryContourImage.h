@@ -152,6 +152,11 @@ protected:
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageProcessingBase class
+   */
+  bool isStreamable() const override;
+
 public:
   ITKBinaryContourImage(const ITKBinaryContourImage&) = delete;            // Copy Constructor Not Implemented
   ITKBinaryContourImage(ITKBinaryContourImage&&) = delete;                 // Move Constructor Not Implemented
@@ -178,6 +178,11 @@ protected:
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageProcessingBase class
+   */
+  bool isStreamable() const override;
+
 public:
   ITKBinaryDilateImage(const ITKBinaryDilateImage&) = delete;            // Copy Constructor Not Implemented
   ITKBinaryDilateImage(ITKBinaryDilateImage&&) = delete;                 // Move Constructor Not Implemented
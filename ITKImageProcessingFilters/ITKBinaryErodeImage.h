@@ -178,6 +178,11 @@ protected:
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageProcessingBase class
+   */
+  bool isStreamable() const override;
+
 public:
   ITKBinaryErodeImage(const ITKBinaryErodeImage&) = delete;            // Copy Constructor Not Implemented
   ITKBinaryErodeImage(ITKBinaryErodeImage&&) = delete;                 // Move Constructor Not Implemented
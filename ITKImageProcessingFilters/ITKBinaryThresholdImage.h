@@ -164,6 +164,11 @@ protected:
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageProcessingBase class
+   */
+  bool isStreamable() const override;
+
 public:
   ITKBinaryThresholdImage(const ITKBinaryThresholdImage&) = delete;            // Copy Constructor Not Implemented
   ITKBinaryThresholdImage(ITKBinaryThresholdImage&&) = delete;                 // Move Constructor Not Implemented
@@ -123,6 +123,11 @@ protected:
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageProcessingBase class
+   */
+  bool isStreamable() const override;
+
 public:
   ITKCastImage(const ITKCastImage&) = delete;            // Copy Constructor Not Implemented
   ITKCastImage(ITKCastImage&&) = delete;                 // Move Constructor Not Implemented
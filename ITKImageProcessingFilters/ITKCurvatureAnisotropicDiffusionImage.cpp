@@ -5,8 +5,13 @@
  */
 
 #include "ITKImageProcessing/ITKImageProcessingFilters/ITKCurvatureAnisotropicDiffusionImage.h"
+
+#include <algorithm>
+#include <cmath>
+
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
@@ -43,9 +48,11 @@ void ITKCurvatureAnisotropicDiffusionImage::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_DOUBLE_FP("ConductanceParameter", ConductanceParameter, FilterParameter::Category::Parameter, ITKCurvatureAnisotropicDiffusionImage));
   parameters.push_back(SIMPL_NEW_DOUBLE_FP("ConductanceScalingUpdateInterval", ConductanceScalingUpdateInterval, FilterParameter::Category::Parameter, ITKCurvatureAnisotropicDiffusionImage));
   parameters.push_back(SIMPL_NEW_DOUBLE_FP("NumberOfIterations", NumberOfIterations, FilterParameter::Category::Parameter, ITKCurvatureAnisotropicDiffusionImage));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Single Precision Intermediate", SinglePrecisionIntermediate, FilterParameter::Category::Parameter, ITKCurvatureAnisotropicDiffusionImage));
 
   std::vector<QString> linkedProps;
   linkedProps.push_back("NewCellArrayName");
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Category::Parameter, ITKCurvatureAnisotropicDiffusionImage, linkedProps));
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -55,6 +62,8 @@ void ITKCurvatureAnisotropicDiffusionImage::setupFilterParameters()
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::CreatedArray));
   parameters.push_back(SIMPL_NEW_STRING_FP("Filtered Array", NewCellArrayName, FilterParameter::Category::CreatedArray, ITKCurvatureAnisotropicDiffusionImage));
 
+  setupExecutionFilterParameters(parameters);
+
   setFilterParameters(parameters);
 }
 
@@ -66,10 +75,13 @@ void ITKCurvatureAnisotropicDiffusionImage::readFilterParameters(AbstractFilterP
   reader->openFilterGroup(this, index);
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
+  setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
   setTimeStep(reader->readValue("TimeStep", getTimeStep()));
   setConductanceParameter(reader->readValue("ConductanceParameter", getConductanceParameter()));
   setConductanceScalingUpdateInterval(reader->readValue("ConductanceScalingUpdateInterval", getConductanceScalingUpdateInterval()));
   setNumberOfIterations(reader->readValue("NumberOfIterations", getNumberOfIterations()));
+  setSinglePrecisionIntermediate(reader->readValue("SinglePrecisionIntermediate", getSinglePrecisionIntermediate()));
+  readExecutionFilterParameters(reader);
 
   reader->closeFilterGroup();
 }
@@ -104,7 +116,22 @@ void ITKCurvatureAnisotropicDiffusionImage::dataCheck()
 template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension>
 void ITKCurvatureAnisotropicDiffusionImage::filter()
 {
-  typedef typename itk::NumericTraits<InputPixelType>::RealType FloatPixelType;
+  if(getSinglePrecisionIntermediate())
+  {
+    filterWithIntermediate<InputPixelType, OutputPixelType, Dimension, typename itk::NumericTraits<InputPixelType>::FloatType>();
+  }
+  else
+  {
+    filterWithIntermediate<InputPixelType, OutputPixelType, Dimension, typename itk::NumericTraits<InputPixelType>::RealType>();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension, typename FloatPixelType>
+void ITKCurvatureAnisotropicDiffusionImage::filterWithIntermediate()
+{
   typedef itk::Image<FloatPixelType, Dimension> FloatImageType;
   typedef itk::CurvatureAnisotropicDiffusionImageFilter<FloatImageType, FloatImageType> FilterType;
 
@@ -124,6 +151,31 @@ void ITKCurvatureAnisotropicDiffusionImage::filterInternal()
   Dream3DArraySwitchMacro(this->filter, getSelectedCellArrayPath(), -4);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ITKCurvatureAnisotropicDiffusionImage::getIntermediatePixelSize() const
+{
+  return m_SinglePrecisionIntermediate ? sizeof(float) : sizeof(double);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKCurvatureAnisotropicDiffusionImage::getWorkingMemoryPerPixel(size_t /*inputPixelSize*/, size_t /*outputPixelSize*/, unsigned int /*dimension*/) const
+{
+  // Floating point copy of the input, solution and update buffer
+  return static_cast<double>(3 * getIntermediatePixelSize());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKCurvatureAnisotropicDiffusionImage::getRelativeCost(unsigned int dimension) const
+{
+  return 4.0 * std::pow(3.0, dimension) * std::max(m_NumberOfIterations, 1.0);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -237,3 +289,15 @@ double ITKCurvatureAnisotropicDiffusionImage::getNumberOfIterations() const
 {
   return m_NumberOfIterations;
 }
+
+// -----------------------------------------------------------------------------
+void ITKCurvatureAnisotropicDiffusionImage::setSinglePrecisionIntermediate(bool value)
+{
+  m_SinglePrecisionIntermediate = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ITKCurvatureAnisotropicDiffusionImage::getSinglePrecisionIntermediate() const
+{
+  return m_SinglePrecisionIntermediate;
+}
@@ -5,6 +5,10 @@
  */
 
 #include "ITKImageProcessing/ITKImageProcessingFilters/ITKCurvatureFlowImage.h"
+
+#include <algorithm>
+#include <cmath>
+
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
@@ -42,6 +46,7 @@ void ITKCurvatureFlowImage::setupFilterParameters()
 
   std::vector<QString> linkedProps;
   linkedProps.push_back("NewCellArrayName");
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Category::Parameter, ITKCurvatureFlowImage, linkedProps));
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -51,6 +56,8 @@ void ITKCurvatureFlowImage::setupFilterParameters()
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::CreatedArray));
   parameters.push_back(SIMPL_NEW_STRING_FP("Filtered Array", NewCellArrayName, FilterParameter::Category::CreatedArray, ITKCurvatureFlowImage));
 
+  setupExecutionFilterParameters(parameters);
+
   setFilterParameters(parameters);
 }
 
@@ -62,8 +69,10 @@ void ITKCurvatureFlowImage::readFilterParameters(AbstractFilterParametersReader*
   reader->openFilterGroup(this, index);
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
+  setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
   setTimeStep(reader->readValue("TimeStep", getTimeStep()));
   setNumberOfIterations(reader->readValue("NumberOfIterations", getNumberOfIterations()));
+  readExecutionFilterParameters(reader);
 
   reader->closeFilterGroup();
 }
@@ -115,6 +124,23 @@ void ITKCurvatureFlowImage::filterInternal()
   Dream3DArraySwitchMacroOutputType(this->filter, getSelectedCellArrayPath(), -4, typename itk::NumericTraits<typename InputImageType::PixelType>::RealType, 1);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKCurvatureFlowImage::getWorkingMemoryPerPixel(size_t /*inputPixelSize*/, size_t /*outputPixelSize*/, unsigned int /*dimension*/) const
+{
+  // Floating point copy of the input, solution and update buffer
+  return static_cast<double>(3 * getIntermediatePixelSize());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKCurvatureFlowImage::getRelativeCost(unsigned int dimension) const
+{
+  return 2.0 * std::pow(3.0, dimension) * std::max(m_NumberOfIterations, 1.0);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
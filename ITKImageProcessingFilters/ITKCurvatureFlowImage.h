@@ -139,6 +139,16 @@ protected:
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
 
+  /**
+   * @brief getWorkingMemoryPerPixel Reimplemented from @see ITKImageProcessingBase class
+   */
+  double getWorkingMemoryPerPixel(size_t inputPixelSize, size_t outputPixelSize, unsigned int dimension) const override;
+
+  /**
+   * @brief getRelativeCost Reimplemented from @see ITKImageProcessingBase class
+   */
+  double getRelativeCost(unsigned int dimension) const override;
+
 public:
   ITKCurvatureFlowImage(const ITKCurvatureFlowImage&) = delete;            // Copy Constructor Not Implemented
   ITKCurvatureFlowImage(ITKCurvatureFlowImage&&) = delete;                 // Move Constructor Not Implemented
@@ -44,6 +44,7 @@ void ITKDanielssonDistanceMapImage::setupFilterParameters()
 
   std::vector<QString> linkedProps;
   linkedProps.push_back("NewCellArrayName");
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Category::Parameter, ITKDanielssonDistanceMapImage, linkedProps));
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -53,6 +54,8 @@ void ITKDanielssonDistanceMapImage::setupFilterParameters()
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::CreatedArray));
   parameters.push_back(SIMPL_NEW_STRING_FP("Filtered Array", NewCellArrayName, FilterParameter::Category::CreatedArray, ITKDanielssonDistanceMapImage));
 
+  setupExecutionFilterParameters(parameters);
+
   setFilterParameters(parameters);
 }
 
@@ -64,9 +67,11 @@ void ITKDanielssonDistanceMapImage::readFilterParameters(AbstractFilterParameter
   reader->openFilterGroup(this, index);
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
+  setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
   setInputIsBinary(reader->readValue("InputIsBinary", getInputIsBinary()));
   setSquaredDistance(reader->readValue("SquaredDistance", getSquaredDistance()));
   setUseImageSpacing(reader->readValue("UseImageSpacing", getUseImageSpacing()));
+  readExecutionFilterParameters(reader);
 
   reader->closeFilterGroup();
 }
@@ -118,6 +123,23 @@ void ITKDanielssonDistanceMapImage::filterInternal()
   Dream3DArraySwitchMacroOutputType(this->filter, getSelectedCellArrayPath(), -4, float, 0);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKDanielssonDistanceMapImage::getWorkingMemoryPerPixel(size_t inputPixelSize, size_t /*outputPixelSize*/, unsigned int dimension) const
+{
+  // Voronoi map and vector distance map
+  return static_cast<double>(inputPixelSize + dimension * sizeof(itk::OffsetValueType));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKDanielssonDistanceMapImage::getRelativeCost(unsigned int dimension) const
+{
+  return 4.0 * dimension;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
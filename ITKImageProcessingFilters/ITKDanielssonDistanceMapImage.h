@@ -151,6 +151,16 @@ protected:
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
 
+  /**
+   * @brief getWorkingMemoryPerPixel Reimplemented from @see ITKImageProcessingBase class
+   */
+  double getWorkingMemoryPerPixel(size_t inputPixelSize, size_t outputPixelSize, unsigned int dimension) const override;
+
+  /**
+   * @brief getRelativeCost Reimplemented from @see ITKImageProcessingBase class
+   */
+  double getRelativeCost(unsigned int dimension) const override;
+
 public:
   ITKDanielssonDistanceMapImage(const ITKDanielssonDistanceMapImage&) = delete;            // Copy Constructor Not Implemented
   ITKDanielssonDistanceMapImage(ITKDanielssonDistanceMapImage&&) = delete;                 // Move Constructor Not Implemented
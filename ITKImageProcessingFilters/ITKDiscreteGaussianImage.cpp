@@ -41,6 +41,7 @@ void ITKDiscreteGaussianImage::setupFilterParameters()
 
   std::vector<QString> linkedProps;
   linkedProps.push_back("NewCellArrayName");
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Category::Parameter, ITKDiscreteGaussianImage, linkedProps));
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -50,6 +51,8 @@ void ITKDiscreteGaussianImage::setupFilterParameters()
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::CreatedArray));
   parameters.push_back(SIMPL_NEW_STRING_FP("Filtered Array", NewCellArrayName, FilterParameter::Category::CreatedArray, ITKDiscreteGaussianImage));
 
+  setupExecutionFilterParameters(parameters);
+
   setFilterParameters(parameters);
 }
 
@@ -61,10 +64,12 @@ void ITKDiscreteGaussianImage::readFilterParameters(AbstractFilterParametersRead
   reader->openFilterGroup(this, index);
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
+  setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
   setVariance(reader->readFloatVec3("Variance", getVariance()));
   setMaximumKernelWidth(reader->readValue("MaximumKernelWidth", getMaximumKernelWidth()));
   setMaximumError(reader->readFloatVec3("MaximumError", getMaximumError()));
   setUseImageSpacing(reader->readValue("UseImageSpacing", getUseImageSpacing()));
+  readExecutionFilterParameters(reader);
 
   reader->closeFilterGroup();
 }
@@ -120,6 +125,14 @@ void ITKDiscreteGaussianImage::filterInternal()
   Dream3DArraySwitchMacro(this->filter, getSelectedCellArrayPath(), -4);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKDiscreteGaussianImage::isStreamable() const
+{
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
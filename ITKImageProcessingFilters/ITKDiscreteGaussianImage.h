@@ -165,6 +165,11 @@ protected:
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageProcessingBase class
+   */
+  bool isStreamable() const override;
+
 public:
   ITKDiscreteGaussianImage(const ITKDiscreteGaussianImage&) = delete;            // Copy Constructor Not Implemented
   ITKDiscreteGaussianImage(ITKDiscreteGaussianImage&&) = delete;                 // Move Constructor Not Implemented
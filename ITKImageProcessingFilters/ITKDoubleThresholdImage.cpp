@@ -52,6 +52,7 @@ void ITKDoubleThresholdImage::setupFilterParameters()
 
   std::vector<QString> linkedProps;
   linkedProps.push_back("NewCellArrayName");
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Category::Parameter, ITKDoubleThresholdImage, linkedProps));
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -61,6 +62,8 @@ void ITKDoubleThresholdImage::setupFilterParameters()
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::CreatedArray));
   parameters.push_back(SIMPL_NEW_STRING_FP("Filtered Array", NewCellArrayName, FilterParameter::Category::CreatedArray, ITKDoubleThresholdImage));
 
+  setupExecutionFilterParameters(parameters);
+
   setFilterParameters(parameters);
 }
 
@@ -72,6 +75,7 @@ void ITKDoubleThresholdImage::readFilterParameters(AbstractFilterParametersReade
   reader->openFilterGroup(this, index);
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
+  setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
   setThreshold1(reader->readValue("Threshold1", getThreshold1()));
   setThreshold2(reader->readValue("Threshold2", getThreshold2()));
   setThreshold3(reader->readValue("Threshold3", getThreshold3()));
@@ -79,6 +83,7 @@ void ITKDoubleThresholdImage::readFilterParameters(AbstractFilterParametersReade
   setInsideValue(reader->readValue("InsideValue", getInsideValue()));
   setOutsideValue(reader->readValue("OutsideValue", getOutsideValue()));
   setFullyConnected(reader->readValue("FullyConnected", getFullyConnected()));
+  readExecutionFilterParameters(reader);
 
   reader->closeFilterGroup();
 }
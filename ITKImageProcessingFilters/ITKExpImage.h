@@ -106,6 +106,11 @@ protected:
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageProcessingBase class
+   */
+  bool isStreamable() const override;
+
 public:
   ITKExpImage(const ITKExpImage&) = delete;            // Copy Constructor Not Implemented
   ITKExpImage(ITKExpImage&&) = delete;                 // Move Constructor Not Implemented
@@ -44,6 +44,7 @@ void ITKFFTNormalizedCorrelationImage::setupFilterParameters()
 
   std::vector<QString> linkedProps;
   linkedProps.push_back("NewCellArrayName");
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Category::Parameter, ITKFFTNormalizedCorrelationImage, linkedProps));
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -54,6 +55,8 @@ void ITKFFTNormalizedCorrelationImage::setupFilterParameters()
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::CreatedArray));
   parameters.push_back(SIMPL_NEW_STRING_FP("Filtered Array", NewCellArrayName, FilterParameter::Category::CreatedArray, ITKFFTNormalizedCorrelationImage));
 
+  setupExecutionFilterParameters(parameters);
+
   setFilterParameters(parameters);
 }
 
@@ -66,8 +69,10 @@ void ITKFFTNormalizedCorrelationImage::readFilterParameters(AbstractFilterParame
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setSelectedCellArrayPath(reader->readDataArrayPath("MovingCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
+  setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
   setRequiredNumberOfOverlappingPixels(reader->readValue("RequiredNumberOfOverlappingPixels", getRequiredNumberOfOverlappingPixels()));
   setRequiredFractionOfOverlappingPixels(reader->readValue("RequiredFractionOfOverlappingPixels", getRequiredFractionOfOverlappingPixels()));
+  readExecutionFilterParameters(reader);
 
   reader->closeFilterGroup();
 }
@@ -82,6 +87,11 @@ void ITKFFTNormalizedCorrelationImage::dataCheckImpl()
   this->CheckIntegerEntry<uint64_t, double>(m_RequiredNumberOfOverlappingPixels, "RequiredNumberOfOverlappingPixels", true);
 
   ITKImageProcessingBase::dataCheckImpl<InputPixelType, OutputPixelType, Dimension>();
+  // The correlation image does not have the size of the input image
+  if(getRegionOfInterestMode() != 0)
+  {
+    setWarningCondition(-55575, "The region of interest is ignored, the correlation is computed on the whole images");
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -151,7 +161,7 @@ void ITKFFTNormalizedCorrelationImage::filter()
     typename OutputImageType::Pointer image = OutputImageType::New();
     image = caster->GetOutput();
     image->DisconnectPipeline();
-    std::string outputArrayName(getNewCellArrayName().toStdString());
+    std::string outputArrayName(getOutputArrayName(false).toStdString());
 
     typedef itk::InPlaceImageToDream3DDataFilter<OutputPixelType, Dimension> toDream3DType;
     typename toDream3DType::Pointer toDream3DFilter = toDream3DType::New();
@@ -167,6 +177,10 @@ void ITKFFTNormalizedCorrelationImage::filter()
     setErrorCondition(-55558, errorMessage.arg(err.GetDescription()));
     return;
   }
+  if(!getSaveAsNewArray())
+  {
+    replaceInputArray();
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -177,6 +191,14 @@ void ITKFFTNormalizedCorrelationImage::filterInternal()
   Dream3DArraySwitchMacroOutputType(this->filter, getSelectedCellArrayPath(), -4, float, 0);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKFFTNormalizedCorrelationImage::hasAdditionalInputs() const
+{
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -152,6 +152,11 @@ protected:
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
 
+  /**
+   * @brief hasAdditionalInputs Reimplemented from @see ITKImageProcessingBase class
+   */
+  bool hasAdditionalInputs() const override;
+
 public:
   ITKFFTNormalizedCorrelationImage(const ITKFFTNormalizedCorrelationImage&) = delete;            // Copy Constructor Not Implemented
   ITKFFTNormalizedCorrelationImage(ITKFFTNormalizedCorrelationImage&&) = delete;                 // Move Constructor Not Implemented
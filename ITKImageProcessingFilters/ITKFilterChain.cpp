@@ -0,0 +1,497 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#include "ITKFilterChain.h"
+
+#include <QtCore/QFileInfo>
+#include <QtCore/QStringList>
+#include <QtCore/QTextStream>
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/InputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/JsonFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
+#include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+
+#include "ITKImageProcessing/ITKImageProcessingConstants.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/ITKExecutionPolicy.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/ITKFilterTelemetry.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/MontageImportHelper.h"
+#include "ITKImageProcessing/ITKImageProcessingVersion.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKFilterChain::ITKFilterChain()
+{
+  initialize();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKFilterChain::~ITKFilterChain() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKFilterChain::initialize()
+{
+  clearErrorCode();
+  clearWarningCode();
+  setCancel(false);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKFilterChain::setupFilterParameters()
+{
+  FilterParameterVectorType parameters;
+
+  parameters.push_back(SIMPL_NEW_INPUT_FILE_FP("Pipeline File", PipelineFile, FilterParameter::Category::Parameter, ITKFilterChain, "*.json"));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Kept Intermediate Filters (e.g. 1,3)", KeptStages, FilterParameter::Category::Parameter, ITKFilterChain));
+
+  parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::RequiredArray));
+  {
+    DataArraySelectionFilterParameter::RequirementType req =
+        DataArraySelectionFilterParameter::CreateRequirement(SIMPL::Defaults::AnyPrimitive, SIMPL::Defaults::AnyComponentSize, AttributeMatrix::Type::Cell, IGeometry::Type::Image);
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Attribute Array to filter", SelectedCellArrayPath, FilterParameter::Category::RequiredArray, ITKFilterChain, req));
+  }
+  parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::CreatedArray));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Filtered Array", NewCellArrayName, FilterParameter::Category::CreatedArray, ITKFilterChain));
+
+  setFilterParameters(parameters);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKFilterChain::readFilterParameters(AbstractFilterParametersReader* reader, int index)
+{
+  reader->openFilterGroup(this, index);
+  setPipelineFile(reader->readString("PipelineFile", getPipelineFile()));
+  setKeptStages(reader->readString("KeptStages", getKeptStages()));
+  setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
+  setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
+  reader->closeFilterGroup();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKFilterChain::readStages()
+{
+  m_Stages.clear();
+
+  QFileInfo fi(getPipelineFile());
+  if(getPipelineFile().isEmpty() || !fi.exists())
+  {
+    QString ss = QObject::tr("The pipeline file '%1' does not exist").arg(getPipelineFile());
+    setErrorCondition(-55580, ss);
+    return;
+  }
+
+  JsonFilterParametersReader::Pointer jsonReader = JsonFilterParametersReader::New();
+  FilterPipeline::Pointer pipeline = jsonReader->readPipelineFromFile(getPipelineFile());
+  if(nullptr == pipeline)
+  {
+    QString ss = QObject::tr("The pipeline file '%1' could not be read").arg(getPipelineFile());
+    setErrorCondition(-55581, ss);
+    return;
+  }
+
+  FilterPipeline::FilterContainerType filters = pipeline->getFilterContainer();
+  for(const AbstractFilter::Pointer& filter : filters)
+  {
+    if(!filter->getEnabled())
+    {
+      continue;
+    }
+    ITKImageProcessingBase::Pointer stage = std::dynamic_pointer_cast<ITKImageProcessingBase>(filter);
+    if(nullptr == stage)
+    {
+      QString ss = QObject::tr("'%1' is not an ITK image processing filter and can not be part of an ITK filter chain").arg(filter->getHumanLabel());
+      setErrorCondition(-55582, ss);
+      m_Stages.clear();
+      return;
+    }
+    if(stage->hasAdditionalInputs())
+    {
+      QString ss = QObject::tr("'%1' reads other arrays than its input and can not be part of an ITK filter chain").arg(filter->getHumanLabel());
+      setErrorCondition(-55588, ss);
+      m_Stages.clear();
+      return;
+    }
+    connect(stage.get(), &AbstractFilter::messageGenerated, this, &AbstractFilter::messageGenerated);
+    m_Stages.push_back(stage);
+  }
+
+  if(m_Stages.empty())
+  {
+    QString ss = QObject::tr("The pipeline file '%1' does not contain any enabled filter").arg(getPipelineFile());
+    setErrorCondition(-55583, ss);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKFilterChain::isStageKept(size_t index) const
+{
+  if(index + 1 == m_Stages.size())
+  {
+    return true;
+  }
+  const QStringList stages = m_KeptStages.split(',', QString::SkipEmptyParts);
+  for(const QString& stage : stages)
+  {
+    if(stage.trimmed().toInt() == static_cast<int>(index + 1))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKFilterChain::dataCheck()
+{
+  clearErrorCode();
+  clearWarningCode();
+  m_StagesDataContainerArray = DataContainerArray::NullPointer();
+
+  if(getNewCellArrayName().isEmpty())
+  {
+    setErrorCondition(-55584, "The name of the filtered array can not be empty");
+    return;
+  }
+
+  DataContainer::Pointer tileDc = getDataContainerArray()->getDataContainer(getSelectedCellArrayPath().getDataContainerName());
+  if(nullptr != tileDc && !MontageImportHelper::GetTileSourceFilePath(tileDc).isEmpty())
+  {
+    QString ss = QObject::tr("The tile '%1' is loaded on demand, its pixels are only read by the montage filters").arg(tileDc->getName());
+    setErrorCondition(-55589, ss);
+    return;
+  }
+
+  getDataContainerArray()->getPrereqIDataArrayFromPath(this, getSelectedCellArrayPath());
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+  DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(getSelectedCellArrayPath().getDataContainerName());
+  AttributeMatrix::Pointer am = dc->getAttributeMatrix(getSelectedCellArrayPath().getAttributeMatrixName());
+
+  readStages();
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+
+  const QStringList keptStages = m_KeptStages.split(',', QString::SkipEmptyParts);
+  for(const QString& stage : keptStages)
+  {
+    bool ok = false;
+    const int stageNumber = stage.trimmed().toInt(&ok);
+    if(!ok || stageNumber < 1 || stageNumber > static_cast<int>(m_Stages.size()))
+    {
+      QString ss = QObject::tr("Kept Intermediate Filters must be a comma separated list of filter numbers between 1 and %1").arg(m_Stages.size());
+      setErrorCondition(-55585, ss);
+      return;
+    }
+  }
+
+  // The filters of the chain are preflighted on a copy of the selected attribute matrix that shares the existing
+  // arrays. Their intermediate outputs are only created (without allocation) in this copy, so that each filter
+  // finds the pixel type it reads from the previous one.
+  DataContainerArray::Pointer stagesDca = DataContainerArray::New();
+  DataContainer::Pointer stagesDc = DataContainer::New(dc->getName());
+  stagesDc->setGeometry(dc->getGeometry());
+  AttributeMatrix::Pointer stagesAm = AttributeMatrix::New(am->getTupleDimensions(), am->getName(), am->getType());
+  for(const QString& name : am->getAttributeArrayNames())
+  {
+    stagesAm->addOrReplaceAttributeArray(am->getAttributeArray(name));
+  }
+  stagesDc->addOrReplaceAttributeMatrix(stagesAm);
+  stagesDca->addOrReplaceDataContainer(stagesDc);
+
+  QString inputName = getSelectedCellArrayPath().getDataArrayName();
+  // A streamed filter pulls each piece through all the filters connected since the last kept output
+  bool connectedStagesStreamable = true;
+  for(size_t i = 0; i < m_Stages.size(); i++)
+  {
+    ITKImageProcessingBase::Pointer stage = m_Stages[i];
+    const bool kept = isStageKept(i);
+    const bool streamed = stage->getStreamSubdivisions() > 1 || stage->getStreamMemoryBudget() > 0;
+    if(streamed && stage->isStreamable() && !connectedStagesStreamable)
+    {
+      QString ss = QObject::tr("Filter %1 of the chain (%2) is streamed but a previous filter it is connected to can not be streamed. Keep the output of that filter or set "
+                               "Stream Subdivisions to 1 and Stream Memory Budget to 0")
+                       .arg(i + 1)
+                       .arg(stage->getHumanLabel());
+      setErrorCondition(-55587, ss);
+      return;
+    }
+    connectedStagesStreamable = kept || (connectedStagesStreamable && stage->isStreamable());
+    QString outputName = QString("_ITKFilterChain_%1_%2").arg(getNewCellArrayName()).arg(i + 1);
+    if(i + 1 == m_Stages.size())
+    {
+      outputName = getNewCellArrayName();
+    }
+    else if(kept)
+    {
+      outputName = stage->getNewCellArrayName();
+    }
+
+    if(kept && am->doesAttributeArrayExist(outputName))
+    {
+      QString ss = QObject::tr("The output array '%1' of filter %2 of the chain already exists").arg(outputName).arg(i + 1);
+      setErrorCondition(-55586, ss);
+      return;
+    }
+
+    stage->setDataContainerArray(stagesDca);
+    stage->setSelectedCellArrayPath(DataArrayPath(dc->getName(), am->getName(), inputName));
+    stage->setNewCellArrayName(outputName);
+    stage->setSaveAsNewArray(true);
+    // The images are connected from one filter to the next one, which only works on whole images
+    stage->setRegionOfInterestMode(0);
+    stage->preflight();
+    if(stage->getErrorCode() < 0)
+    {
+      QString ss = QObject::tr("Filter %1 of the chain (%2) reported an error").arg(i + 1).arg(stage->getHumanLabel());
+      setErrorCondition(stage->getErrorCode(), ss);
+      return;
+    }
+    if(stage->getWarningCode() < 0)
+    {
+      QString ss = QObject::tr("Filter %1 of the chain (%2) reported a warning").arg(i + 1).arg(stage->getHumanLabel());
+      setWarningCondition(stage->getWarningCode(), ss);
+    }
+
+    // Only the kept outputs are created in the data structure
+    if(kept)
+    {
+      IDataArray::Pointer placeholder = stagesAm->getAttributeArray(outputName);
+      IDataArray::Pointer outputArray = placeholder->createNewArray(am->getNumberOfTuples(), placeholder->getComponentDimensions(), outputName, !getInPreflight());
+      am->addOrReplaceAttributeArray(outputArray);
+      stagesAm->addOrReplaceAttributeArray(outputArray);
+    }
+    inputName = outputName;
+  }
+
+  m_StagesDataContainerArray = stagesDca;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKFilterChain::execute()
+{
+  initialize();
+  dataCheck();
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+
+  ITKExecutionPolicy::Apply();
+  ITKFilterTelemetry telemetry(this);
+  telemetry.setNumberOfVoxels(getDataContainerArray()->getAttributeMatrix(getSelectedCellArrayPath())->getNumberOfTuples());
+
+  ITKImageBase::PipelineConnection connection;
+  connection.Container = getDataContainerArray()->getDataContainer(getSelectedCellArrayPath().getDataContainerName());
+
+  for(size_t i = 0; i < m_Stages.size(); i++)
+  {
+    if(getCancel())
+    {
+      return;
+    }
+    ITKImageProcessingBase::Pointer stage = m_Stages[i];
+    notifyStatusMessage(QObject::tr("Filter %1 of %2: %3").arg(i + 1).arg(m_Stages.size()).arg(stage->getHumanLabel()));
+
+    // Intermediate filters are only connected, the pipeline is updated when a kept output is reached
+    connection.WriteOutput = isStageKept(i);
+    connection.Output = nullptr;
+    {
+      ITKFilterTelemetry::ScopedPhase phase(&telemetry, QString("%1 %2").arg(i + 1).arg(stage->getNameOfClass()));
+      stage->executeInPipeline(connection);
+    }
+    if(stage->getErrorCode() < 0)
+    {
+      QString ss = QObject::tr("Filter %1 of the chain (%2) reported an error").arg(i + 1).arg(stage->getHumanLabel());
+      setErrorCondition(stage->getErrorCode(), ss);
+      return;
+    }
+
+    if(connection.WriteOutput)
+    {
+      // The next filter reads the array that was just written
+      connection.Input = nullptr;
+      connection.Filters.clear();
+    }
+    else
+    {
+      connection.Input = connection.Output;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AbstractFilter::Pointer ITKFilterChain::newFilterInstance(bool copyFilterParameters) const
+{
+  ITKFilterChain::Pointer filter = ITKFilterChain::New();
+  if(copyFilterParameters)
+  {
+    copyFilterParameterInstanceVariables(filter.get());
+  }
+  return filter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ITKFilterChain::getCompiledLibraryName() const
+{
+  return ITKImageProcessingConstants::ITKImageProcessingBaseName;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ITKFilterChain::getBrandingString() const
+{
+  return ITKImageProcessingConstants::ITKImageProcessingBaseName;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ITKFilterChain::getFilterVersion() const
+{
+  QString version;
+  QTextStream vStream(&version);
+  vStream << ITKImageProcessing::Version::Major() << "." << ITKImageProcessing::Version::Minor() << "." << ITKImageProcessing::Version::Patch();
+  return version;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ITKFilterChain::getGroupName() const
+{
+  return "ITK Image Processing";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ITKFilterChain::getHumanLabel() const
+{
+  return "ITK::Filter Chain";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QUuid ITKFilterChain::getUuid() const
+{
+  return QUuid("{7c056ce2-392d-4de5-8982-ddf44847aefb}");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ITKFilterChain::getSubGroupName() const
+{
+  return "ITK Pipeline";
+}
+
+// -----------------------------------------------------------------------------
+ITKFilterChain::Pointer ITKFilterChain::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+std::shared_ptr<ITKFilterChain> ITKFilterChain::New()
+{
+  struct make_shared_enabler : public ITKFilterChain
+  {
+  };
+  std::shared_ptr<make_shared_enabler> val = std::make_shared<make_shared_enabler>();
+  val->setupFilterParameters();
+  return val;
+}
+
+// -----------------------------------------------------------------------------
+QString ITKFilterChain::getNameOfClass() const
+{
+  return QString("ITKFilterChain");
+}
+
+// -----------------------------------------------------------------------------
+QString ITKFilterChain::ClassName()
+{
+  return QString("ITKFilterChain");
+}
+
+// -----------------------------------------------------------------------------
+void ITKFilterChain::setPipelineFile(const QString& value)
+{
+  m_PipelineFile = value;
+}
+
+// -----------------------------------------------------------------------------
+QString ITKFilterChain::getPipelineFile() const
+{
+  return m_PipelineFile;
+}
+
+// -----------------------------------------------------------------------------
+void ITKFilterChain::setKeptStages(const QString& value)
+{
+  m_KeptStages = value;
+}
+
+// -----------------------------------------------------------------------------
+QString ITKFilterChain::getKeptStages() const
+{
+  return m_KeptStages;
+}
+
+// -----------------------------------------------------------------------------
+void ITKFilterChain::setSelectedCellArrayPath(const DataArrayPath& value)
+{
+  m_SelectedCellArrayPath = value;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayPath ITKFilterChain::getSelectedCellArrayPath() const
+{
+  return m_SelectedCellArrayPath;
+}
+
+// -----------------------------------------------------------------------------
+void ITKFilterChain::setNewCellArrayName(const QString& value)
+{
+  m_NewCellArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString ITKFilterChain::getNewCellArrayName() const
+{
+  return m_NewCellArrayName;
+}
@@ -0,0 +1,203 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataContainers/DataArrayPath.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKImageProcessingBase.h"
+
+#include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
+
+/**
+ * @brief The ITKFilterChain class runs a list of ITK image processing filters, read from a pipeline file,
+ * as one ITK pipeline: the output image of each filter is connected to the input of the next one instead of
+ * being copied into a DREAM.3D array. Only the output of the last filter, and of the filters listed in
+ * KeptStages, are stored in the data structure. See [Filter documentation](@ref ITKFilterChain) for details.
+ */
+class ITKImageProcessing_EXPORT ITKFilterChain : public AbstractFilter
+{
+  Q_OBJECT
+
+  // Start Python bindings declarations
+  PYB11_BEGIN_BINDINGS(ITKFilterChain SUPERCLASS AbstractFilter)
+  PYB11_FILTER()
+  PYB11_SHARED_POINTERS(ITKFilterChain)
+  PYB11_FILTER_NEW_MACRO(ITKFilterChain)
+  PYB11_PROPERTY(QString PipelineFile READ getPipelineFile WRITE setPipelineFile)
+  PYB11_PROPERTY(QString KeptStages READ getKeptStages WRITE setKeptStages)
+  PYB11_PROPERTY(DataArrayPath SelectedCellArrayPath READ getSelectedCellArrayPath WRITE setSelectedCellArrayPath)
+  PYB11_PROPERTY(QString NewCellArrayName READ getNewCellArrayName WRITE setNewCellArrayName)
+  PYB11_END_BINDINGS()
+  // End Python bindings declarations
+
+public:
+  using Self = ITKFilterChain;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  static std::shared_ptr<ITKFilterChain> New();
+
+  /**
+   * @brief Returns the name of the class for ITKFilterChain
+   */
+  QString getNameOfClass() const override;
+  /**
+   * @brief Returns the name of the class for ITKFilterChain
+   */
+  static QString ClassName();
+
+  ~ITKFilterChain() override;
+
+  /**
+   * @brief Setter property for PipelineFile
+   */
+  void setPipelineFile(const QString& value);
+  /**
+   * @brief Getter property for PipelineFile
+   * @return Value of PipelineFile
+   */
+  QString getPipelineFile() const;
+  Q_PROPERTY(QString PipelineFile READ getPipelineFile WRITE setPipelineFile)
+
+  /**
+   * @brief Setter property for KeptStages
+   */
+  void setKeptStages(const QString& value);
+  /**
+   * @brief Getter property for KeptStages
+   * @return Value of KeptStages
+   */
+  QString getKeptStages() const;
+  Q_PROPERTY(QString KeptStages READ getKeptStages WRITE setKeptStages)
+
+  /**
+   * @brief Setter property for SelectedCellArrayPath
+   */
+  void setSelectedCellArrayPath(const DataArrayPath& value);
+  /**
+   * @brief Getter property for SelectedCellArrayPath
+   * @return Value of SelectedCellArrayPath
+   */
+  DataArrayPath getSelectedCellArrayPath() const;
+  Q_PROPERTY(DataArrayPath SelectedCellArrayPath READ getSelectedCellArrayPath WRITE setSelectedCellArrayPath)
+
+  /**
+   * @brief Setter property for NewCellArrayName
+   */
+  void setNewCellArrayName(const QString& value);
+  /**
+   * @brief Getter property for NewCellArrayName
+   * @return Value of NewCellArrayName
+   */
+  QString getNewCellArrayName() const;
+  Q_PROPERTY(QString NewCellArrayName READ getNewCellArrayName WRITE setNewCellArrayName)
+
+  /**
+   * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
+   */
+  QString getCompiledLibraryName() const override;
+
+  /**
+   * @brief getBrandingString Returns the branding string for the filter, which is a tag
+   * used to denote the filter's association with specific plugins
+   * @return Branding string
+   */
+  QString getBrandingString() const override;
+
+  /**
+   * @brief getFilterVersion Returns a version string for this filter. Default
+   * value is an empty string.
+   * @return
+   */
+  QString getFilterVersion() const override;
+
+  /**
+   * @brief newFilterInstance Reimplemented from @see AbstractFilter class
+   */
+  AbstractFilter::Pointer newFilterInstance(bool copyFilterParameters) const override;
+
+  /**
+   * @brief getGroupName Reimplemented from @see AbstractFilter class
+   */
+  QString getGroupName() const override;
+
+  /**
+   * @brief getSubGroupName Reimplemented from @see AbstractFilter class
+   */
+  QString getSubGroupName() const override;
+
+  /**
+   * @brief getUuid Return the unique identifier for this filter.
+   * @return A QUuid object.
+   */
+  QUuid getUuid() const override;
+
+  /**
+   * @brief getHumanLabel Reimplemented from @see AbstractFilter class
+   */
+  QString getHumanLabel() const override;
+
+  /**
+   * @brief setupFilterParameters Reimplemented from @see AbstractFilter class
+   */
+  void setupFilterParameters() override;
+
+  /**
+   * @brief readFilterParameters Reimplemented from @see AbstractFilter class
+   */
+  void readFilterParameters(AbstractFilterParametersReader* reader, int index) override;
+
+  /**
+   * @brief execute Reimplemented from @see AbstractFilter class
+   */
+  void execute() override;
+
+protected:
+  ITKFilterChain();
+
+  /**
+   * @brief dataCheck Checks for the appropriate parameter values and availability of arrays
+   */
+  void dataCheck() override;
+
+  /**
+   * @brief Initializes all the private instance variables.
+   */
+  void initialize();
+
+  /**
+   * @brief readStages Reads the filters of the pipeline file. Every filter must be an ITK image processing filter.
+   */
+  void readStages();
+
+  /**
+   * @brief isStageKept Returns true if the output of the stage at 'index' (0 based) is stored in the data structure
+   */
+  bool isStageKept(size_t index) const;
+
+private:
+  QString m_PipelineFile = {};
+  QString m_KeptStages = {};
+  DataArrayPath m_SelectedCellArrayPath = {};
+  QString m_NewCellArrayName = {};
+
+  std::vector<ITKImageProcessingBase::Pointer> m_Stages;
+  DataContainerArray::Pointer m_StagesDataContainerArray;
+
+public:
+  ITKFilterChain(const ITKFilterChain&) = delete;            // Copy Constructor Not Implemented
+  ITKFilterChain(ITKFilterChain&&) = delete;                 // Move Constructor Not Implemented
+  ITKFilterChain& operator=(const ITKFilterChain&) = delete; // Copy Assignment Not Implemented
+  ITKFilterChain& operator=(ITKFilterChain&&) = delete;      // Move Assignment Not Implemented
+};
@@ -40,6 +40,7 @@ class ITKImageProcessing_EXPORT ITKGradientAnisotropicDiffusionImage : public IT
   PYB11_PROPERTY(double ConductanceParameter READ getConductanceParameter WRITE setConductanceParameter)
   PYB11_PROPERTY(double ConductanceScalingUpdateInterval READ getConductanceScalingUpdateInterval WRITE setConductanceScalingUpdateInterval)
   PYB11_PROPERTY(double NumberOfIterations READ getNumberOfIterations WRITE setNumberOfIterations)
+  PYB11_PROPERTY(bool SinglePrecisionIntermediate READ getSinglePrecisionIntermediate WRITE setSinglePrecisionIntermediate)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -108,6 +109,17 @@ public:
   double getNumberOfIterations() const;
   Q_PROPERTY(double NumberOfIterations READ getNumberOfIterations WRITE setNumberOfIterations)
 
+  /**
+   * @brief Setter property for SinglePrecisionIntermediate
+   */
+  void setSinglePrecisionIntermediate(bool value);
+  /**
+   * @brief Getter property for SinglePrecisionIntermediate
+   * @return Value of SinglePrecisionIntermediate
+   */
+  bool getSinglePrecisionIntermediate() const;
+  Q_PROPERTY(bool SinglePrecisionIntermediate READ getSinglePrecisionIntermediate WRITE setSinglePrecisionIntermediate)
+
   /**
    * @brief newFilterInstance Reimplemented from @see AbstractFilter class
    */
@@ -164,6 +176,27 @@ protected:
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
 
+  /**
+   * @brief Applies the filter with FloatPixelType as the intermediate pixel type
+   */
+  template <typename InputImageType, typename OutputImageType, unsigned int Dimension, typename FloatPixelType>
+  void filterWithIntermediate();
+
+  /**
+   * @brief getIntermediatePixelSize Reimplemented from @see ITKImageProcessingBase class
+   */
+  size_t getIntermediatePixelSize() const override;
+
+  /**
+   * @brief getWorkingMemoryPerPixel Reimplemented from @see ITKImageProcessingBase class
+   */
+  double getWorkingMemoryPerPixel(size_t inputPixelSize, size_t outputPixelSize, unsigned int dimension) const override;
+
+  /**
+   * @brief getRelativeCost Reimplemented from @see ITKImageProcessingBase class
+   */
+  double getRelativeCost(unsigned int dimension) const override;
+
 public:
   ITKGradientAnisotropicDiffusionImage(const ITKGradientAnisotropicDiffusionImage&) = delete;            // Copy Constructor Not Implemented
   ITKGradientAnisotropicDiffusionImage(ITKGradientAnisotropicDiffusionImage&&) = delete;                 // Move Constructor Not Implemented
@@ -175,6 +208,7 @@ private:
   double m_ConductanceParameter = {};
   double m_ConductanceScalingUpdateInterval = {};
   double m_NumberOfIterations = {};
+  bool m_SinglePrecisionIntermediate = false;
 };
 
 #ifdef __clang__
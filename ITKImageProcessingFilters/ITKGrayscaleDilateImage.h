@@ -140,6 +140,11 @@ protected:
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageProcessingBase class
+   */
+  bool isStreamable() const override;
+
 public:
   ITKGrayscaleDilateImage(const ITKGrayscaleDilateImage&) = delete;            // Copy Constructor Not Implemented
   ITKGrayscaleDilateImage(ITKGrayscaleDilateImage&&) = delete;                 // Move Constructor Not Implemented
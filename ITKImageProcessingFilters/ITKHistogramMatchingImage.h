@@ -183,6 +183,11 @@ protected:
    */
   void CompareImagePixelTypes(const DataArrayPath& path1, const DataArrayPath& path2);
 
+  /**
+   * @brief hasAdditionalInputs Reimplemented from @see ITKImageProcessingBase class
+   */
+  bool hasAdditionalInputs() const override;
+
 public:
   ITKHistogramMatchingImage(const ITKHistogramMatchingImage&) = delete;            // Copy Constructor Not Implemented
   ITKHistogramMatchingImage(ITKHistogramMatchingImage&&) = delete;                 // Move Constructor Not Implemented
@@ -25,6 +25,8 @@ void ITKImageBase::initialize()
   clearErrorCode();
   clearWarningCode();
   setCancel(false);
+  m_EstimatedPeakMemory = 0;
+  m_EstimatedRelativeCost = 0.0;
 }
 
 // -----------------------------------------------------------------------------
@@ -42,7 +44,111 @@ void ITKImageBase::execute()
   {
     return;
   }
+  ITKExecutionPolicy::Apply();
+  if(m_EstimatedPeakMemory > 0)
+  {
+    notifyStatusMessage(QObject::tr("Estimated peak memory: %1 MB, relative cost: %2").arg(m_EstimatedPeakMemory / (1024 * 1024)).arg(m_EstimatedRelativeCost));
+  }
+  ITKFilterTelemetry telemetry(this);
+  m_Telemetry = &telemetry;
   this->filterInternal();
+  m_Telemetry = nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKImageBase::executeInPipeline(PipelineConnection& connection)
+{
+  m_PipelineConnection = &connection;
+  this->filterInternal();
+  m_PipelineConnection = nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKImageBase::addAllocatedBytes(size_t bytes)
+{
+  if(nullptr != m_Telemetry)
+  {
+    m_Telemetry->addAllocatedBytes(bytes);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKImageBase::addOutputArrayBytes(const DataContainer::Pointer& dc, const DataArrayPath& outputArrayPath)
+{
+  if(nullptr == m_Telemetry)
+  {
+    return;
+  }
+  AttributeMatrix::Pointer am = dc->getAttributeMatrix(outputArrayPath.getAttributeMatrixName());
+  IDataArray::Pointer outputArray = (nullptr == am) ? IDataArray::NullPointer() : am->getAttributeArray(outputArrayPath.getDataArrayName());
+  if(nullptr != outputArray)
+  {
+    m_Telemetry->addAllocatedBytes(outputArray->getSize() * outputArray->getTypeSize());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKImageBase::checkResourceEstimate(double peakMemory, double relativeCost)
+{
+  m_EstimatedPeakMemory = static_cast<size_t>(peakMemory);
+  m_EstimatedRelativeCost = relativeCost;
+  const size_t budget = (m_MemoryBudget > 0) ? static_cast<size_t>(m_MemoryBudget) * 1024 * 1024 : ITKExecutionPolicy::GetMemoryBudgetInBytes();
+  if(budget == 0 || m_EstimatedPeakMemory <= budget)
+  {
+    return;
+  }
+  QString ss = QObject::tr("The filter is estimated to need %1 MB of memory, more than the memory budget of %2 MB (see %3)")
+                   .arg(m_EstimatedPeakMemory / (1024 * 1024))
+                   .arg(budget / (1024 * 1024))
+                   .arg((m_MemoryBudget > 0) ? QString("Memory Budget (MB)") : QString("ITKIMAGEPROCESSING_MEMORY_BUDGET"));
+  if(ITKExecutionPolicy::GetRefuseOverBudget())
+  {
+    setErrorCondition(-55570, ss);
+  }
+  else
+  {
+    setWarningCondition(-55571, ss);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKImageBase::applyExecutionPolicy(itk::ProcessObject* filter) const
+{
+  ITKExecutionPolicy::ApplyToFilter(filter, m_MaximumNumberOfThreads, m_NumberOfWorkUnits);
+}
+
+// -----------------------------------------------------------------------------
+size_t ITKImageBase::getEstimatedPeakMemory() const
+{
+  return m_EstimatedPeakMemory;
+}
+
+// -----------------------------------------------------------------------------
+double ITKImageBase::getEstimatedRelativeCost() const
+{
+  return m_EstimatedRelativeCost;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainer::Pointer ITKImageBase::getOutputDataContainer(const DataArrayPath& selectedArray) const
+{
+  if(nullptr != m_PipelineConnection && nullptr != m_PipelineConnection->Container)
+  {
+    return m_PipelineConnection->Container;
+  }
+  return getDataContainerArray()->getDataContainer(selectedArray.getDataContainerName());
 }
 
 // -----------------------------------------------------------------------------
@@ -62,3 +168,39 @@ QString ITKImageBase::ClassName()
 {
   return QString("ITKImageBase");
 }
+
+// -----------------------------------------------------------------------------
+void ITKImageBase::setMaximumNumberOfThreads(int value)
+{
+  m_MaximumNumberOfThreads = value;
+}
+
+// -----------------------------------------------------------------------------
+int ITKImageBase::getMaximumNumberOfThreads() const
+{
+  return m_MaximumNumberOfThreads;
+}
+
+// -----------------------------------------------------------------------------
+void ITKImageBase::setNumberOfWorkUnits(int value)
+{
+  m_NumberOfWorkUnits = value;
+}
+
+// -----------------------------------------------------------------------------
+int ITKImageBase::getNumberOfWorkUnits() const
+{
+  return m_NumberOfWorkUnits;
+}
+
+// -----------------------------------------------------------------------------
+void ITKImageBase::setMemoryBudget(int value)
+{
+  m_MemoryBudget = value;
+}
+
+// -----------------------------------------------------------------------------
+int ITKImageBase::getMemoryBudget() const
+{
+  return m_MemoryBudget;
+}
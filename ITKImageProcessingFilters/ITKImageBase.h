@@ -4,7 +4,11 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <memory>
+#include <type_traits>
+#include <vector>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
@@ -14,9 +18,14 @@
 #include "SIMPLib/ITK/itkInPlaceImageToDream3DDataFilter.h"
 
 #include <itkCastImageFilter.h>
+#include <itkImageAlgorithm.h>
+#include <itkImageRegionSplitterSlowDimension.h>
 #include <itkNumericTraits.h>
 #include "itkImageToImageFilter.h"
 
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/ITKExecutionPolicy.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/ITKFilterTelemetry.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/ITKUnaryKernels.h"
 #include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
 
 // There is a known overflow for the templates but the code seems to work correctly so disable the warning
@@ -34,6 +43,9 @@ class ITKImageProcessing_EXPORT ITKImageBase : public AbstractFilter
   // Start Python bindings declarations
   PYB11_BEGIN_BINDINGS(ITKImageBase SUPERCLASS AbstractFilter)
   PYB11_SHARED_POINTERS(ITKImageBase)
+  PYB11_PROPERTY(int MaximumNumberOfThreads READ getMaximumNumberOfThreads WRITE setMaximumNumberOfThreads)
+  PYB11_PROPERTY(int NumberOfWorkUnits READ getNumberOfWorkUnits WRITE setNumberOfWorkUnits)
+  PYB11_PROPERTY(int MemoryBudget READ getMemoryBudget WRITE setMemoryBudget)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -61,6 +73,85 @@ public:
    */
   void execute() override;
 
+  /**
+   * @brief The PipelineConnection struct lets a filter run as one stage of a longer ITK pipeline (see
+   * ITKFilterChain). The stage reads 'Input' instead of its selected array when it is set. Unless
+   * 'WriteOutput' is set, the stage is only connected: nothing is updated and its output image is returned
+   * in 'Output'. Otherwise the whole pipeline is updated and the result written in the output array of
+   * 'Container'. 'Filters' keeps the ITK filters of the connected stages alive.
+   */
+  struct PipelineConnection
+  {
+    DataContainer::Pointer Container;
+    itk::DataObject::Pointer Input;
+    bool WriteOutput = false;
+    itk::DataObject::Pointer Output;
+    std::vector<itk::ProcessObject::Pointer> Filters;
+  };
+
+  /**
+   * @brief The OutputRegion struct is the box of the image (index and size in pixels, x y z) a filter computes
+   * when 'Enabled' is set. Outside of the box, the output array is set to 'FillValue' unless it is the input array.
+   */
+  struct OutputRegion
+  {
+    bool Enabled = false;
+    std::array<size_t, 3> Index = {{0, 0, 0}};
+    std::array<size_t, 3> Size = {{0, 0, 0}};
+    double FillValue = 0.0;
+  };
+
+  /**
+   * @brief executeInPipeline Runs this filter as a stage of 'connection'. dataCheck must have been run
+   * beforehand, the selected and created arrays of this filter only drive the pixel type dispatch.
+   */
+  void executeInPipeline(PipelineConnection& connection);
+
+  /**
+   * @brief Setter property for MaximumNumberOfThreads (0 means the limit of ITKExecutionPolicy)
+   */
+  void setMaximumNumberOfThreads(int value);
+  /**
+   * @brief Getter property for MaximumNumberOfThreads
+   * @return Value of MaximumNumberOfThreads
+   */
+  int getMaximumNumberOfThreads() const;
+  Q_PROPERTY(int MaximumNumberOfThreads READ getMaximumNumberOfThreads WRITE setMaximumNumberOfThreads)
+
+  /**
+   * @brief Setter property for NumberOfWorkUnits (0 means the work units of ITKExecutionPolicy)
+   */
+  void setNumberOfWorkUnits(int value);
+  /**
+   * @brief Getter property for NumberOfWorkUnits
+   * @return Value of NumberOfWorkUnits
+   */
+  int getNumberOfWorkUnits() const;
+  Q_PROPERTY(int NumberOfWorkUnits READ getNumberOfWorkUnits WRITE setNumberOfWorkUnits)
+
+  /**
+   * @brief Setter property for MemoryBudget in MB (0 means the memory budget of ITKExecutionPolicy)
+   */
+  void setMemoryBudget(int value);
+  /**
+   * @brief Getter property for MemoryBudget
+   * @return Value of MemoryBudget
+   */
+  int getMemoryBudget() const;
+  Q_PROPERTY(int MemoryBudget READ getMemoryBudget WRITE setMemoryBudget)
+
+  /**
+   * @brief getEstimatedPeakMemory Returns the peak memory (in bytes) the filter was estimated to need during
+   * the last dataCheck, 0 if the filter does not estimate it
+   */
+  size_t getEstimatedPeakMemory() const;
+
+  /**
+   * @brief getEstimatedRelativeCost Returns the computation cost estimated during the last dataCheck, relative
+   * to a pixel-wise filter applied to the same image
+   */
+  double getEstimatedRelativeCost() const;
+
   /**
    * @brief CastVec3ToITK Input type should be FloatVec3Type or IntVec3Type, Output
      type should be some kind of ITK "array" (itk::Size, itk::Index,...)
@@ -147,36 +238,351 @@ protected:
     }
   }
 
+  /**
+   * @brief getOutputArray Returns the existing output array if it can hold 'numberOfPixels' pixels of
+   * type OutputPixelType, nullptr otherwise.
+   */
+  template <typename OutputPixelType>
+  typename DataArray<typename itk::NumericTraits<OutputPixelType>::ValueType>::Pointer getOutputArray(const DataContainer::Pointer& dc, const DataArrayPath& outputArrayPath, size_t numberOfPixels)
+  {
+    using ValueType = typename itk::NumericTraits<OutputPixelType>::ValueType;
+    AttributeMatrix::Pointer am = dc->getAttributeMatrix(outputArrayPath.getAttributeMatrixName());
+    if(nullptr == am)
+    {
+      return nullptr;
+    }
+    typename DataArray<ValueType>::Pointer outputArray = std::dynamic_pointer_cast<DataArray<ValueType>>(am->getAttributeArray(outputArrayPath.getDataArrayName()));
+    if(nullptr == outputArray || numberOfPixels == 0 || outputArray->getSize() * sizeof(ValueType) != numberOfPixels * sizeof(OutputPixelType))
+    {
+      return nullptr;
+    }
+    return outputArray;
+  }
+
+  /**
+   * @brief wrapOutputArray Creates an image with the same information as 'reference' that uses the memory
+   * of 'outputArray' as its buffer. The image does not take ownership of the memory.
+   */
+  template <typename OutputImageType, typename ArrayType>
+  typename OutputImageType::Pointer wrapOutputArray(ArrayType* outputArray, const OutputImageType* reference)
+  {
+    using OutputPixelType = typename OutputImageType::PixelType;
+    const typename OutputImageType::RegionType largestRegion = reference->GetLargestPossibleRegion();
+    typename OutputImageType::Pointer outputImage = OutputImageType::New();
+    outputImage->CopyInformation(reference);
+    outputImage->SetRegions(largestRegion);
+    outputImage->GetPixelContainer()->SetImportPointer(reinterpret_cast<OutputPixelType*>(outputArray->getPointer(0)), largestRegion.GetNumberOfPixels(), false);
+    return outputImage;
+  }
+
+  /**
+   * @brief updateIntoOutputArray Grafts the already allocated output array onto the output of 'source' and
+   * updates the pipeline, so the filter writes its result directly in the DREAM.3D array instead of allocating
+   * a second full size buffer. Returns false if the output array cannot be used or if the filter replaced the
+   * grafted buffer (in place filters, internal mini-pipelines), in which case the result has to be transferred
+   * with InPlaceImageToDream3DDataFilter as usual.
+   */
+  template <typename OutputPixelType, unsigned int Dimension, typename SourceType>
+  bool updateIntoOutputArray(SourceType* source, const DataContainer::Pointer& dc, const DataArrayPath& outputArrayPath)
+  {
+    using OutputImageType = itk::Image<OutputPixelType, Dimension>;
+    source->UpdateOutputInformation();
+    auto outputArray = getOutputArray<OutputPixelType>(dc, outputArrayPath, source->GetOutput()->GetLargestPossibleRegion().GetNumberOfPixels());
+    if(nullptr == outputArray)
+    {
+      return false;
+    }
+    typename OutputImageType::Pointer outputImage = wrapOutputArray(outputArray.get(), source->GetOutput());
+    source->GraftOutput(outputImage);
+    // Otherwise the pipeline would release the grafted buffer before allocating the output
+    source->SetReleaseDataBeforeUpdateFlag(false);
+    source->Update();
+    return source->GetOutput()->GetBufferPointer() == reinterpret_cast<OutputPixelType*>(outputArray->getPointer(0));
+  }
+
+  /**
+   * @brief streamRegion Updates 'region' of the output of 'source' in 'numberOfPieces' pieces and copies every
+   * piece into 'outputImage'. Each filter enlarges its input requested region as needed (kernel radius,
+   * padding) while the pipeline propagates.
+   */
+  template <typename OutputImageType, typename SourceType>
+  void streamRegion(SourceType* source, OutputImageType* outputImage, const typename OutputImageType::RegionType& region, unsigned int numberOfPieces)
+  {
+    itk::ImageRegionSplitterSlowDimension::Pointer splitter = itk::ImageRegionSplitterSlowDimension::New();
+    numberOfPieces = splitter->GetNumberOfSplits(region, std::max(numberOfPieces, 1u));
+    for(unsigned int piece = 0; piece < numberOfPieces; piece++)
+    {
+      if(getCancel())
+      {
+        return;
+      }
+      if(numberOfPieces > 1)
+      {
+        notifyStatusMessage(QString("Streaming piece %1 of %2").arg(piece + 1).arg(numberOfPieces));
+      }
+      typename OutputImageType::RegionType streamRegion = region;
+      splitter->GetSplit(piece, numberOfPieces, streamRegion);
+
+      OutputImageType* output = source->GetOutput();
+      output->SetRequestedRegion(streamRegion);
+      output->PropagateRequestedRegion();
+      output->UpdateOutputData();
+
+      // Some filters always produce their largest possible region. No need to run them again.
+      if(output->GetBufferedRegion().IsInside(region))
+      {
+        itk::ImageAlgorithm::Copy(output, outputImage, region, region);
+        break;
+      }
+      itk::ImageAlgorithm::Copy(output, outputImage, streamRegion, streamRegion);
+    }
+  }
+
+  /**
+   * @brief streamOutput Updates the pipeline ending at 'source' one region at a time and copies every piece
+   * into the already allocated output array, so ITK never holds a full size output image (see streamRegion).
+   * Returns false if streaming was not requested or if the output image does not match the output array,
+   * in which case the caller has to update the whole pipeline itself.
+   */
+  template <typename OutputPixelType, unsigned int Dimension, typename SourceType>
+  bool streamOutput(SourceType* source, const DataContainer::Pointer& dc, const DataArrayPath& outputArrayPath, unsigned int numberOfStreamDivisions)
+  {
+    if(numberOfStreamDivisions <= 1)
+    {
+      return false;
+    }
+    using OutputImageType = itk::Image<OutputPixelType, Dimension>;
+    source->UpdateOutputInformation();
+    const typename OutputImageType::RegionType largestRegion = source->GetOutput()->GetLargestPossibleRegion();
+    auto outputArray = getOutputArray<OutputPixelType>(dc, outputArrayPath, largestRegion.GetNumberOfPixels());
+    if(nullptr == outputArray)
+    {
+      return false;
+    }
+    typename OutputImageType::Pointer outputImage = wrapOutputArray(outputArray.get(), source->GetOutput());
+    streamRegion(source, outputImage.GetPointer(), largestRegion, numberOfStreamDivisions);
+    return true;
+  }
+
+  /**
+   * @brief updateOutputRegion Computes only 'region' of the output of 'source' (see streamRegion) and writes it
+   * in the corresponding pixels of the output array, which is created if needed. The other pixels of the
+   * output array are set to the fill value of the region, unless the output array is the selected array.
+   */
+  template <typename OutputPixelType, unsigned int Dimension, typename SourceType>
+  void updateOutputRegion(SourceType* source, const DataContainer::Pointer& dc, const DataArrayPath& outputArrayPath, const DataArrayPath& selectedArray, unsigned int numberOfStreamDivisions,
+                          const OutputRegion& region)
+  {
+    using ValueType = typename itk::NumericTraits<OutputPixelType>::ValueType;
+    using OutputImageType = itk::Image<OutputPixelType, Dimension>;
+    source->UpdateOutputInformation();
+    const typename OutputImageType::RegionType largestRegion = source->GetOutput()->GetLargestPossibleRegion();
+    const size_t numberOfPixels = largestRegion.GetNumberOfPixels();
+    typename DataArray<ValueType>::Pointer outputArray = getOutputArray<OutputPixelType>(dc, outputArrayPath, numberOfPixels);
+    if(nullptr == outputArray)
+    {
+      // Temporary array, not created during preflight
+      AttributeMatrix::Pointer am = dc->getAttributeMatrix(outputArrayPath.getAttributeMatrixName());
+      outputArray = DataArray<ValueType>::CreateArray(numberOfPixels, ITKDream3DHelper::GetComponentsDimensions<OutputPixelType>(), outputArrayPath.getDataArrayName(), true);
+      am->insertOrAssign(outputArray);
+      addAllocatedBytes(numberOfPixels * sizeof(OutputPixelType));
+    }
+    if(!(outputArrayPath == selectedArray))
+    {
+      outputArray->initializeWithValue(static_cast<ValueType>(region.FillValue));
+    }
+
+    typename OutputImageType::RegionType requestedRegion;
+    for(unsigned int i = 0; i < Dimension; i++)
+    {
+      requestedRegion.SetIndex(i, largestRegion.GetIndex(i) + static_cast<itk::IndexValueType>(region.Index[i]));
+      requestedRegion.SetSize(i, region.Size[i]);
+    }
+    if(!requestedRegion.Crop(largestRegion))
+    {
+      return;
+    }
+    typename OutputImageType::Pointer outputImage = wrapOutputArray(outputArray.get(), source->GetOutput());
+    streamRegion(source, outputImage.GetPointer(), requestedRegion, numberOfStreamDivisions);
+  }
+
+  /**
+   * @brief getInputImage Returns the image the filter reads: the output of the previous stage when the
+   * filter runs as part of a pipeline (see PipelineConnection), otherwise the selected DREAM.3D array
+   * wrapped without copy. Returns nullptr if the previous stage does not produce the expected image type.
+   */
+  template <typename InputPixelType, unsigned int Dimension>
+  typename itk::Image<InputPixelType, Dimension>::Pointer getInputImage(const DataContainer::Pointer& dc, const DataArrayPath& selectedArray,
+                                                                        std::vector<itk::ProcessObject::Pointer>& bridges)
+  {
+    using InputImageType = itk::Image<InputPixelType, Dimension>;
+    if(nullptr != m_PipelineConnection && nullptr != m_PipelineConnection->Input)
+    {
+      typename InputImageType::Pointer input = dynamic_cast<InputImageType*>(m_PipelineConnection->Input.GetPointer());
+      if(nullptr == input)
+      {
+        setErrorCondition(-55557, "The output of the previous filter of the pipeline does not match the input type of this filter");
+      }
+      return input;
+    }
+    using toITKType = itk::InPlaceDream3DDataToImageFilter<InputPixelType, Dimension>;
+    // Create a Bridge to wrap an existing DREAM.3D array with an ItkImage container
+    typename toITKType::Pointer toITK = toITKType::New();
+    toITK->SetInput(dc);
+    toITK->SetInPlace(true);
+    toITK->SetAttributeMatrixArrayName(selectedArray.getAttributeMatrixName().toStdString());
+    toITK->SetDataArrayName(selectedArray.getDataArrayName().toStdString());
+    bridges.push_back(toITK.GetPointer());
+    {
+      ITKFilterTelemetry::ScopedPhase phase(m_Telemetry, "ToITK");
+      toITK->Update();
+    }
+    if(nullptr != m_Telemetry)
+    {
+      m_Telemetry->setNumberOfVoxels(toITK->GetOutput()->GetLargestPossibleRegion().GetNumberOfPixels());
+    }
+    return toITK->GetOutput();
+  }
+
+  /**
+   * @brief connectToPipeline Hands the output of 'source' to the next stage of the pipeline instead of
+   * updating it. Returns false if the filter is not run as an intermediate pipeline stage.
+   */
+  template <typename SourceType>
+  bool connectToPipeline(SourceType* source, const std::vector<itk::ProcessObject::Pointer>& filters)
+  {
+    if(nullptr == m_PipelineConnection || m_PipelineConnection->WriteOutput)
+    {
+      return false;
+    }
+    // Intermediate images are freed as soon as the next stage has consumed them
+    for(const auto& filter : filters)
+    {
+      filter->ReleaseDataFlagOn();
+    }
+    m_PipelineConnection->Filters.insert(m_PipelineConnection->Filters.end(), filters.begin(), filters.end());
+    m_PipelineConnection->Output = source->GetOutput();
+    return true;
+  }
+
+  /**
+   * @brief applyUnaryKernel Computes a pixel-wise operation (see ITKUnaryKernels) directly from the selected
+   * array into the output array, without going through ITK images. Only scalar arrays that are not part of a
+   * pipeline (see PipelineConnection) are handled. Returns false otherwise, in which case the caller has to
+   * run the equivalent ITK filter.
+   */
+  template <typename InputPixelType, typename OutputPixelType>
+  bool applyUnaryKernel(ITKUnaryKernels::Operation operation, double parameter, const std::string& outputArrayName, const DataArrayPath& selectedArray)
+  {
+    using IsScalar = std::integral_constant<bool, std::is_arithmetic<InputPixelType>::value && std::is_arithmetic<OutputPixelType>::value>;
+    return applyUnaryKernel<InputPixelType, OutputPixelType>(operation, parameter, outputArrayName, selectedArray, IsScalar());
+  }
+  template <typename InputPixelType, typename OutputPixelType>
+  bool applyUnaryKernel(ITKUnaryKernels::Operation /*unused*/, double /*unused*/, const std::string& /*unused*/, const DataArrayPath& /*unused*/, std::false_type /*unused*/)
+  {
+    return false;
+  }
+  template <typename InputPixelType, typename OutputPixelType>
+  bool applyUnaryKernel(ITKUnaryKernels::Operation operation, double parameter, const std::string& outputArrayName, const DataArrayPath& selectedArray, std::true_type /*unused*/)
+  {
+    if(nullptr != m_PipelineConnection)
+    {
+      return false;
+    }
+    DataContainer::Pointer dc = getOutputDataContainer(selectedArray);
+    AttributeMatrix::Pointer am = (nullptr == dc) ? nullptr : dc->getAttributeMatrix(selectedArray.getAttributeMatrixName());
+    if(nullptr == am)
+    {
+      return false;
+    }
+    typename DataArray<InputPixelType>::Pointer inputArray = std::dynamic_pointer_cast<DataArray<InputPixelType>>(am->getAttributeArray(selectedArray.getDataArrayName()));
+    if(nullptr == inputArray || inputArray->getNumberOfComponents() != 1)
+    {
+      return false;
+    }
+    const size_t numberOfPixels = inputArray->getNumberOfTuples();
+    const QString outputName = QString::fromStdString(outputArrayName);
+    DataArrayPath outputArrayPath(selectedArray.getDataContainerName(), selectedArray.getAttributeMatrixName(), outputName);
+    typename DataArray<OutputPixelType>::Pointer outputArray = getOutputArray<OutputPixelType>(dc, outputArrayPath, numberOfPixels);
+    if(nullptr != outputArray)
+    {
+      addOutputArrayBytes(dc, outputArrayPath);
+    }
+    else if(!am->doesAttributeArrayExist(outputName))
+    {
+      // Temporary array, not created during preflight
+      outputArray = DataArray<OutputPixelType>::CreateArray(numberOfPixels, std::vector<size_t>(1, 1), outputName, true);
+      am->insertOrAssign(outputArray);
+      addAllocatedBytes(numberOfPixels * sizeof(OutputPixelType));
+    }
+    else
+    {
+      return false;
+    }
+    if(nullptr != m_Telemetry)
+    {
+      m_Telemetry->setNumberOfVoxels(numberOfPixels);
+    }
+    ITKFilterTelemetry::ScopedPhase phase(m_Telemetry, "Update");
+    ITKUnaryKernels::Apply(operation, parameter, inputArray->getPointer(0), outputArray->getPointer(0), numberOfPixels);
+    return true;
+  }
+
   /**
    * @brief Applies the filter
    */
   template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension, typename FilterType>
-  void filter(FilterType* filter, const std::string& outputArrayName, const DataArrayPath& selectedArray)
+  void filter(FilterType* filter, const std::string& outputArrayName, const DataArrayPath& selectedArray, unsigned int numberOfStreamDivisions = 1, const OutputRegion& region = OutputRegion())
   {
     try
     {
-      DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(selectedArray.getDataContainerName());
+      DataContainer::Pointer dc = getOutputDataContainer(selectedArray);
 
       using OutputImageType = itk::Image<OutputPixelType, Dimension>;
-      using toITKType = itk::InPlaceDream3DDataToImageFilter<InputPixelType, Dimension>;
-      // Create a Bridge to wrap an existing DREAM.3D array with an ItkImage container
-      typename toITKType::Pointer toITK = toITKType::New();
-      toITK->SetInput(dc);
-      toITK->SetInPlace(true);
-      toITK->SetAttributeMatrixArrayName(selectedArray.getAttributeMatrixName().toStdString());
-      toITK->SetDataArrayName(selectedArray.getDataArrayName().toStdString());
+      std::vector<itk::ProcessObject::Pointer> filters;
+      typename itk::Image<InputPixelType, Dimension>::Pointer input = getInputImage<InputPixelType, Dimension>(dc, selectedArray, filters);
+      if(nullptr == input)
+      {
+        return;
+      }
 
       itk::Dream3DFilterInterruption::Pointer interruption = itk::Dream3DFilterInterruption::New();
       interruption->SetFilter(this);
 
       // Set up filter
-      filter->SetInput(toITK->GetOutput());
+      filter->SetInput(input);
       filter->AddObserver(itk::ProgressEvent(), interruption);
-      filter->Update();
+      applyExecutionPolicy(filter);
+      filters.push_back(filter);
+      if(connectToPipeline(filter, filters))
+      {
+        return;
+      }
+
+      DataArrayPath outputArrayPath(selectedArray.getDataContainerName(), selectedArray.getAttributeMatrixName(), QString::fromStdString(outputArrayName));
+      addOutputArrayBytes(dc, outputArrayPath);
+      {
+        ITKFilterTelemetry::ScopedPhase phase(m_Telemetry, "Update");
+        if(region.Enabled)
+        {
+          updateOutputRegion<OutputPixelType, Dimension>(filter, dc, outputArrayPath, selectedArray, numberOfStreamDivisions, region);
+          return;
+        }
+        if(streamOutput<OutputPixelType, Dimension>(filter, dc, outputArrayPath, numberOfStreamDivisions))
+        {
+          return;
+        }
+        if(updateIntoOutputArray<OutputPixelType, Dimension>(filter, dc, outputArrayPath))
+        {
+          return;
+        }
+        filter->Update();
+      }
 
       typename OutputImageType::Pointer image = OutputImageType::New();
       image = filter->GetOutput();
       image->DisconnectPipeline();
+      addAllocatedBytes(image->GetPixelContainer()->Size() * sizeof(OutputPixelType));
 
       using toDream3DType = itk::InPlaceImageToDream3DDataFilter<OutputPixelType, Dimension>;
       typename toDream3DType::Pointer toDream3DFilter = toDream3DType::New();
@@ -185,6 +591,7 @@ protected:
       toDream3DFilter->SetAttributeMatrixArrayName(selectedArray.getAttributeMatrixName().toStdString());
       toDream3DFilter->SetDataArrayName(outputArrayName);
       toDream3DFilter->SetDataContainer(dc);
+      ITKFilterTelemetry::ScopedPhase phase(m_Telemetry, "ToDream3D");
       toDream3DFilter->Update();
     } catch(itk::ExceptionObject& err)
     {
@@ -202,27 +609,28 @@ protected:
    */
 
   template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension, typename FilterType, typename FloatImageType>
-  void filterCastToFloat(FilterType* filter, const std::string& outputArrayName, const DataArrayPath& selectedArray)
+  void filterCastToFloat(FilterType* filter, const std::string& outputArrayName, const DataArrayPath& selectedArray, unsigned int numberOfStreamDivisions = 1, const OutputRegion& region = OutputRegion())
   {
     try
     {
-      DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(selectedArray.getDataContainerName());
+      DataContainer::Pointer dc = getOutputDataContainer(selectedArray);
 
-      using toITKType = itk::InPlaceDream3DDataToImageFilter<InputPixelType, Dimension>;
-      // Create a Bridge to wrap an existing DREAM.3D array with an ItkImage container
-      typename toITKType::Pointer toITK = toITKType::New();
-      toITK->SetInput(dc);
-      toITK->SetInPlace(true);
-      toITK->SetAttributeMatrixArrayName(selectedArray.getAttributeMatrixName().toStdString());
-      toITK->SetDataArrayName(selectedArray.getDataArrayName().toStdString());
+      using InputImageType = itk::Image<InputPixelType, Dimension>;
+      std::vector<itk::ProcessObject::Pointer> filters;
+      typename InputImageType::Pointer input = getInputImage<InputPixelType, Dimension>(dc, selectedArray, filters);
+      if(nullptr == input)
+      {
+        return;
+      }
 
       itk::Dream3DFilterInterruption::Pointer interruption = itk::Dream3DFilterInterruption::New();
       interruption->SetFilter(this);
 
-      using InputImageType = typename toITKType::ImageType;
       using CasterToType = itk::CastImageFilter<InputImageType, FloatImageType>;
       typename CasterToType::Pointer casterTo = CasterToType::New();
-      casterTo->SetInput(toITK->GetOutput());
+      casterTo->SetInput(input);
+      // The cast copy of the input is only needed while the filter runs
+      casterTo->ReleaseDataFlagOn();
 
       // Set up filter
       filter->SetInput(casterTo->GetOutput());
@@ -232,11 +640,46 @@ protected:
       using CasterFromType = itk::CastImageFilter<FloatImageType, OutputImageType>;
       typename CasterFromType::Pointer casterFrom = CasterFromType::New();
       casterFrom->SetInput(filter->GetOutput());
-      casterFrom->Update();
+      // When the intermediate type already is the output type, the filter output buffer is passed through
+      // instead of being copied. Otherwise the cast writes directly in the output array (see updateIntoOutputArray).
+      casterFrom->InPlaceOn();
+
+      filters.push_back(casterTo.GetPointer());
+      filters.push_back(filter);
+      filters.push_back(casterFrom.GetPointer());
+      for(const auto& stageFilter : filters)
+      {
+        applyExecutionPolicy(stageFilter.GetPointer());
+      }
+      if(connectToPipeline(casterFrom.GetPointer(), filters))
+      {
+        return;
+      }
+
+      DataArrayPath outputArrayPath(selectedArray.getDataContainerName(), selectedArray.getAttributeMatrixName(), QString::fromStdString(outputArrayName));
+      addOutputArrayBytes(dc, outputArrayPath);
+      {
+        ITKFilterTelemetry::ScopedPhase phase(m_Telemetry, "Update");
+        if(region.Enabled)
+        {
+          updateOutputRegion<OutputPixelType, Dimension>(casterFrom.GetPointer(), dc, outputArrayPath, selectedArray, numberOfStreamDivisions, region);
+          return;
+        }
+        if(streamOutput<OutputPixelType, Dimension>(casterFrom.GetPointer(), dc, outputArrayPath, numberOfStreamDivisions))
+        {
+          return;
+        }
+        if(updateIntoOutputArray<OutputPixelType, Dimension>(casterFrom.GetPointer(), dc, outputArrayPath))
+        {
+          return;
+        }
+        casterFrom->Update();
+      }
 
       typename OutputImageType::Pointer image = OutputImageType::New();
       image = casterFrom->GetOutput();
       image->DisconnectPipeline();
+      addAllocatedBytes(image->GetPixelContainer()->Size() * sizeof(OutputPixelType));
 
       using toDream3DType = itk::InPlaceImageToDream3DDataFilter<OutputPixelType, Dimension>;
       typename toDream3DType::Pointer toDream3DFilter = toDream3DType::New();
@@ -245,6 +688,7 @@ protected:
       toDream3DFilter->SetAttributeMatrixArrayName(selectedArray.getAttributeMatrixName().toStdString());
       toDream3DFilter->SetDataArrayName(outputArrayName);
       toDream3DFilter->SetDataContainer(dc);
+      ITKFilterTelemetry::ScopedPhase phase(m_Telemetry, "ToDream3D");
       toDream3DFilter->Update();
     } catch(itk::ExceptionObject& err)
     {
@@ -322,6 +766,34 @@ protected:
    */
   virtual void filterInternal() = 0;
 
+  /**
+   * @brief addAllocatedBytes Adds 'bytes' to the memory allocated by the current execution (see ITKFilterTelemetry)
+   */
+  void addAllocatedBytes(size_t bytes);
+
+  /**
+   * @brief addOutputArrayBytes Adds the size of the output array to the memory allocated by the current execution
+   */
+  void addOutputArrayBytes(const DataContainer::Pointer& dc, const DataArrayPath& outputArrayPath);
+
+  /**
+   * @brief checkResourceEstimate Stores the estimated peak memory (in bytes) and relative cost of the filter
+   * and compares the peak memory with the MemoryBudget of the filter, or the memory budget of ITKExecutionPolicy
+   * when it is 0. Over budget, a warning is set, or an error if the policy refuses such filters.
+   */
+  void checkResourceEstimate(double peakMemory, double relativeCost);
+
+  /**
+   * @brief applyExecutionPolicy Limits the threads and sets the work units of an ITK filter of this filter,
+   * from MaximumNumberOfThreads and NumberOfWorkUnits or from ITKExecutionPolicy when they are 0
+   */
+  void applyExecutionPolicy(itk::ProcessObject* filter) const;
+
+  /**
+   * @brief getOutputDataContainer Returns the data container the filter reads from and writes to
+   */
+  DataContainer::Pointer getOutputDataContainer(const DataArrayPath& selectedArray) const;
+
   /**
    * @brief Initializes all the private instance variables.
    */
@@ -334,4 +806,11 @@ public:
   ITKImageBase& operator=(ITKImageBase&&) = delete;      // Move Assignment Not Implemented
 
 private:
+  PipelineConnection* m_PipelineConnection = nullptr;
+  ITKFilterTelemetry* m_Telemetry = nullptr;
+  size_t m_EstimatedPeakMemory = 0;
+  double m_EstimatedRelativeCost = 0.0;
+  int m_MaximumNumberOfThreads = 0;
+  int m_NumberOfWorkUnits = 0;
+  int m_MemoryBudget = 0;
 };
@@ -1,10 +1,62 @@
 #include "ITKImageProcessingBase.h"
 
+#include <algorithm>
+#include <cmath>
+
+#include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/DoubleFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntVec3FilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedChoicesFilterParameter.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
 
 #include "ITKImageProcessing/ITKImageProcessingConstants.h"
 #include "ITKImageProcessing/ITKImageProcessingVersion.h"
 
+namespace
+{
+/**
+ * @brief FindMaskBoundingBox Computes the bounding box of the non zero values of 'mask' in an image of
+ * dimensions 'dims'. Returns false if the mask is empty.
+ */
+template <typename T>
+bool FindMaskBoundingBox(const DataArray<T>& mask, const SizeVec3Type& dims, std::array<size_t, 3>& index, std::array<size_t, 3>& size)
+{
+  std::array<size_t, 3> minimum = {{dims[0], dims[1], dims[2]}};
+  std::array<size_t, 3> maximum = {{0, 0, 0}};
+  bool found = false;
+  size_t pixel = 0;
+  for(size_t z = 0; z < dims[2]; z++)
+  {
+    for(size_t y = 0; y < dims[1]; y++)
+    {
+      for(size_t x = 0; x < dims[0]; x++, pixel++)
+      {
+        if(mask.getValue(pixel) == static_cast<T>(0))
+        {
+          continue;
+        }
+        const std::array<size_t, 3> position = {{x, y, z}};
+        for(size_t i = 0; i < 3; i++)
+        {
+          minimum[i] = std::min(minimum[i], position[i]);
+          maximum[i] = std::max(maximum[i], position[i]);
+        }
+        found = true;
+      }
+    }
+  }
+  for(size_t i = 0; i < 3; i++)
+  {
+    index[i] = minimum[i];
+    size[i] = found ? maximum[i] - minimum[i] + 1 : 0;
+  }
+  return found;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -22,6 +74,288 @@ void ITKImageProcessingBase::setupFilterParameters()
 {
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKImageProcessingBase::setupExecutionFilterParameters(FilterParameterVectorType& parameters)
+{
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Stream Subdivisions", StreamSubdivisions, FilterParameter::Category::Parameter, ITKImageProcessingBase));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Stream Memory Budget (MB)", StreamMemoryBudget, FilterParameter::Category::Parameter, ITKImageProcessingBase));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Maximum Number of Threads", MaximumNumberOfThreads, FilterParameter::Category::Parameter, ITKImageProcessingBase));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Work Units", NumberOfWorkUnits, FilterParameter::Category::Parameter, ITKImageProcessingBase));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Memory Budget (MB)", MemoryBudget, FilterParameter::Category::Parameter, ITKImageProcessingBase));
+  {
+    LinkedChoicesFilterParameter::Pointer parameter = LinkedChoicesFilterParameter::New();
+    parameter->setHumanLabel("Region of Interest");
+    parameter->setPropertyName("RegionOfInterestMode");
+    parameter->setSetterCallback(SIMPL_BIND_SETTER(ITKImageProcessingBase, this, RegionOfInterestMode));
+    parameter->setGetterCallback(SIMPL_BIND_GETTER(ITKImageProcessingBase, this, RegionOfInterestMode));
+    std::vector<QString> choices;
+    choices.push_back("Whole Image");
+    choices.push_back("Index and Size");
+    choices.push_back("Mask Bounding Box");
+    parameter->setChoices(choices);
+    std::vector<QString> linkedProps;
+    linkedProps.push_back("RegionOfInterestIndex");
+    linkedProps.push_back("RegionOfInterestSize");
+    linkedProps.push_back("RegionOfInterestMaskArrayPath");
+    parameter->setLinkedProperties(linkedProps);
+    parameter->setEditable(false);
+    parameter->setCategory(FilterParameter::Category::Parameter);
+    parameters.push_back(parameter);
+  }
+  parameters.push_back(SIMPL_NEW_INT_VEC3_FP("Region Index (Pixels)", RegionOfInterestIndex, FilterParameter::Category::Parameter, ITKImageProcessingBase, 1));
+  parameters.push_back(SIMPL_NEW_INT_VEC3_FP("Region Size (Pixels)", RegionOfInterestSize, FilterParameter::Category::Parameter, ITKImageProcessingBase, 1));
+  {
+    DataArraySelectionFilterParameter::RequirementType req =
+        DataArraySelectionFilterParameter::CreateRequirement(SIMPL::Defaults::AnyPrimitive, 1, AttributeMatrix::Type::Cell, IGeometry::Type::Image);
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Region Mask", RegionOfInterestMaskArrayPath, FilterParameter::Category::Parameter, ITKImageProcessingBase, req, 2));
+  }
+  parameters.push_back(SIMPL_NEW_DOUBLE_FP("Fill Value Outside Region", RegionOfInterestFillValue, FilterParameter::Category::Parameter, ITKImageProcessingBase));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKImageProcessingBase::readExecutionFilterParameters(AbstractFilterParametersReader* reader)
+{
+  setStreamSubdivisions(reader->readValue("StreamSubdivisions", getStreamSubdivisions()));
+  setStreamMemoryBudget(reader->readValue("StreamMemoryBudget", getStreamMemoryBudget()));
+  setMaximumNumberOfThreads(reader->readValue("MaximumNumberOfThreads", getMaximumNumberOfThreads()));
+  setNumberOfWorkUnits(reader->readValue("NumberOfWorkUnits", getNumberOfWorkUnits()));
+  setMemoryBudget(reader->readValue("MemoryBudget", getMemoryBudget()));
+  setRegionOfInterestMode(reader->readValue("RegionOfInterestMode", getRegionOfInterestMode()));
+  setRegionOfInterestIndex(reader->readIntVec3("RegionOfInterestIndex", getRegionOfInterestIndex()));
+  setRegionOfInterestSize(reader->readIntVec3("RegionOfInterestSize", getRegionOfInterestSize()));
+  setRegionOfInterestMaskArrayPath(reader->readDataArrayPath("RegionOfInterestMaskArrayPath", getRegionOfInterestMaskArrayPath()));
+  setRegionOfInterestFillValue(reader->readValue("RegionOfInterestFillValue", getRegionOfInterestFillValue()));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+unsigned int ITKImageProcessingBase::getNumberOfStreamDivisions(size_t bytesPerPixel) const
+{
+  if(!isStreamable())
+  {
+    return 1;
+  }
+  unsigned int numberOfDivisions = static_cast<unsigned int>(std::max(m_StreamSubdivisions, 1));
+  IDataArray::Pointer outputArray = m_NewCellArrayPtr.lock();
+  if(m_StreamMemoryBudget > 0 && nullptr != outputArray)
+  {
+    const double requiredBytes = static_cast<double>(outputArray->getNumberOfTuples()) * static_cast<double>(bytesPerPixel);
+    const double budgetBytes = static_cast<double>(m_StreamMemoryBudget) * 1024.0 * 1024.0;
+    numberOfDivisions = std::max(numberOfDivisions, static_cast<unsigned int>(std::ceil(requiredBytes / budgetBytes)));
+  }
+  return numberOfDivisions;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKImageProcessingBase::checkRegionOfInterest()
+{
+  if(m_RegionOfInterestMode == 0)
+  {
+    return;
+  }
+  if(m_RegionOfInterestMode < 0 || m_RegionOfInterestMode > 2)
+  {
+    setErrorCondition(-55572, "Region of Interest must be 0 (Whole Image), 1 (Index and Size) or 2 (Mask Bounding Box)");
+    return;
+  }
+  DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(m_SelectedCellArrayPath.getDataContainerName());
+  ImageGeom::Pointer image = (nullptr == dc) ? ImageGeom::NullPointer() : dc->getGeometryAs<ImageGeom>();
+  if(nullptr == image)
+  {
+    return;
+  }
+  const SizeVec3Type dims = image->getDimensions();
+  if(m_RegionOfInterestMode == 1)
+  {
+    for(size_t i = 0; i < 3; i++)
+    {
+      if(m_RegionOfInterestIndex[i] < 0 || m_RegionOfInterestSize[i] < 1 || static_cast<size_t>(m_RegionOfInterestIndex[i]) + static_cast<size_t>(m_RegionOfInterestSize[i]) > dims[i])
+      {
+        QString ss = QObject::tr("The region of interest (index %1 %2 %3, size %4 %5 %6) must have a size of at least 1 and fit in the image (%7 %8 %9)")
+                         .arg(m_RegionOfInterestIndex[0])
+                         .arg(m_RegionOfInterestIndex[1])
+                         .arg(m_RegionOfInterestIndex[2])
+                         .arg(m_RegionOfInterestSize[0])
+                         .arg(m_RegionOfInterestSize[1])
+                         .arg(m_RegionOfInterestSize[2])
+                         .arg(dims[0])
+                         .arg(dims[1])
+                         .arg(dims[2]);
+        setErrorCondition(-55572, ss);
+        return;
+      }
+    }
+    return;
+  }
+  IDataArray::Pointer mask = getDataContainerArray()->getPrereqIDataArrayFromPath(this, m_RegionOfInterestMaskArrayPath);
+  if(nullptr == mask)
+  {
+    return;
+  }
+  const bool validType = (nullptr != std::dynamic_pointer_cast<DataArray<bool>>(mask)) || (nullptr != std::dynamic_pointer_cast<UInt8ArrayType>(mask));
+  if(!validType || mask->getNumberOfComponents() != 1 || mask->getNumberOfTuples() != dims[0] * dims[1] * dims[2])
+  {
+    QString ss = QObject::tr("The region of interest mask '%1' must be a bool or uint8 array with 1 component and one value per pixel of the image").arg(m_RegionOfInterestMaskArrayPath.serialize("/"));
+    setErrorCondition(-55573, ss);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKImageBase::OutputRegion ITKImageProcessingBase::getOutputRegion()
+{
+  OutputRegion region;
+  if(m_RegionOfInterestMode != 1 && m_RegionOfInterestMode != 2)
+  {
+    return region;
+  }
+  DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(m_SelectedCellArrayPath.getDataContainerName());
+  ImageGeom::Pointer image = (nullptr == dc) ? ImageGeom::NullPointer() : dc->getGeometryAs<ImageGeom>();
+  if(nullptr == image)
+  {
+    return region;
+  }
+  region.FillValue = m_RegionOfInterestFillValue;
+  if(m_RegionOfInterestMode == 1)
+  {
+    for(size_t i = 0; i < 3; i++)
+    {
+      region.Index[i] = static_cast<size_t>(m_RegionOfInterestIndex[i]);
+      region.Size[i] = static_cast<size_t>(m_RegionOfInterestSize[i]);
+    }
+    region.Enabled = true;
+    return region;
+  }
+
+  const SizeVec3Type dims = image->getDimensions();
+  IDataArray::Pointer mask = getDataContainerArray()->getAttributeMatrix(m_RegionOfInterestMaskArrayPath)->getAttributeArray(m_RegionOfInterestMaskArrayPath.getDataArrayName());
+  bool found = false;
+  if(DataArray<bool>::Pointer boolMask = std::dynamic_pointer_cast<DataArray<bool>>(mask))
+  {
+    found = FindMaskBoundingBox(*boolMask, dims, region.Index, region.Size);
+  }
+  else if(UInt8ArrayType::Pointer uint8Mask = std::dynamic_pointer_cast<UInt8ArrayType>(mask))
+  {
+    found = FindMaskBoundingBox(*uint8Mask, dims, region.Index, region.Size);
+  }
+  if(!found)
+  {
+    QString ss = QObject::tr("The region of interest mask '%1' does not contain any pixel").arg(m_RegionOfInterestMaskArrayPath.serialize("/"));
+    setErrorCondition(-55574, ss);
+    return region;
+  }
+  region.Enabled = true;
+  return region;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKImageProcessingBase::getRegionOfInterestFraction() const
+{
+  if(m_RegionOfInterestMode != 1)
+  {
+    return 1.0;
+  }
+  DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(m_SelectedCellArrayPath.getDataContainerName());
+  ImageGeom::Pointer image = (nullptr == dc) ? ImageGeom::NullPointer() : dc->getGeometryAs<ImageGeom>();
+  if(nullptr == image)
+  {
+    return 1.0;
+  }
+  const SizeVec3Type dims = image->getDimensions();
+  double fraction = 1.0;
+  for(size_t i = 0; i < 3; i++)
+  {
+    fraction *= static_cast<double>(std::max(m_RegionOfInterestSize[i], 0)) / static_cast<double>(std::max<size_t>(dims[i], 1));
+  }
+  return std::min(fraction, 1.0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKImageProcessingBase::getWorkingMemoryPerPixel(size_t /*inputPixelSize*/, size_t /*outputPixelSize*/, unsigned int /*dimension*/) const
+{
+  return 0.0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKImageProcessingBase::getRelativeCost(unsigned int /*dimension*/) const
+{
+  return 1.0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKImageProcessingBase::isStreamable() const
+{
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKImageProcessingBase::hasAdditionalInputs() const
+{
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ITKImageProcessingBase::getIntermediatePixelSize() const
+{
+  return sizeof(double);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ITKImageProcessingBase::getOutputArrayName(bool inPlace) const
+{
+  if(m_SaveAsNewArray)
+  {
+    return m_NewCellArrayName;
+  }
+  if(inPlace)
+  {
+    return m_SelectedCellArrayPath.getDataArrayName();
+  }
+  return m_SelectedCellArrayPath.getDataArrayName() + "_ITKImageProcessingTemp";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKImageProcessingBase::replaceInputArray()
+{
+  AttributeMatrix::Pointer am = getDataContainerArray()->getAttributeMatrix(m_SelectedCellArrayPath);
+  const QString tempArrayName = getOutputArrayName(false);
+  if(nullptr == am || !am->doesAttributeArrayExist(tempArrayName))
+  {
+    return;
+  }
+  if(getErrorCode() < 0 || getCancel())
+  {
+    am->removeAttributeArray(tempArrayName);
+    return;
+  }
+  am->removeAttributeArray(m_SelectedCellArrayPath.getDataArrayName());
+  am->renameAttributeArray(tempArrayName, m_SelectedCellArrayPath.getDataArrayName());
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -115,3 +449,99 @@ QString ITKImageProcessingBase::getNewCellArrayName() const
 {
   return m_NewCellArrayName;
 }
+
+// -----------------------------------------------------------------------------
+void ITKImageProcessingBase::setSaveAsNewArray(bool value)
+{
+  m_SaveAsNewArray = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ITKImageProcessingBase::getSaveAsNewArray() const
+{
+  return m_SaveAsNewArray;
+}
+
+// -----------------------------------------------------------------------------
+void ITKImageProcessingBase::setStreamSubdivisions(int value)
+{
+  m_StreamSubdivisions = value;
+}
+
+// -----------------------------------------------------------------------------
+int ITKImageProcessingBase::getStreamSubdivisions() const
+{
+  return m_StreamSubdivisions;
+}
+
+// -----------------------------------------------------------------------------
+void ITKImageProcessingBase::setStreamMemoryBudget(int value)
+{
+  m_StreamMemoryBudget = value;
+}
+
+// -----------------------------------------------------------------------------
+int ITKImageProcessingBase::getStreamMemoryBudget() const
+{
+  return m_StreamMemoryBudget;
+}
+
+// -----------------------------------------------------------------------------
+void ITKImageProcessingBase::setRegionOfInterestMode(int value)
+{
+  m_RegionOfInterestMode = value;
+}
+
+// -----------------------------------------------------------------------------
+int ITKImageProcessingBase::getRegionOfInterestMode() const
+{
+  return m_RegionOfInterestMode;
+}
+
+// -----------------------------------------------------------------------------
+void ITKImageProcessingBase::setRegionOfInterestIndex(const IntVec3Type& value)
+{
+  m_RegionOfInterestIndex = value;
+}
+
+// -----------------------------------------------------------------------------
+IntVec3Type ITKImageProcessingBase::getRegionOfInterestIndex() const
+{
+  return m_RegionOfInterestIndex;
+}
+
+// -----------------------------------------------------------------------------
+void ITKImageProcessingBase::setRegionOfInterestSize(const IntVec3Type& value)
+{
+  m_RegionOfInterestSize = value;
+}
+
+// -----------------------------------------------------------------------------
+IntVec3Type ITKImageProcessingBase::getRegionOfInterestSize() const
+{
+  return m_RegionOfInterestSize;
+}
+
+// -----------------------------------------------------------------------------
+void ITKImageProcessingBase::setRegionOfInterestMaskArrayPath(const DataArrayPath& value)
+{
+  m_RegionOfInterestMaskArrayPath = value;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayPath ITKImageProcessingBase::getRegionOfInterestMaskArrayPath() const
+{
+  return m_RegionOfInterestMaskArrayPath;
+}
+
+// -----------------------------------------------------------------------------
+void ITKImageProcessingBase::setRegionOfInterestFillValue(double value)
+{
+  m_RegionOfInterestFillValue = value;
+}
+
+// -----------------------------------------------------------------------------
+double ITKImageProcessingBase::getRegionOfInterestFillValue() const
+{
+  return m_RegionOfInterestFillValue;
+}
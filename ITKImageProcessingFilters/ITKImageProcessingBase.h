@@ -5,14 +5,18 @@
 #pragma once
 
 #include <memory>
+#include <type_traits>
 
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLArray.hpp"
 
 class IDataArray;
 using IDataArrayWkPtrType = std::weak_ptr<IDataArray>;
 
 #include "ITKImageBase.h"
 
+#include <itkInPlaceImageFilter.h>
+
 #include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
 
 /**
@@ -26,6 +30,14 @@ class ITKImageProcessing_EXPORT ITKImageProcessingBase : public ITKImageBase
   PYB11_SHARED_POINTERS(ITKImageProcessingBase)
   PYB11_PROPERTY(DataArrayPath SelectedCellArrayPath READ getSelectedCellArrayPath WRITE setSelectedCellArrayPath)
   PYB11_PROPERTY(QString NewCellArrayName READ getNewCellArrayName WRITE setNewCellArrayName)
+  PYB11_PROPERTY(bool SaveAsNewArray READ getSaveAsNewArray WRITE setSaveAsNewArray)
+  PYB11_PROPERTY(int StreamSubdivisions READ getStreamSubdivisions WRITE setStreamSubdivisions)
+  PYB11_PROPERTY(int StreamMemoryBudget READ getStreamMemoryBudget WRITE setStreamMemoryBudget)
+  PYB11_PROPERTY(int RegionOfInterestMode READ getRegionOfInterestMode WRITE setRegionOfInterestMode)
+  PYB11_PROPERTY(IntVec3Type RegionOfInterestIndex READ getRegionOfInterestIndex WRITE setRegionOfInterestIndex)
+  PYB11_PROPERTY(IntVec3Type RegionOfInterestSize READ getRegionOfInterestSize WRITE setRegionOfInterestSize)
+  PYB11_PROPERTY(DataArrayPath RegionOfInterestMaskArrayPath READ getRegionOfInterestMaskArrayPath WRITE setRegionOfInterestMaskArrayPath)
+  PYB11_PROPERTY(double RegionOfInterestFillValue READ getRegionOfInterestFillValue WRITE setRegionOfInterestFillValue)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -70,6 +82,94 @@ public:
   QString getNewCellArrayName() const;
   Q_PROPERTY(QString NewCellArrayName READ getNewCellArrayName WRITE setNewCellArrayName)
 
+  /**
+   * @brief Setter property for SaveAsNewArray
+   */
+  void setSaveAsNewArray(bool value);
+  /**
+   * @brief Getter property for SaveAsNewArray
+   * @return Value of SaveAsNewArray
+   */
+  bool getSaveAsNewArray() const;
+  Q_PROPERTY(bool SaveAsNewArray READ getSaveAsNewArray WRITE setSaveAsNewArray)
+
+  /**
+   * @brief Setter property for StreamSubdivisions
+   */
+  void setStreamSubdivisions(int value);
+  /**
+   * @brief Getter property for StreamSubdivisions
+   * @return Value of StreamSubdivisions
+   */
+  int getStreamSubdivisions() const;
+  Q_PROPERTY(int StreamSubdivisions READ getStreamSubdivisions WRITE setStreamSubdivisions)
+
+  /**
+   * @brief Setter property for StreamMemoryBudget
+   */
+  void setStreamMemoryBudget(int value);
+  /**
+   * @brief Getter property for StreamMemoryBudget
+   * @return Value of StreamMemoryBudget
+   */
+  int getStreamMemoryBudget() const;
+  Q_PROPERTY(int StreamMemoryBudget READ getStreamMemoryBudget WRITE setStreamMemoryBudget)
+
+  /**
+   * @brief Setter property for RegionOfInterestMode
+   */
+  void setRegionOfInterestMode(int value);
+  /**
+   * @brief Getter property for RegionOfInterestMode
+   * @return Value of RegionOfInterestMode
+   */
+  int getRegionOfInterestMode() const;
+  Q_PROPERTY(int RegionOfInterestMode READ getRegionOfInterestMode WRITE setRegionOfInterestMode)
+
+  /**
+   * @brief Setter property for RegionOfInterestIndex
+   */
+  void setRegionOfInterestIndex(const IntVec3Type& value);
+  /**
+   * @brief Getter property for RegionOfInterestIndex
+   * @return Value of RegionOfInterestIndex
+   */
+  IntVec3Type getRegionOfInterestIndex() const;
+  Q_PROPERTY(IntVec3Type RegionOfInterestIndex READ getRegionOfInterestIndex WRITE setRegionOfInterestIndex)
+
+  /**
+   * @brief Setter property for RegionOfInterestSize
+   */
+  void setRegionOfInterestSize(const IntVec3Type& value);
+  /**
+   * @brief Getter property for RegionOfInterestSize
+   * @return Value of RegionOfInterestSize
+   */
+  IntVec3Type getRegionOfInterestSize() const;
+  Q_PROPERTY(IntVec3Type RegionOfInterestSize READ getRegionOfInterestSize WRITE setRegionOfInterestSize)
+
+  /**
+   * @brief Setter property for RegionOfInterestMaskArrayPath
+   */
+  void setRegionOfInterestMaskArrayPath(const DataArrayPath& value);
+  /**
+   * @brief Getter property for RegionOfInterestMaskArrayPath
+   * @return Value of RegionOfInterestMaskArrayPath
+   */
+  DataArrayPath getRegionOfInterestMaskArrayPath() const;
+  Q_PROPERTY(DataArrayPath RegionOfInterestMaskArrayPath READ getRegionOfInterestMaskArrayPath WRITE setRegionOfInterestMaskArrayPath)
+
+  /**
+   * @brief Setter property for RegionOfInterestFillValue
+   */
+  void setRegionOfInterestFillValue(double value);
+  /**
+   * @brief Getter property for RegionOfInterestFillValue
+   * @return Value of RegionOfInterestFillValue
+   */
+  double getRegionOfInterestFillValue() const;
+  Q_PROPERTY(double RegionOfInterestFillValue READ getRegionOfInterestFillValue WRITE setRegionOfInterestFillValue)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -109,9 +209,60 @@ public:
    */
   void readFilterParameters(AbstractFilterParametersReader* reader, int index) override;
 
+  /**
+   * @brief isStreamable Returns true if every output pixel only depends on a neighborhood of the matching input
+   * pixel, so that the output can be computed in pieces. Filters using statistics of the whole image (rescaling,
+   * thresholds computed from the histogram, iterative or connected filters) would compute them on each piece, so
+   * only pixel-wise and neighborhood filters override it.
+   */
+  virtual bool isStreamable() const;
+
+  /**
+   * @brief hasAdditionalInputs Returns true if the filter reads other arrays than the selected one (reference,
+   * moving, marker or mask images). These arrays are not connected by ITKFilterChain, so such filters can not be
+   * part of a chain.
+   */
+  virtual bool hasAdditionalInputs() const;
+
 protected:
   ITKImageProcessingBase();
 
+  /**
+   * @brief setupExecutionFilterParameters Appends the parameters shared by every image processing filter
+   * that control how the ITK pipeline is executed (streaming, memory budget, region of interest).
+   */
+  void setupExecutionFilterParameters(FilterParameterVectorType& parameters);
+
+  /**
+   * @brief readExecutionFilterParameters Reads the parameters added by setupExecutionFilterParameters
+   */
+  void readExecutionFilterParameters(AbstractFilterParametersReader* reader);
+
+  /**
+   * @brief getNumberOfStreamDivisions Returns the number of pieces the output is computed in: the
+   * requested StreamSubdivisions, raised if needed so that 'bytesPerPixel' times the number of pixels of
+   * one piece fits in StreamMemoryBudget (in MB, 0 means no limit). Always 1 if the filter is not streamable.
+   */
+  unsigned int getNumberOfStreamDivisions(size_t bytesPerPixel) const;
+
+  /**
+   * @brief checkRegionOfInterest Checks that the region of interest fits in the image, or that the mask array
+   * is a bool or uint8 array with one component and one value per pixel
+   */
+  void checkRegionOfInterest();
+
+  /**
+   * @brief getOutputRegion Returns the region of the image the filter computes: the whole image, the region
+   * given by index and size or the bounding box of the non zero values of the mask array
+   */
+  OutputRegion getOutputRegion();
+
+  /**
+   * @brief getRegionOfInterestFraction Returns the fraction of the image covered by the region of interest
+   * when it is known before execution (1.0 for the whole image and for masks)
+   */
+  double getRegionOfInterestFraction() const;
+
   /**
    * @brief dataCheck Checks for the appropriate parameter values and availability of arrays
    */
@@ -123,11 +274,56 @@ protected:
     // Check data array
     imageCheck<InputPixelType, Dimension>(getSelectedCellArrayPath());
 
+    if(m_StreamSubdivisions < 1)
+    {
+      setErrorCondition(-55560, "Stream Subdivisions must be greater or equal than 1");
+    }
+    if(m_StreamMemoryBudget < 0)
+    {
+      setErrorCondition(-55561, "Stream Memory Budget must be greater or equal than 0 (0 means no limit)");
+    }
+    if(getMaximumNumberOfThreads() < 0 || getNumberOfWorkUnits() < 0 || getMemoryBudget() < 0)
+    {
+      setErrorCondition(-55590, "Maximum Number of Threads, Number of Work Units and Memory Budget must be greater or equal than 0 (0 means the plugin-wide setting)");
+    }
+    if(m_StreamSubdivisions > 1 && !isStreamable())
+    {
+      setErrorCondition(-55564, "This filter uses the whole image to compute each pixel and can not be streamed. Stream Subdivisions must be 1");
+    }
+    if(m_StreamMemoryBudget > 0 && !isStreamable())
+    {
+      setWarningCondition(-55565, "This filter uses the whole image to compute each pixel and can not be streamed. The Stream Memory Budget is ignored");
+    }
+    checkRegionOfInterest();
+
+    if(getErrorCode() < 0)
+    {
+      return;
+    }
+    estimateResources<InputPixelType, OutputPixelType, Dimension>();
     if(getErrorCode() < 0)
     {
       return;
     }
+
     std::vector<size_t> outputDims = ITKDream3DHelper::GetComponentsDimensions<OutputPixelType>();
+    if(!m_SaveAsNewArray)
+    {
+      // The result replaces the input array. When the pixel type changes, the following filters have to see
+      // the output type under the input name, so the input array is replaced here during preflight (the
+      // actual replacement happens in replaceInputArray once the filter has run).
+      if(getInPreflight() && !std::is_same<InputPixelType, OutputPixelType>::value)
+      {
+        getDataContainerArray()->getAttributeMatrix(getSelectedCellArrayPath())->removeAttributeArray(getSelectedCellArrayPath().getDataArrayName());
+        m_NewCellArrayPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<OutputValueType>>(this, getSelectedCellArrayPath(), 0, outputDims);
+      }
+      else
+      {
+        m_NewCellArrayPtr = getDataContainerArray()->getPrereqIDataArrayFromPath(this, getSelectedCellArrayPath());
+      }
+      m_NewCellArray = nullptr;
+      return;
+    }
     DataArrayPath tempPath;
     tempPath.update(getSelectedCellArrayPath().getDataContainerName(), getSelectedCellArrayPath().getAttributeMatrixName(), getNewCellArrayName());
     m_NewCellArrayPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<OutputValueType>>(this, tempPath, 0, outputDims);
@@ -137,17 +333,96 @@ protected:
     } /* Now assign the raw pointer to data from the DataArray<T> object */
   }
 
+  /**
+   * @brief estimateResources Estimates the peak memory of the filter (input array, output array and the
+   * working memory of the ITK filter) and its relative cost, then checks them (see checkResourceEstimate)
+   */
+  template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension>
+  void estimateResources()
+  {
+    AttributeMatrix::Pointer am = getDataContainerArray()->getAttributeMatrix(getSelectedCellArrayPath());
+    if(nullptr == am)
+    {
+      return;
+    }
+    // The ITK filter only works on the region of interest, the input and output arrays are always full size
+    const double numberOfPixels = static_cast<double>(am->getNumberOfTuples());
+    const double fraction = getRegionOfInterestFraction();
+    const double workingMemory = fraction * getWorkingMemoryPerPixel(sizeof(InputPixelType), sizeof(OutputPixelType), Dimension);
+    checkResourceEstimate(numberOfPixels * (sizeof(InputPixelType) + sizeof(OutputPixelType) + workingMemory), fraction * getRelativeCost(Dimension));
+  }
+
+  /**
+   * @brief getWorkingMemoryPerPixel Returns the number of bytes per pixel the ITK filter allocates besides the
+   * output array (internal images, copies in floating point...). Most filters write directly in the output
+   * array, filters with internal images override it.
+   */
+  virtual double getWorkingMemoryPerPixel(size_t inputPixelSize, size_t outputPixelSize, unsigned int dimension) const;
+
+  /**
+   * @brief getRelativeCost Returns the computation cost of the filter relative to a pixel-wise filter (1.0)
+   * applied to the same image. Neighborhood and iterative filters override it.
+   */
+  virtual double getRelativeCost(unsigned int dimension) const;
+
+  /**
+   * @brief getIntermediatePixelSize Returns the size of a pixel of the floating point images used by
+   * filterCastToFloat. Filters that can compute in single precision override it.
+   */
+  virtual size_t getIntermediatePixelSize() const;
+
   /**
    * @brief Applies the filter
    */
   template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension, typename FilterType>
   void filter(FilterType* filter)
   {
-    std::string outputArrayName = getSelectedCellArrayPath().getDataArrayName().toStdString();
-
-    outputArrayName = getNewCellArrayName().toStdString();
+    const OutputRegion region = getOutputRegion();
+    if(getErrorCode() < 0)
+    {
+      return;
+    }
+    // Pixel-wise filters overwrite the input buffer directly (InPlaceImageFilter), the other filters write
+    // a temporary array that replaces the input array afterwards
+    const bool inPlace = SetInPlace(filter, filter, !m_SaveAsNewArray && !region.Enabled);
+    // The result of a region of interest is copied into the input array, which keeps its values outside of
+    // the region. It is computed in one piece, so that no piece reads pixels already overwritten.
+    const bool writeInput = !m_SaveAsNewArray && region.Enabled && std::is_same<InputPixelType, OutputPixelType>::value;
+    std::string outputArrayName = getOutputArrayName(inPlace || writeInput).toStdString();
+
+    // Streaming does not save any memory when the input buffer is reused
+    const unsigned int numberOfStreamDivisions = (inPlace || writeInput) ? 1 : getNumberOfStreamDivisions(sizeof(OutputPixelType));
+
+    ITKImageBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter, outputArrayName, getSelectedCellArrayPath(), numberOfStreamDivisions, region);
+    if(!m_SaveAsNewArray && !inPlace && !writeInput)
+    {
+      replaceInputArray();
+    }
+  }
 
-    ITKImageBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter, outputArrayName, getSelectedCellArrayPath());
+  /**
+   * @brief Applies a pixel-wise filter. Scalar arrays are computed by the ITKUnaryKernels 'operation', which
+   * gives the same result as 'filter', the other arrays go through the ITK filter.
+   */
+  template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension, typename FilterType>
+  void filterUnary(FilterType* filter, ITKUnaryKernels::Operation operation, double parameter = 0.0)
+  {
+    // The kernels process whole arrays
+    if(m_RegionOfInterestMode != 0)
+    {
+      ITKImageProcessingBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter);
+      return;
+    }
+    const bool inPlace = SetInPlace(filter, filter, !m_SaveAsNewArray);
+    if(!applyUnaryKernel<InputPixelType, OutputPixelType>(operation, parameter, getOutputArrayName(inPlace).toStdString(), getSelectedCellArrayPath()))
+    {
+      ITKImageProcessingBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter);
+      return;
+    }
+    if(!m_SaveAsNewArray && !inPlace)
+    {
+      replaceInputArray();
+    }
   }
 
   /**
@@ -156,12 +431,52 @@ protected:
   template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension, typename FilterType, typename FloatImageType>
   void filterCastToFloat(FilterType* filter)
   {
-    std::string outputArrayName = getSelectedCellArrayPath().getDataArrayName().toStdString();
+    const OutputRegion region = getOutputRegion();
+    if(getErrorCode() < 0)
+    {
+      return;
+    }
+    // See filter() for the region of interest written in the input array
+    const bool writeInput = !m_SaveAsNewArray && region.Enabled && std::is_same<InputPixelType, OutputPixelType>::value;
+    std::string outputArrayName = getOutputArrayName(writeInput).toStdString();
 
-    outputArrayName = getNewCellArrayName().toStdString();
+    // Each piece holds the cast input, the filtered image and the cast back output
+    const unsigned int numberOfStreamDivisions = writeInput ? 1 : getNumberOfStreamDivisions(2 * sizeof(typename FloatImageType::PixelType) + sizeof(OutputPixelType));
 
-    ITKImageBase::filterCastToFloat<InputPixelType, OutputPixelType, Dimension, FilterType, FloatImageType>(filter, outputArrayName, getSelectedCellArrayPath());
+    ITKImageBase::filterCastToFloat<InputPixelType, OutputPixelType, Dimension, FilterType, FloatImageType>(filter, outputArrayName, getSelectedCellArrayPath(), numberOfStreamDivisions, region);
+    if(!m_SaveAsNewArray && !writeInput)
+    {
+      replaceInputArray();
+    }
+  }
+
+  /**
+   * @brief SetInPlace Sets in place execution to 'inPlace' for filters deriving from itk::InPlaceImageFilter with
+   * the same input and output image types and returns it. Returns false for all the other filters.
+   */
+  template <typename FilterType, typename ImageType>
+  static bool SetInPlace(FilterType* filter, itk::InPlaceImageFilter<ImageType, ImageType>* /*unused*/, bool inPlace)
+  {
+    filter->SetInPlace(inPlace);
+    return inPlace;
   }
+  template <typename FilterType>
+  static bool SetInPlace(FilterType* /*unused*/, ...)
+  {
+    return false;
+  }
+
+  /**
+   * @brief getOutputArrayName Returns the name of the array the filter writes: NewCellArrayName when the
+   * result is saved as a new array, otherwise the input array itself if the filter runs in place, or a
+   * temporary array that replaceInputArray moves over the input array.
+   */
+  QString getOutputArrayName(bool inPlace) const;
+
+  /**
+   * @brief replaceInputArray Replaces the input array with the temporary output array
+   */
+  void replaceInputArray();
 
   /**
    * @brief Initializes all the private instance variables.
@@ -174,6 +489,14 @@ private:
 
   DataArrayPath m_SelectedCellArrayPath = {};
   QString m_NewCellArrayName = {};
+  bool m_SaveAsNewArray = true;
+  int m_StreamSubdivisions = 1;
+  int m_StreamMemoryBudget = 0;
+  int m_RegionOfInterestMode = 0;
+  IntVec3Type m_RegionOfInterestIndex = {0, 0, 0};
+  IntVec3Type m_RegionOfInterestSize = {0, 0, 0};
+  DataArrayPath m_RegionOfInterestMaskArrayPath = {};
+  double m_RegionOfInterestFillValue = 0.0;
 
 public:
   ITKImageProcessingBase(const ITKImageProcessingBase&) = delete;            // Copy Constructor Not Implemented
@@ -227,6 +227,8 @@ void ITKImportFijiMontage::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Convert To GrayScale", ConvertToGrayScale, FilterParameter::Category::Parameter, ITKImportFijiMontage, linkedProps));
   parameters.push_back(SIMPL_NEW_FLOAT_VEC3_FP("Color Weighting", ColorWeights, FilterParameter::Category::Parameter, ITKImportFijiMontage));
 
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Load Tiles On Demand", LoadTilesOnDemand, FilterParameter::Category::Parameter, ITKImportFijiMontage));
+
   parameters.push_back(SIMPL_NEW_DC_CREATION_FP("DataContainer Prefix", DataContainerPath, FilterParameter::Category::CreatedArray, ITKImportFijiMontage));
   parameters.push_back(SIMPL_NEW_AM_WITH_LINKED_DC_FP("Cell Attribute Matrix Name", CellAttributeMatrixName, DataContainerPath, FilterParameter::Category::CreatedArray, ITKImportFijiMontage));
   parameters.push_back(SIMPL_NEW_STRING_FP("Image DataArray Name", ImageDataArrayName, FilterParameter::Category::CreatedArray, ITKImportFijiMontage));
@@ -278,6 +280,12 @@ void ITKImportFijiMontage::dataCheck()
     setErrorCondition(-394, ss);
   }
 
+  if(getLoadTilesOnDemand() && getConvertToGrayScale())
+  {
+    ss = QObject::tr("Tiles loaded on demand are read directly from their image files and cannot be converted to gray scale by the importer.");
+    setErrorCondition(-402, ss);
+  }
+
   if(getErrorCode() < 0)
   {
     return;
@@ -391,7 +399,15 @@ void ITKImportFijiMontage::execute()
   clearErrorCode();
   clearWarningCode();
 
-  readImages();
+  if(getLoadTilesOnDemand())
+  {
+    // Only the file of each tile is recorded, the montage filters read the pixels when they need them
+    notifyStatusMessage("Tiles will be loaded on demand");
+  }
+  else
+  {
+    readImages();
+  }
 
   /* If some error occurs this code snippet can report the error up the call chain*/
   if(err < 0)
@@ -574,7 +590,15 @@ void ITKImportFijiMontage::generateDataStructure()
     // Create the Cell Attribute Matrix into which the image data would be read
     AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New(bound.Dims.toContainer<StdVecSizeType>(), getCellAttributeMatrixName(), AttributeMatrix::Type::Cell);
     dc->addOrReplaceAttributeMatrix(cellAttrMat);
-    cellAttrMat->addOrReplaceAttributeArray(bound.ImageDataProxy);
+    if(getLoadTilesOnDemand())
+    {
+      // No image array is created, so that no other filter can use the pixels that are not read
+      MontageImportHelper::SetTileSourceFilePath(dc, bound.Filename, bound.ImageDataProxy);
+    }
+    else
+    {
+      cellAttrMat->addOrReplaceAttributeArray(bound.ImageDataProxy);
+    }
   }
   getDataContainerArray()->addOrReplaceMontage(gridMontage);
 }
@@ -1035,6 +1059,18 @@ FloatVec3Type ITKImportFijiMontage::getColorWeights() const
   return m_ColorWeights;
 }
 
+// -----------------------------------------------------------------------------
+void ITKImportFijiMontage::setLoadTilesOnDemand(bool value)
+{
+  m_LoadTilesOnDemand = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ITKImportFijiMontage::getLoadTilesOnDemand() const
+{
+  return m_LoadTilesOnDemand;
+}
+
 // -----------------------------------------------------------------------------
 void ITKImportFijiMontage::setChangeOrigin(bool value)
 {
@@ -67,6 +67,7 @@ class ITKImageProcessing_EXPORT ITKImportFijiMontage : public AbstractFilter
   PYB11_PROPERTY(QString ImageDataArrayName READ getImageDataArrayName WRITE setImageDataArrayName)
   PYB11_PROPERTY(bool ConvertToGrayScale READ getConvertToGrayScale WRITE setConvertToGrayScale)
   PYB11_PROPERTY(FloatVec3Type ColorWeights READ getColorWeights WRITE setColorWeights)
+  PYB11_PROPERTY(bool LoadTilesOnDemand READ getLoadTilesOnDemand WRITE setLoadTilesOnDemand)
   PYB11_PROPERTY(bool ChangeOrigin READ getChangeOrigin WRITE setChangeOrigin)
   PYB11_PROPERTY(FloatVec3Type Origin READ getOrigin WRITE setOrigin)
   PYB11_PROPERTY(bool ChangeSpacing READ getChangeSpacing WRITE setChangeSpacing)
@@ -222,6 +223,17 @@ public:
   FloatVec3Type getColorWeights() const;
   Q_PROPERTY(FloatVec3Type ColorWeights READ getColorWeights WRITE setColorWeights)
 
+  /**
+   * @brief Setter property for LoadTilesOnDemand
+   */
+  void setLoadTilesOnDemand(bool value);
+  /**
+   * @brief Getter property for LoadTilesOnDemand
+   * @return Value of LoadTilesOnDemand
+   */
+  bool getLoadTilesOnDemand() const;
+  Q_PROPERTY(bool LoadTilesOnDemand READ getLoadTilesOnDemand WRITE setLoadTilesOnDemand)
+
   /**
    * @brief Setter property for ChangeOrigin
    */
@@ -430,6 +442,7 @@ private:
   QString m_ImageDataArrayName = {};
   bool m_ConvertToGrayScale = {};
   FloatVec3Type m_ColorWeights = {};
+  bool m_LoadTilesOnDemand = {};
   bool m_ChangeOrigin = {};
   FloatVec3Type m_Origin = {};
   bool m_ChangeSpacing = {};
@@ -163,6 +163,11 @@ protected:
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageProcessingBase class
+   */
+  bool isStreamable() const override;
+
 public:
   ITKIntensityWindowingImage(const ITKIntensityWindowingImage&) = delete;            // Copy Constructor Not Implemented
   ITKIntensityWindowingImage(ITKIntensityWindowingImage&&) = delete;                 // Move Constructor Not Implemented
@@ -127,6 +127,11 @@ protected:
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageProcessingBase class
+   */
+  bool isStreamable() const override;
+
 public:
   ITKInvertIntensityImage(const ITKInvertIntensityImage&) = delete;            // Copy Constructor Not Implemented
   ITKInvertIntensityImage(ITKInvertIntensityImage&&) = delete;                 // Move Constructor Not Implemented
@@ -140,6 +140,11 @@ protected:
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageProcessingBase class
+   */
+  bool isStreamable() const override;
+
 public:
   ITKLabelContourImage(const ITKLabelContourImage&) = delete;            // Copy Constructor Not Implemented
   ITKLabelContourImage(ITKLabelContourImage&&) = delete;                 // Move Constructor Not Implemented
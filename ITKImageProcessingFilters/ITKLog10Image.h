@@ -106,6 +106,11 @@ protected:
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageProcessingBase class
+   */
+  bool isStreamable() const override;
+
 public:
   ITKLog10Image(const ITKLog10Image&) = delete;            // Copy Constructor Not Implemented
   ITKLog10Image(ITKLog10Image&&) = delete;                 // Move Constructor Not Implemented
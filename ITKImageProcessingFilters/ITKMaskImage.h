@@ -159,6 +159,11 @@ protected:
   template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension>
   typename std::enable_if<!std::is_scalar<InputPixelType>::value>::type convertDataContainerType();
 
+  /**
+   * @brief hasAdditionalInputs Reimplemented from @see ITKImageProcessingBase class
+   */
+  bool hasAdditionalInputs() const override;
+
 public:
   ITKMaskImage(const ITKMaskImage&) = delete;            // Copy Constructor Not Implemented
   ITKMaskImage(ITKMaskImage&&) = delete;                 // Move Constructor Not Implemented
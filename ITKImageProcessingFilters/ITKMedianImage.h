@@ -127,6 +127,16 @@ protected:
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
 
+  /**
+   * @brief getRelativeCost Reimplemented from @see ITKImageProcessingBase class
+   */
+  double getRelativeCost(unsigned int dimension) const override;
+
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageProcessingBase class
+   */
+  bool isStreamable() const override;
+
 public:
   ITKMedianImage(const ITKMedianImage&) = delete;            // Copy Constructor Not Implemented
   ITKMedianImage(ITKMedianImage&&) = delete;                 // Move Constructor Not Implemented
@@ -5,6 +5,10 @@
  */
 
 #include "ITKImageProcessing/ITKImageProcessingFilters/ITKMinMaxCurvatureFlowImage.h"
+
+#include <algorithm>
+#include <cmath>
+
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
@@ -44,6 +48,7 @@ void ITKMinMaxCurvatureFlowImage::setupFilterParameters()
 
   std::vector<QString> linkedProps;
   linkedProps.push_back("NewCellArrayName");
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Category::Parameter, ITKMinMaxCurvatureFlowImage, linkedProps));
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -53,6 +58,8 @@ void ITKMinMaxCurvatureFlowImage::setupFilterParameters()
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::CreatedArray));
   parameters.push_back(SIMPL_NEW_STRING_FP("Filtered Array", NewCellArrayName, FilterParameter::Category::CreatedArray, ITKMinMaxCurvatureFlowImage));
 
+  setupExecutionFilterParameters(parameters);
+
   setFilterParameters(parameters);
 }
 
@@ -64,9 +71,11 @@ void ITKMinMaxCurvatureFlowImage::readFilterParameters(AbstractFilterParametersR
   reader->openFilterGroup(this, index);
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
+  setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
   setTimeStep(reader->readValue("TimeStep", getTimeStep()));
   setNumberOfIterations(reader->readValue("NumberOfIterations", getNumberOfIterations()));
   setStencilRadius(reader->readValue("StencilRadius", getStencilRadius()));
+  readExecutionFilterParameters(reader);
 
   reader->closeFilterGroup();
 }
@@ -119,6 +128,23 @@ void ITKMinMaxCurvatureFlowImage::filterInternal()
   Dream3DArraySwitchMacro(this->filter, getSelectedCellArrayPath(), -4);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKMinMaxCurvatureFlowImage::getWorkingMemoryPerPixel(size_t /*inputPixelSize*/, size_t /*outputPixelSize*/, unsigned int /*dimension*/) const
+{
+  // Floating point copy of the input, solution and update buffer
+  return static_cast<double>(3 * getIntermediatePixelSize());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKMinMaxCurvatureFlowImage::getRelativeCost(unsigned int dimension) const
+{
+  return 2.0 * std::pow(2.0 * std::max(m_StencilRadius, 1) + 1.0, dimension) * std::max(m_NumberOfIterations, 1.0);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
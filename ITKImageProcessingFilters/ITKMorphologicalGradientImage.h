@@ -140,6 +140,11 @@ protected:
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageProcessingBase class
+   */
+  bool isStreamable() const override;
+
 public:
   ITKMorphologicalGradientImage(const ITKMorphologicalGradientImage&) = delete;            // Copy Constructor Not Implemented
   ITKMorphologicalGradientImage(ITKMorphologicalGradientImage&&) = delete;                 // Move Constructor Not Implemented
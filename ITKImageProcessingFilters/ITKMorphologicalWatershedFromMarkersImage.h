@@ -171,6 +171,11 @@ protected:
   template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension>
   void convertDataContainerType();
 
+  /**
+   * @brief hasAdditionalInputs Reimplemented from @see ITKImageProcessingBase class
+   */
+  bool hasAdditionalInputs() const override;
+
 public:
   ITKMorphologicalWatershedFromMarkersImage(const ITKMorphologicalWatershedFromMarkersImage&) = delete;            // Copy Constructor Not Implemented
   ITKMorphologicalWatershedFromMarkersImage(ITKMorphologicalWatershedFromMarkersImage&&) = delete;                 // Move Constructor Not Implemented
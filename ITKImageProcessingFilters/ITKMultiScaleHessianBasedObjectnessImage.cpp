@@ -6,6 +6,8 @@
 
 #include "ITKMultiScaleHessianBasedObjectnessImage.h"
 
+#include <algorithm>
+
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
@@ -63,6 +65,7 @@ void ITKMultiScaleHessianBasedObjectnessImage::setupFilterParameters()
 
   std::vector<QString> linkedProps;
   linkedProps.push_back("NewCellArrayName");
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Category::Parameter, ITKMultiScaleHessianBasedObjectnessImage, linkedProps));
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -72,6 +75,8 @@ void ITKMultiScaleHessianBasedObjectnessImage::setupFilterParameters()
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::CreatedArray));
   parameters.push_back(SIMPL_NEW_STRING_FP("Filtered Array", NewCellArrayName, FilterParameter::Category::CreatedArray, ITKMultiScaleHessianBasedObjectnessImage));
 
+  setupExecutionFilterParameters(parameters);
+
   setFilterParameters(parameters);
 }
 
@@ -83,6 +88,7 @@ void ITKMultiScaleHessianBasedObjectnessImage::readFilterParameters(AbstractFilt
   reader->openFilterGroup(this, index);
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
+  setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
   setObjectDimension(reader->readValue("ObjectDimension", getObjectDimension()));
   setAlpha(reader->readValue("Alpha", getAlpha()));
   setBeta(reader->readValue("Beta", getBeta()));
@@ -92,6 +98,7 @@ void ITKMultiScaleHessianBasedObjectnessImage::readFilterParameters(AbstractFilt
   setSigmaMinimum(reader->readValue("SigmaMinimum", getSigmaMinimum()));
   setSigmaMaximum(reader->readValue("SigmaMaximum", getSigmaMaximum()));
   setNumberOfSigmaSteps(reader->readValue("NumberOfSigmaSteps", getNumberOfSigmaSteps()));
+  readExecutionFilterParameters(reader);
 
   reader->closeFilterGroup();
 }
@@ -162,6 +169,24 @@ void ITKMultiScaleHessianBasedObjectnessImage::filterInternal()
   Dream3DArraySwitchMacro(this->filter, getSelectedCellArrayPath(), -4);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKMultiScaleHessianBasedObjectnessImage::getWorkingMemoryPerPixel(size_t /*inputPixelSize*/, size_t /*outputPixelSize*/, unsigned int dimension) const
+{
+  // Hessian image, smoothed derivative and best response so far
+  return static_cast<double>((dimension * (dimension + 1) / 2 + 2) * sizeof(double));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKMultiScaleHessianBasedObjectnessImage::getRelativeCost(unsigned int dimension) const
+{
+  // One recursive Gaussian derivative per Hessian component and per scale
+  return std::max(m_NumberOfSigmaSteps, 1.0) * (dimension * (dimension + 1) / 2) * 3.0 * dimension;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -106,6 +106,11 @@ protected:
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageProcessingBase class
+   */
+  bool isStreamable() const override;
+
 public:
   ITKNotImage(const ITKNotImage&) = delete;            // Copy Constructor Not Implemented
   ITKNotImage(ITKNotImage&&) = delete;                 // Move Constructor Not Implemented
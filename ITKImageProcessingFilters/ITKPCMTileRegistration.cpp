@@ -35,11 +35,17 @@
 #include "ITKPCMTileRegistration.h"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <tuple>
 #include <type_traits>
 
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatFilterParameter.h"
 #include "SIMPLib/FilterParameters/IntFilterParameter.h"
@@ -56,13 +62,19 @@
 #include "SIMPLib/ITK/itkProgressObserver.hpp"
 #include "SIMPLib/ITK/itkTransformToDream3DITransformContainer.h"
 #include "SIMPLib/ITK/itkTransformToDream3DTransformContainer.h"
+#include "SIMPLib/Utilities/ParallelTaskAlgorithm.h"
 
 #include "ITKImageProcessing/ITKImageProcessingFilters/MetaXmlUtils.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/DetermineStitching.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/ITKExecutionPolicy.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/ITKFFTPlanCache.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/ITKFilterTelemetry.h"
 #include "ITKImageProcessing/ITKImageProcessingFilters/util/MontageImportHelper.h"
 #include "ITKImageProcessing/ITKImageProcessingVersion.h"
 
+#include "itkBinShrinkImageFilter.h"
 #include "itkImageFileWriter.h"
-#include "itkRGBToLuminanceImageFilter.h"
+#include "itkRegionOfInterestImageFilter.h"
 #include "itkStreamingImageFilter.h"
 #include "itkTileMergeImageFilter.h"
 #include "itkTileMontage.h"
@@ -146,6 +158,134 @@
 
 itk::NumericTraits<float> nmfloat;
 
+namespace
+{
+const int k_TileMontageRegistration = 0;
+const int k_PairBatchRegistration = 1;
+
+// A pair that could not be registered keeps the offset given by the tile origins, with a tiny weight so that
+// its tiles are still placed when they have no other neighbour
+const double k_FailedPairWeight = 1.0e-6;
+
+/**
+ * @brief The ScalarTile struct wraps the array of a tile into the scalar image the montage registers
+ */
+template <typename PixelType, unsigned Dimension>
+struct ScalarTile
+{
+  using ScalarImageType = itk::Image<typename itk::NumericTraits<PixelType>::ValueType, Dimension>;
+
+  static typename ScalarImageType::Pointer Create(const DataContainer::Pointer& dc, const QString& amName, const QString& daName, std::vector<itk::ProcessObject::Pointer>& sources)
+  {
+    std::ignore = sources;
+    using InPlaceDream3DToImageFileType = itk::InPlaceDream3DDataToImageFilter<typename ScalarImageType::PixelType, Dimension>;
+    typename InPlaceDream3DToImageFileType::Pointer toITK = InPlaceDream3DToImageFileType::New();
+    toITK->SetInput(dc);
+    toITK->SetInPlace(true);
+    toITK->SetAttributeMatrixArrayName(amName.toStdString());
+    toITK->SetDataArrayName(daName.toStdString());
+    toITK->Update();
+    return toITK->GetOutput();
+  }
+};
+
+/**
+ * @brief The LuminanceTile struct returns the luminance image of a colour tile, converted region by region as the
+ * montage requests them, see MontageImportHelper::CreateTileLuminanceImage
+ */
+template <typename PixelType, unsigned Dimension>
+struct LuminanceTile
+{
+  using ScalarImageType = itk::Image<typename itk::NumericTraits<PixelType>::ValueType, Dimension>;
+
+  static typename ScalarImageType::Pointer Create(const DataContainer::Pointer& dc, const QString& amName, const QString& daName, std::vector<itk::ProcessObject::Pointer>& sources)
+  {
+    return MontageImportHelper::CreateTileLuminanceImage<PixelType, Dimension>(dc, amName, daName, sources);
+  }
+};
+
+template <typename T, unsigned Dimension>
+struct ScalarTile<itk::RGBPixel<T>, Dimension> : public LuminanceTile<itk::RGBPixel<T>, Dimension>
+{
+};
+
+template <typename T, unsigned Dimension>
+struct ScalarTile<itk::RGBAPixel<T>, Dimension> : public LuminanceTile<itk::RGBAPixel<T>, Dimension>
+{
+};
+
+/**
+ * @brief GetMaximumConcurrentTilePairs Returns how many pairs of tiles may be registered at once: the number of
+ * threads, lowered so that the estimated memory of the registrations fits in the memory budget of ITKExecutionPolicy
+ * @param tilePixels
+ * @param pixelSize
+ * @return
+ */
+uint32_t GetMaximumConcurrentTilePairs(size_t tilePixels, size_t pixelSize)
+{
+  const uint32_t numberOfThreads = static_cast<uint32_t>(std::max(ITKExecutionPolicy::GetNumberOfThreads(), 1));
+  const size_t budget = ITKExecutionPolicy::GetMemoryBudgetInBytes();
+  if(budget == 0)
+  {
+    return numberOfThreads;
+  }
+  // Each pair keeps the scalar images of both tiles, their padded copies and their transforms, the cross power
+  // spectrum and the phase correlation image: about eight double precision complex images of the tile size.
+  const double bytesPerPair = static_cast<double>(tilePixels) * (2.0 * pixelSize + 8.0 * sizeof(std::complex<double>));
+  const double maximumPairs = std::floor(static_cast<double>(budget) / std::max(bytesPerPair, 1.0));
+  return static_cast<uint32_t>(std::max(1.0, std::min(maximumPairs, static_cast<double>(numberOfThreads))));
+}
+
+/**
+ * @brief GetRefinementRegion Returns the region of 'image' that the full resolution refinement of a pair registers:
+ * the nominal overlap of the two tiles, enlarged by 'margin' along the pair, and a patch of at most
+ * DetermineStitching::RefinementPatchSize pixels centered on the overlap in the other dimension
+ * @param image One of the two tiles
+ * @param firstImage
+ * @param secondImage
+ * @param horizontal Whether the second tile is on the right of the first one, or below it
+ * @param margin Physical margin added on both sides of the overlap along the pair
+ * @return Empty region when the patch is outside of 'image'
+ */
+template <typename ImageType, unsigned Dimension>
+typename ImageType::RegionType GetRefinementRegion(const ImageType* image, const ImageType* firstImage, const ImageType* secondImage, bool horizontal, const itk::Vector<double, Dimension>& margin)
+{
+  const unsigned pairDimension = horizontal ? 0 : 1;
+  const typename ImageType::RegionType largestRegion = image->GetLargestPossibleRegion();
+  typename ImageType::RegionType region = largestRegion;
+  for(unsigned d = 0; d < Dimension; d++)
+  {
+    const double firstStart = firstImage->GetOrigin()[d];
+    const double firstEnd = firstStart + firstImage->GetLargestPossibleRegion().GetSize(d) * firstImage->GetSpacing()[d];
+    const double secondStart = secondImage->GetOrigin()[d];
+    const double secondEnd = secondStart + secondImage->GetLargestPossibleRegion().GetSize(d) * secondImage->GetSpacing()[d];
+    double low = std::max(firstStart, secondStart);
+    double high = std::min(firstEnd, secondEnd);
+    if(d == pairDimension)
+    {
+      low -= margin[d];
+      high += margin[d];
+    }
+    else
+    {
+      const double half = std::min(0.5 * (high - low), 0.5 * static_cast<double>(DetermineStitching::RefinementPatchSize) * image->GetSpacing()[d]);
+      const double center = 0.5 * (low + high);
+      low = center - half;
+      high = center + half;
+    }
+    const itk::IndexValueType start = static_cast<itk::IndexValueType>(std::floor((low - image->GetOrigin()[d]) / image->GetSpacing()[d]));
+    const itk::IndexValueType end = static_cast<itk::IndexValueType>(std::ceil((high - image->GetOrigin()[d]) / image->GetSpacing()[d]));
+    region.SetIndex(d, largestRegion.GetIndex(d) + start);
+    region.SetSize(d, static_cast<itk::SizeValueType>(std::max<itk::IndexValueType>(end - start, 0)));
+  }
+  if(!region.Crop(largestRegion))
+  {
+    region.SetSize(typename ImageType::SizeType());
+  }
+  return region;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -187,6 +327,13 @@ void ITKPCMTileRegistration::setupFilterParameters()
 
   parameters.push_back(SIMPL_NEW_INTEGER_FP("Padding Digits for DataContainer Names", DataContainerPaddingDigits, FilterParameter::Category::Parameter, ITKPCMTileRegistration));
 
+  {
+    std::vector<QString> choices = {"Tile Montage", "Parallel Pair Batches"};
+    parameters.push_back(SIMPL_NEW_CHOICE_FP("Registration Mode", RegistrationMode, FilterParameter::Category::Parameter, ITKPCMTileRegistration, choices, false));
+  }
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Coarse Registration Factor", CoarseRegistrationFactor, FilterParameter::Category::Parameter, ITKPCMTileRegistration));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Measure and Cache FFT Plans", MeasureFFTPlans, FilterParameter::Category::Parameter, ITKPCMTileRegistration));
+
   parameters.push_back(SIMPL_NEW_STRING_FP("Data Container Prefix", DataContainerPrefix, FilterParameter::Category::RequiredArray, ITKPCMTileRegistration));
 
   parameters.push_back(SIMPL_NEW_STRING_FP("Common Attribute Matrix", CommonAttributeMatrixName, FilterParameter::Category::RequiredArray, ITKPCMTileRegistration));
@@ -229,6 +376,28 @@ void ITKPCMTileRegistration::dataCheck()
     return;
   }
 
+  if(m_RegistrationMode != k_TileMontageRegistration && m_RegistrationMode != k_PairBatchRegistration)
+  {
+    QString ss = QObject::tr("Registration Mode (%1) is not valid").arg(m_RegistrationMode);
+    setErrorCondition(-11007, ss);
+    return;
+  }
+
+  if(m_CoarseRegistrationFactor < 1)
+  {
+    QString ss = QObject::tr("Coarse Registration Factor (%1) must be at least 1 (1 registers the full resolution tiles only)").arg(m_CoarseRegistrationFactor);
+    setErrorCondition(-11011, ss);
+    return;
+  }
+  // The tile montage registers all the pairs internally and cannot be given a coarse estimate
+  if(m_CoarseRegistrationFactor > 1 && m_RegistrationMode != k_PairBatchRegistration)
+  {
+    QString ss = QObject::tr("Coarse Registration Factor (%1) is only supported by the Parallel Pair Batches registration mode, set it to 1 to use the Tile Montage mode")
+                     .arg(m_CoarseRegistrationFactor);
+    setErrorCondition(-11012, ss);
+    return;
+  }
+
   if(getDataContainerPrefix().isEmpty())
   {
     QString ss = QObject::tr("Data Container Prefix is empty.");
@@ -273,9 +442,19 @@ void ITKPCMTileRegistration::dataCheck()
         return;
       }
 
-      IDataArray::Pointer imagePtr = dca->getPrereqIDataArrayFromPath(this, testPath);
-      if(getErrorCode() < 0)
+      // Tiles imported on demand have no image array, their pixel type is recorded with their file
+      if(MontageImportHelper::GetTileSourceFilePath(dc).isEmpty())
+      {
+        IDataArray::Pointer imagePtr = dca->getPrereqIDataArrayFromPath(this, testPath);
+        if(getErrorCode() < 0)
+        {
+          return;
+        }
+      }
+      else if(nullptr == MontageImportHelper::GetTilePixelArray(dc, getCommonAttributeMatrixName(), getCommonDataArrayName()))
       {
+        QString ss = QObject::tr("The pixel type of the tile '%1' loaded on demand is not recorded").arg(dcName);
+        setErrorCondition(-11010, ss);
         return;
       }
 
@@ -309,8 +488,11 @@ void ITKPCMTileRegistration::execute()
   {
     return;
   }
+  ITKExecutionPolicy::Apply();
+  ITKFFTPlanCache::ScopedConfiguration fftPlans(m_MeasureFFTPlans);
+  ITKFilterTelemetry telemetry(this);
 
-  IDataArray::Pointer da = m_DataContainers[0]->getAttributeMatrix(getCommonAttributeMatrixName())->getAttributeArray(getCommonDataArrayName());
+  IDataArray::Pointer da = MontageImportHelper::GetTilePixelArray(m_DataContainers[0], getCommonAttributeMatrixName(), getCommonDataArrayName());
 
   EXECUTE_REGISTER_FUNCTION_TEMPLATE(this, registerRGBMontage, registerGrayscaleMontage, da)
 
@@ -318,32 +500,28 @@ void ITKPCMTileRegistration::execute()
   notifyStatusMessage("Complete");
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+itk::Size<ITKPCMTileRegistration::Dimension> ITKPCMTileRegistration::getMontageSize() const
+{
+  using SizeValueType = itk::Size<Dimension>::SizeValueType;
+  itk::Size<Dimension> montageSize;
+  montageSize[0] = static_cast<SizeValueType>(m_MontageEnd[0] - m_MontageStart[0] + 1);
+  montageSize[1] = static_cast<SizeValueType>(m_MontageEnd[1] - m_MontageStart[1] + 1);
+  return montageSize;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 template <typename PixelType, typename MontageType>
-typename MontageType::Pointer ITKPCMTileRegistration::createMontage(int peakMethodToUse)
+typename MontageType::Pointer ITKPCMTileRegistration::createMontage(int peakMethodToUse, const itk::Size<Dimension>& montageSize)
 {
   using ScalarPixelType = typename itk::NumericTraits<PixelType>::ValueType;
   using ScalarImageType = itk::Image<ScalarPixelType, Dimension>;
   using PCMType = itk::PhaseCorrelationImageRegistrationMethod<ScalarImageType, ScalarImageType>;
 
-  IntVec3Type montageSize;
-  std::transform(m_MontageStart.begin(), m_MontageStart.end(), m_MontageEnd.begin(), montageSize.begin(), [](int32_t a, int32_t b) -> int32_t { return b - a + 1; });
-  int32_t rowCount = montageSize[1];
-  int32_t colCount = montageSize[0];
-
-  unsigned x1 = 1;
-  unsigned y1 = 1;
-  if(colCount < 2)
-  {
-    x1 = 0;
-  }
-  if(rowCount < 2)
-  {
-    y1 = 0;
-  }
-
 #if(ITK_VERSION_MAJOR == 5) && (ITK_VERSION_MINOR >= 1)
   using PaddingMethodEnum = typename PCMType::PaddingMethodEnum;
   using PeakInterpolationType = typename itk::MaxPhaseCorrelationOptimizer<PCMType>::PeakInterpolationMethodEnum;
@@ -353,9 +531,8 @@ typename MontageType::Pointer ITKPCMTileRegistration::createMontage(int peakMeth
 #endif
 
   // Create tile montage
-  using SizeValueType = itk::Size<2>::SizeValueType;
   typename MontageType::Pointer montage = MontageType::New();
-  montage->SetMontageSize({static_cast<SizeValueType>(colCount), static_cast<SizeValueType>(rowCount)});
+  montage->SetMontageSize(montageSize);
   montage->SetPaddingMethod(PaddingMethodEnum::MirrorWithExponentialDecay);
   //  montage->SetOriginAdjustment(originAdjustment);
   //  montage->SetForcedSpacing(sp);
@@ -379,7 +556,7 @@ typename MontageType::Pointer ITKPCMTileRegistration::createGrayscaleMontage(int
   //	using PointType = itk::Point<double, Dimension>;
   using ScalarImageType = itk::Image<ScalarPixelType, Dimension>;
 
-  typename MontageType::Pointer montage = createMontage<PixelType, MontageType>(peakMethodToUse);
+  typename MontageType::Pointer montage = createMontage<PixelType, MontageType>(peakMethodToUse, getMontageSize());
 
   // Set tile image data from DREAM3D structure into tile montage
   for(int32_t row = m_MontageStart[1]; row <= m_MontageEnd[1]; row++)
@@ -394,6 +571,14 @@ typename MontageType::Pointer ITKPCMTileRegistration::createGrayscaleMontage(int
       QString dcName = MontageImportHelper::GenerateDataContainerName(getDataContainerPrefix(), m_DataContainerPaddingDigits, row, col);
       DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(dcName);
 
+      // Tiles imported on demand are read when the montage registers them
+      QString tileFilePath = MontageImportHelper::GetTileSourceFilePath(dc);
+      if(!tileFilePath.isEmpty())
+      {
+        montage->SetInputTile(ind, MontageImportHelper::CreateTileSourceImage<ScalarImageType>(dc, tileFilePath, m_TileSources));
+        continue;
+      }
+
       using InPlaceDream3DToImageFileType = itk::InPlaceDream3DDataToImageFilter<ScalarPixelType, Dimension>;
       typename InPlaceDream3DToImageFileType::Pointer toITK = InPlaceDream3DToImageFileType::New();
       toITK->SetInput(dc);
@@ -417,12 +602,9 @@ typename MontageType::Pointer ITKPCMTileRegistration::createGrayscaleMontage(int
 template <typename PixelType, typename MontageType>
 typename MontageType::Pointer ITKPCMTileRegistration::createRGBMontage(int peakMethodToUse)
 {
-  using ScalarPixelType = typename itk::NumericTraits<PixelType>::ValueType;
-  //	using PointType = itk::Point<double, Dimension>;
-  using ScalarImageType = itk::Image<ScalarPixelType, Dimension>;
-  using OriginalImageType = itk::Image<PixelType, Dimension>;
+  using ScalarImageType = itk::Image<typename itk::NumericTraits<PixelType>::ValueType, Dimension>;
 
-  typename MontageType::Pointer montage = createMontage<PixelType, MontageType>(peakMethodToUse);
+  typename MontageType::Pointer montage = createMontage<PixelType, MontageType>(peakMethodToUse, getMontageSize());
 
   // Set tile image data from DREAM3D structure into tile montage
   for(int32_t row = m_MontageStart[1]; row <= m_MontageEnd[1]; row++)
@@ -437,23 +619,16 @@ typename MontageType::Pointer ITKPCMTileRegistration::createRGBMontage(int peakM
       QString dcName = MontageImportHelper::GenerateDataContainerName(getDataContainerPrefix(), m_DataContainerPaddingDigits, row, col);
       DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(dcName);
 
-      using InPlaceDream3DToImageFileType = itk::InPlaceDream3DDataToImageFilter<PixelType, Dimension>;
-      typename InPlaceDream3DToImageFileType::Pointer toITK = InPlaceDream3DToImageFileType::New();
-
-      toITK->SetInput(dc);
-      toITK->SetInPlace(true);
-      toITK->SetAttributeMatrixArrayName(getCommonAttributeMatrixName().toStdString());
-      toITK->SetDataArrayName(getCommonDataArrayName().toStdString());
-      toITK->Update();
-
-      typename OriginalImageType::Pointer image = toITK->GetOutput();
-
-      using FilterType = itk::RGBToLuminanceImageFilter<OriginalImageType, ScalarImageType>;
-      typename FilterType::Pointer filter = FilterType::New();
-      filter->SetInput(image);
-      filter->Update();
+      // The tiles imported on demand are read as scalar images, which converts the colors to luminance
+      QString tileFilePath = MontageImportHelper::GetTileSourceFilePath(dc);
+      if(!tileFilePath.isEmpty())
+      {
+        montage->SetInputTile(ind, MontageImportHelper::CreateTileSourceImage<ScalarImageType>(dc, tileFilePath, m_TileSources));
+        continue;
+      }
 
-      montage->SetInputTile(ind, filter->GetOutput());
+      // The luminance is computed by the montage, for the overlap regions only
+      montage->SetInputTile(ind, LuminanceTile<PixelType, Dimension>::Create(dc, getCommonAttributeMatrixName(), getCommonDataArrayName(), m_TileSources));
     }
   }
 
@@ -470,10 +645,17 @@ void ITKPCMTileRegistration::registerGrayscaleMontage(int peakMethodToUse, unsig
   using ScalarImageType = itk::Image<ScalarPixelType, Dimension>;
   using MontageType = itk::TileMontage<ScalarImageType>;
 
+  if(m_RegistrationMode == k_PairBatchRegistration)
+  {
+    registerPairBatches<PixelType>(peakMethodToUse);
+    return;
+  }
+
   typename MontageType::Pointer montage = createGrayscaleMontage<PixelType, MontageType>(peakMethodToUse);
 
   // Execute the montage registration algorithm
   executeMontageRegistration<MontageType>(montage);
+  m_TileSources.clear();
 
   // Store tile registration transforms in DREAM3D data containers
   storeMontageTransforms<MontageType>(montage);
@@ -489,10 +671,17 @@ void ITKPCMTileRegistration::registerRGBMontage(int peakMethodToUse, unsigned st
   using ScalarImageType = itk::Image<ScalarPixelType, Dimension>;
   using MontageType = itk::TileMontage<ScalarImageType>;
 
+  if(m_RegistrationMode == k_PairBatchRegistration)
+  {
+    registerPairBatches<PixelType>(peakMethodToUse);
+    return;
+  }
+
   typename MontageType::Pointer montage = createRGBMontage<PixelType, MontageType>(peakMethodToUse);
 
   // Execute the montage registration algorithm
   executeMontageRegistration<MontageType>(montage);
+  m_TileSources.clear();
 
   // Store tile registration transforms in DREAM3D data containers
   storeMontageTransforms<MontageType>(montage);
@@ -533,37 +722,266 @@ void ITKPCMTileRegistration::storeMontageTransforms(typename MontageType::Pointe
       ind[0] = static_cast<::itk::SizeValueType>(col - m_MontageStart[0]);
 
       const TransformType* regTr = montage->GetOutputTransform(ind);
+      storeTileTransform(row, col, regTr->GetOffset());
+    }
+  }
+}
 
-      // Get our DataContainer Name using a Prefix and a rXXcYY format.
-      QString dcName = MontageImportHelper::GenerateDataContainerName(getDataContainerPrefix(), m_DataContainerPaddingDigits, row, col);
-      DataContainer::Pointer imageDC = getDataContainerArray()->getDataContainer(dcName);
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKPCMTileRegistration::storeTileTransform(int32_t row, int32_t col, const itk::Vector<double, Dimension>& offset)
+{
+  // Get our DataContainer Name using a Prefix and a rXXcYY format.
+  QString dcName = MontageImportHelper::GenerateDataContainerName(getDataContainerPrefix(), m_DataContainerPaddingDigits, row, col);
+  DataContainer::Pointer imageDC = getDataContainerArray()->getDataContainer(dcName);
+
+  ImageGeom::Pointer image = imageDC->getGeometryAs<ImageGeom>();
+
+  // Create an ITK affine transform as a reference
+  AffineType::Pointer itkAffine = AffineType::New();
+  AffineType::TranslationType t;
+  t.Fill(0);
+  for(unsigned i = 0; i < Dimension; i++)
+  {
+    t[i] = offset[i];
+  }
+  itkAffine->SetTranslation(t);
+
+  using FilterType = itk::TransformToDream3DITransformContainer<double, 3>;
 
-      ImageGeom::Pointer image = imageDC->getGeometryAs<ImageGeom>();
+  FilterType::Pointer filter = FilterType::New();
+  filter->SetInput(itkAffine);
+  filter->Update();
+  ::ITransformContainer::Pointer convertedITransformContainer = filter->GetOutput()->Get();
+  ::TransformContainer::Pointer convertedTransformContainer = std::dynamic_pointer_cast<::TransformContainer>(convertedITransformContainer);
 
-      // Create an ITK affine transform as a reference
-      AffineType::Pointer itkAffine = AffineType::New();
-      AffineType::TranslationType t;
-      t.Fill(0);
-      for(unsigned i = 0; i < TransformType::SpaceDimension; i++)
+  image->setTransformContainer(convertedTransformContainer);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename PixelType>
+void ITKPCMTileRegistration::registerPairBatches(int peakMethodToUse)
+{
+  using ScalarPixelType = typename itk::NumericTraits<PixelType>::ValueType;
+
+  const itk::Size<Dimension> montageSize = getMontageSize();
+  const size_t numCols = montageSize[0];
+  const size_t numRows = montageSize[1];
+  const size_t numTiles = numCols * numRows;
+
+  // m_DataContainers holds the tiles in row-major order. Within a batch no tile belongs to two pairs, so the
+  // pairs of a batch never read the same tile at the same time.
+  std::array<std::vector<DetermineStitching::TilePair>, 4> batches = DetermineStitching::CreatePairBatches(numCols, numRows);
+
+  ImageGeom::Pointer firstImage = m_DataContainers[0]->getGeometryAs<ImageGeom>();
+  const FloatVec3Type spacing = firstImage->getSpacing();
+  const SizeVec3Type tileDims = firstImage->getDimensions();
+  const uint32_t maximumPairs = GetMaximumConcurrentTilePairs(tileDims[0] * tileDims[1], sizeof(ScalarPixelType));
+
+  std::vector<DetermineStitching::TilePair> pairs;
+  size_t failedPairs = 0;
+  for(size_t b = 0; b < batches.size(); b++)
+  {
+    std::vector<DetermineStitching::TilePair>& batch = batches[b];
+    if(batch.empty())
+    {
+      continue;
+    }
+    notifyStatusMessage(QObject::tr("Registering tile pairs (batch %1 of %2)").arg(b + 1).arg(batches.size()));
+
+    const bool horizontal = b < 2;
+    std::vector<itk::Vector<double, Dimension>> offsets(batch.size());
+    std::vector<uint8_t> registered(batch.size(), 0);
+    ParallelTaskAlgorithm taskAlg;
+    taskAlg.setMaxQueueSize(maximumPairs);
+    for(size_t p = 0; p < batch.size(); p++)
+    {
+      taskAlg.execute([&, p]() { registered[p] = registerTilePair<PixelType>(peakMethodToUse, batch[p].Neighbour, batch[p].Current, horizontal, offsets[p]) ? 1 : 0; });
+    }
+    taskAlg.wait();
+    if(getCancel())
+    {
+      return;
+    }
+
+    // The fit works in pixels, so that the outlier threshold does not depend on the spacing
+    for(size_t p = 0; p < batch.size(); p++)
+    {
+      DetermineStitching::TilePair pair = batch[p];
+      if(registered[p] != 0)
+      {
+        pair.X = offsets[p][0] / spacing[0];
+        pair.Y = offsets[p][1] / spacing[1];
+      }
+      else
+      {
+        pair.Weight = k_FailedPairWeight;
+        failedPairs++;
+      }
+      pairs.push_back(pair);
+    }
+  }
+
+  notifyStatusMessage("Placing the tiles");
+  std::vector<float> origins;
+  if(!DetermineStitching::SolvePairOffsets(numTiles, pairs, true, origins))
+  {
+    QString ss = QObject::tr("The tiles could not be placed from the offsets of the %1 tile pairs").arg(pairs.size());
+    setErrorCondition(-11008, ss);
+    return;
+  }
+  if(failedPairs > 0)
+  {
+    QString ss = QObject::tr("%1 of the %2 tile pairs could not be registered. Their tiles were placed from their other neighbours.").arg(failedPairs).arg(pairs.size());
+    setWarningCondition(-11009, ss);
+  }
+
+  for(int32_t row = m_MontageStart[1]; row <= m_MontageEnd[1]; row++)
+  {
+    for(int32_t col = m_MontageStart[0]; col <= m_MontageEnd[0]; col++)
+    {
+      const size_t i = static_cast<size_t>(row - m_MontageStart[1]) * numCols + static_cast<size_t>(col - m_MontageStart[0]);
+      itk::Vector<double, Dimension> offset;
+      offset[0] = origins[2 * i] * spacing[0];
+      offset[1] = origins[2 * i + 1] * spacing[1];
+      storeTileTransform(row, col, offset);
+    }
+  }
+  notifyStatusMessage("Finished the tile registrations");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename PixelType>
+bool ITKPCMTileRegistration::registerTilePair(int peakMethodToUse, size_t first, size_t second, bool horizontal, itk::Vector<double, Dimension>& offset)
+{
+  using ScalarPixelType = typename itk::NumericTraits<PixelType>::ValueType;
+  using ScalarImageType = itk::Image<ScalarPixelType, Dimension>;
+
+  if(getCancel())
+  {
+    return false;
+  }
+
+  try
+  {
+    const std::array<size_t, 2> tiles = {first, second};
+    std::array<typename ScalarImageType::Pointer, 2> images;
+    std::vector<itk::ProcessObject::Pointer> sources;
+    for(size_t t = 0; t < tiles.size(); t++)
+    {
+      const DataContainer::Pointer& dc = m_DataContainers[tiles[t]];
+      // Tiles imported on demand are read by the montage of each of their pairs
+      QString tileFilePath = MontageImportHelper::GetTileSourceFilePath(dc);
+      if(!tileFilePath.isEmpty())
+      {
+        images[t] = MontageImportHelper::CreateTileSourceImage<ScalarImageType>(dc, tileFilePath, sources);
+      }
+      else
       {
-        t[i] = regTr->GetOffset()[i];
+        images[t] = ScalarTile<PixelType, Dimension>::Create(dc, getCommonAttributeMatrixName(), getCommonDataArrayName(), sources);
       }
-      itkAffine->SetTranslation(t);
+    }
+    for(const itk::ProcessObject::Pointer& source : sources)
+    {
+      ITKExecutionPolicy::ApplyToNestedFilter(source);
+    }
 
-      TransformContainer::Pointer transformContainer = GetTransformContainerFromITKAffineTransform(itkAffine);
-      auto containerParameters = transformContainer->getParameters();
-      auto containerFixedParameters = transformContainer->getFixedParameters();
-      using FilterType = itk::TransformToDream3DITransformContainer<double, 3>;
+    if(m_CoarseRegistrationFactor <= 1)
+    {
+      offset = registerImagePair<PixelType>(peakMethodToUse, horizontal, images[0].GetPointer(), images[1].GetPointer());
+      return true;
+    }
 
-      FilterType::Pointer filter = FilterType::New();
-      filter->SetInput(itkAffine);
-      filter->Update();
-      ::ITransformContainer::Pointer convertedITransformContainer = filter->GetOutput()->Get();
-      ::TransformContainer::Pointer convertedTransformContainer = std::dynamic_pointer_cast<::TransformContainer>(convertedITransformContainer);
+    // COARSE: both tiles bin-shrunk by the factor, which keeps their physical extent, so the offset needs no scaling
+    using ShrinkFilterType = itk::BinShrinkImageFilter<ScalarImageType, ScalarImageType>;
+    std::array<typename ScalarImageType::Pointer, 2> coarseImages;
+    for(size_t t = 0; t < images.size(); t++)
+    {
+      typename ShrinkFilterType::Pointer shrink = ShrinkFilterType::New();
+      shrink->SetInput(images[t]);
+      shrink->SetShrinkFactors(static_cast<unsigned int>(m_CoarseRegistrationFactor));
+      ITKExecutionPolicy::ApplyToNestedFilter(shrink);
+      shrink->Update();
+      coarseImages[t] = shrink->GetOutput();
+    }
+    const itk::Vector<double, Dimension> coarseOffset = registerImagePair<PixelType>(peakMethodToUse, horizontal, coarseImages[0].GetPointer(), coarseImages[1].GetPointer());
+
+    // FINE: full resolution patch of the overlap, enlarged along the pair by the coarse offset and a search radius of
+    // twice the factor (for the rounding of the shrunk tiles)
+    itk::Vector<double, Dimension> radius;
+    itk::Vector<double, Dimension> margin;
+    for(unsigned d = 0; d < Dimension; d++)
+    {
+      radius[d] = 2.0 * m_CoarseRegistrationFactor * images[0]->GetSpacing()[d];
+      margin[d] = std::abs(coarseOffset[d]) + radius[d];
+    }
+    using ExtractFilterType = itk::RegionOfInterestImageFilter<ScalarImageType, ScalarImageType>;
+    std::array<typename ScalarImageType::Pointer, 2> patches;
+    for(size_t t = 0; t < images.size(); t++)
+    {
+      const typename ScalarImageType::RegionType region = GetRefinementRegion<ScalarImageType, Dimension>(images[t], images[0], images[1], horizontal, margin);
+      if(region.GetNumberOfPixels() == 0)
+      {
+        offset = coarseOffset;
+        return true;
+      }
+      // The patch keeps the physical position of its region, so the offset is still relative to the whole tiles
+      typename ExtractFilterType::Pointer extract = ExtractFilterType::New();
+      extract->SetInput(images[t]);
+      extract->SetRegionOfInterest(region);
+      extract->Update();
+      patches[t] = extract->GetOutput();
+    }
+    const itk::Vector<double, Dimension> fineOffset = registerImagePair<PixelType>(peakMethodToUse, horizontal, patches[0].GetPointer(), patches[1].GetPointer());
 
-      image->setTransformContainer(convertedTransformContainer);
+    // A peak outside the search radius is a false match of the smaller patches, the coarse estimate is kept then
+    offset = fineOffset;
+    for(unsigned d = 0; d < Dimension; d++)
+    {
+      if(std::abs(fineOffset[d] - coarseOffset[d]) > radius[d])
+      {
+        offset = coarseOffset;
+        break;
+      }
     }
+  } catch(itk::ExceptionObject&)
+  {
+    return false;
   }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename PixelType, typename ImageType>
+itk::Vector<double, ITKPCMTileRegistration::Dimension> ITKPCMTileRegistration::registerImagePair(int peakMethodToUse, bool horizontal, ImageType* firstImage, ImageType* secondImage)
+{
+  using MontageType = itk::TileMontage<ImageType>;
+
+  itk::Size<Dimension> pairSize;
+  pairSize[0] = horizontal ? 2 : 1;
+  pairSize[1] = horizontal ? 1 : 2;
+
+  typename MontageType::TileIndexType firstInd;
+  firstInd[0] = 0;
+  firstInd[1] = 0;
+  typename MontageType::TileIndexType secondInd;
+  secondInd[0] = horizontal ? 1 : 0;
+  secondInd[1] = horizontal ? 0 : 1;
+
+  typename MontageType::Pointer montage = createMontage<PixelType, MontageType>(peakMethodToUse, pairSize);
+  montage->SetInputTile(firstInd, firstImage);
+  montage->SetInputTile(secondInd, secondImage);
+  ITKExecutionPolicy::ApplyToNestedFilter(montage);
+  montage->Update();
+
+  return montage->GetOutputTransform(secondInd)->GetOffset();
 }
 
 // -----------------------------------------------------------------------------
@@ -769,3 +1187,39 @@ int32_t ITKPCMTileRegistration::getDataContainerPaddingDigits() const
 {
   return m_DataContainerPaddingDigits;
 }
+
+// -----------------------------------------------------------------------------
+void ITKPCMTileRegistration::setRegistrationMode(int value)
+{
+  m_RegistrationMode = value;
+}
+
+// -----------------------------------------------------------------------------
+int ITKPCMTileRegistration::getRegistrationMode() const
+{
+  return m_RegistrationMode;
+}
+
+// -----------------------------------------------------------------------------
+void ITKPCMTileRegistration::setMeasureFFTPlans(bool value)
+{
+  m_MeasureFFTPlans = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ITKPCMTileRegistration::getMeasureFFTPlans() const
+{
+  return m_MeasureFFTPlans;
+}
+
+// -----------------------------------------------------------------------------
+void ITKPCMTileRegistration::setCoarseRegistrationFactor(int value)
+{
+  m_CoarseRegistrationFactor = value;
+}
+
+// -----------------------------------------------------------------------------
+int ITKPCMTileRegistration::getCoarseRegistrationFactor() const
+{
+  return m_CoarseRegistrationFactor;
+}
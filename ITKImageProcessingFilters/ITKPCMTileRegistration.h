@@ -72,6 +72,9 @@ class ITKImageProcessing_EXPORT ITKPCMTileRegistration : public AbstractFilter
   PYB11_PROPERTY(QString DataContainerPrefix READ getDataContainerPrefix WRITE setDataContainerPrefix)
   PYB11_PROPERTY(QString CommonAttributeMatrixName READ getCommonAttributeMatrixName WRITE setCommonAttributeMatrixName)
   PYB11_PROPERTY(QString CommonDataArrayName READ getCommonDataArrayName WRITE setCommonDataArrayName)
+  PYB11_PROPERTY(int RegistrationMode READ getRegistrationMode WRITE setRegistrationMode)
+  PYB11_PROPERTY(bool MeasureFFTPlans READ getMeasureFFTPlans WRITE setMeasureFFTPlans)
+  PYB11_PROPERTY(int CoarseRegistrationFactor READ getCoarseRegistrationFactor WRITE setCoarseRegistrationFactor)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -163,6 +166,39 @@ public:
   QString getCommonDataArrayName() const;
   Q_PROPERTY(QString CommonDataArrayName READ getCommonDataArrayName WRITE setCommonDataArrayName)
 
+  /**
+   * @brief Setter property for RegistrationMode
+   */
+  void setRegistrationMode(int value);
+  /**
+   * @brief Getter property for RegistrationMode
+   * @return Value of RegistrationMode
+   */
+  int getRegistrationMode() const;
+  Q_PROPERTY(int RegistrationMode READ getRegistrationMode WRITE setRegistrationMode)
+
+  /**
+   * @brief Setter property for MeasureFFTPlans
+   */
+  void setMeasureFFTPlans(bool value);
+  /**
+   * @brief Getter property for MeasureFFTPlans
+   * @return Value of MeasureFFTPlans
+   */
+  bool getMeasureFFTPlans() const;
+  Q_PROPERTY(bool MeasureFFTPlans READ getMeasureFFTPlans WRITE setMeasureFFTPlans)
+
+  /**
+   * @brief Setter property for CoarseRegistrationFactor
+   */
+  void setCoarseRegistrationFactor(int value);
+  /**
+   * @brief Getter property for CoarseRegistrationFactor
+   * @return Value of CoarseRegistrationFactor
+   */
+  int getCoarseRegistrationFactor() const;
+  Q_PROPERTY(int CoarseRegistrationFactor READ getCoarseRegistrationFactor WRITE setCoarseRegistrationFactor)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -247,6 +283,16 @@ protected:
   template <typename PixelType>
   void registerRGBMontage(int peakMethodToUse = 0, unsigned streamSubdivisions = 1);
 
+  /**
+   * @brief registerPairBatches Registers each pair of neighbouring tiles on its own, in four batches (horizontal
+   * pairs starting on even and odd columns, vertical pairs starting on even and odd rows) in which no tile belongs
+   * to two pairs. The pairs of a batch are registered in parallel, as many at once as the memory budget allows,
+   * then the tile offsets are fitted to all the pair offsets at once.
+   * @param peakMethodToUse
+   */
+  template <typename PixelType>
+  void registerPairBatches(int peakMethodToUse = 0);
+
   /**
    * @brief Get the image from the appropriate data container
    * @param y
@@ -269,17 +315,29 @@ private:
   QString m_DataContainerPrefix = {ITKImageProcessing::Montage::k_DataContainerPrefixDefaultName};
   QString m_CommonAttributeMatrixName = {ITKImageProcessing::Montage::k_TileAttributeMatrixDefaultName};
   QString m_CommonDataArrayName = {ITKImageProcessing::Montage::k_TileDataArrayDefaultName};
+  int m_RegistrationMode = {0};
+  bool m_MeasureFFTPlans = {false};
+  int m_CoarseRegistrationFactor = {1};
 
   static constexpr unsigned Dimension = 2;
   std::vector<DataContainer::Pointer> m_DataContainers;
+  // Filters computing the luminance of the colour tiles or reading the tiles loaded on demand, kept while the
+  // montage requests their regions
+  std::vector<itk::ProcessObject::Pointer> m_TileSources;
+
+  /**
+   * @brief getMontageSize Returns the number of columns and rows of tiles registered
+   * @return
+   */
+  itk::Size<Dimension> getMontageSize() const;
 
   /**
    * @brief createMontage
    * @param peakMethodToUse
-   * @param streamSubdivisions
+   * @param montageSize Number of columns and rows of tiles of the montage
    */
   template <typename PixelType, typename MontageType>
-  typename MontageType::Pointer createMontage(int peakMethodToUse = 0);
+  typename MontageType::Pointer createMontage(int peakMethodToUse, const itk::Size<Dimension>& montageSize);
 
   /**
    * @brief createGrayscaleMontage
@@ -303,6 +361,39 @@ private:
   template <typename MontageType>
   void storeMontageTransforms(typename MontageType::Pointer montage);
 
+  /**
+   * @brief storeTileTransform Stores the registration offset of a tile as the transform of its geometry
+   * @param row
+   * @param col
+   * @param offset
+   */
+  void storeTileTransform(int32_t row, int32_t col, const itk::Vector<double, Dimension>& offset);
+
+  /**
+   * @brief registerTilePair Registers two neighbouring tiles as a montage of two tiles. With a CoarseRegistrationFactor
+   * larger than 1, the tiles are first registered bin-shrunk by the factor, then the offset is refined at full
+   * resolution on a patch of their overlap.
+   * @param peakMethodToUse
+   * @param first Index of the left or top tile in m_DataContainers
+   * @param second Index of the right or bottom tile in m_DataContainers
+   * @param horizontal Whether the second tile is on the right of the first one, or below it
+   * @param offset Set to the offset of the second tile relative to the first one
+   * @return false when the registration failed
+   */
+  template <typename PixelType>
+  bool registerTilePair(int peakMethodToUse, size_t first, size_t second, bool horizontal, itk::Vector<double, Dimension>& offset);
+
+  /**
+   * @brief registerImagePair Registers two images as a montage of two tiles. Throws the exceptions of the montage.
+   * @param peakMethodToUse
+   * @param horizontal Whether the second image is on the right of the first one, or below it
+   * @param firstImage
+   * @param secondImage
+   * @return Offset of the second image relative to the first one
+   */
+  template <typename PixelType, typename ImageType>
+  itk::Vector<double, Dimension> registerImagePair(int peakMethodToUse, bool horizontal, ImageType* firstImage, ImageType* secondImage);
+
   /**
    * @brief executeMontageRegistration
    * @param montage
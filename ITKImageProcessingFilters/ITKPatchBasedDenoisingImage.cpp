@@ -4,6 +4,9 @@
 
 #include "ITKPatchBasedDenoisingImage.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
@@ -79,9 +82,11 @@ void ITKPatchBasedDenoisingImage::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_DOUBLE_FP("KernelBandwidthUpdateFrequency", KernelBandwidthUpdateFrequency, FilterParameter::Category::Parameter, ITKPatchBasedDenoisingImage));
   parameters.push_back(
       SIMPL_NEW_DOUBLE_FP("KernelBandwidthFractionPixelsForEstimation", KernelBandwidthFractionPixelsForEstimation, FilterParameter::Category::Parameter, ITKPatchBasedDenoisingImage));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Single Precision Intermediate", SinglePrecisionIntermediate, FilterParameter::Category::Parameter, ITKPatchBasedDenoisingImage));
 
   std::vector<QString> linkedProps;
   linkedProps.push_back("NewCellArrayName");
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Category::Parameter, ITKPatchBasedDenoisingImage, linkedProps));
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -91,6 +96,8 @@ void ITKPatchBasedDenoisingImage::setupFilterParameters()
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::CreatedArray));
   parameters.push_back(SIMPL_NEW_STRING_FP("Filtered Array", NewCellArrayName, FilterParameter::Category::CreatedArray, ITKPatchBasedDenoisingImage));
 
+  setupExecutionFilterParameters(parameters);
+
   setFilterParameters(parameters);
 }
 
@@ -102,6 +109,7 @@ void ITKPatchBasedDenoisingImage::readFilterParameters(AbstractFilterParametersR
   reader->openFilterGroup(this, index);
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
+  setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
   setKernelBandwidthSigma(reader->readValue("KernelBandwidthSigma", getKernelBandwidthSigma()));
   setPatchRadius(reader->readValue("PatchRadius", getPatchRadius()));
   setNumberOfIterations(reader->readValue("NumberOfIterations", getNumberOfIterations()));
@@ -114,6 +122,8 @@ void ITKPatchBasedDenoisingImage::readFilterParameters(AbstractFilterParametersR
   setKernelBandwidthMultiplicationFactor(reader->readValue("KernelBandwidthMultiplicationFactor", getKernelBandwidthMultiplicationFactor()));
   setKernelBandwidthUpdateFrequency(reader->readValue("KernelBandwidthUpdateFrequency", getKernelBandwidthUpdateFrequency()));
   setKernelBandwidthFractionPixelsForEstimation(reader->readValue("KernelBandwidthFractionPixelsForEstimation", getKernelBandwidthFractionPixelsForEstimation()));
+  setSinglePrecisionIntermediate(reader->readValue("SinglePrecisionIntermediate", getSinglePrecisionIntermediate()));
+  readExecutionFilterParameters(reader);
 
   reader->closeFilterGroup();
 }
@@ -142,7 +152,15 @@ void ITKPatchBasedDenoisingImage::dataCheck()
 {
   clearErrorCode();
   clearWarningCode();
-  Dream3DArraySwitchMacroOutputType(this->dataCheckImpl, getSelectedCellArrayPath(), -4, double, 0);
+  // The denoised image is computed and stored as a real image, in single precision if requested
+  if(getSinglePrecisionIntermediate())
+  {
+    Dream3DArraySwitchMacroOutputType(this->dataCheckImpl, getSelectedCellArrayPath(), -4, float, 0);
+  }
+  else
+  {
+    Dream3DArraySwitchMacroOutputType(this->dataCheckImpl, getSelectedCellArrayPath(), -4, double, 0);
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -202,7 +220,33 @@ void ITKPatchBasedDenoisingImage::filter()
 // -----------------------------------------------------------------------------
 void ITKPatchBasedDenoisingImage::filterInternal()
 {
-  Dream3DArraySwitchMacroOutputType(this->filter, getSelectedCellArrayPath(), -4, double, 0);
+  // The denoised image is computed and stored as a real image, in single precision if requested
+  if(getSinglePrecisionIntermediate())
+  {
+    Dream3DArraySwitchMacroOutputType(this->filter, getSelectedCellArrayPath(), -4, float, 0);
+  }
+  else
+  {
+    Dream3DArraySwitchMacroOutputType(this->filter, getSelectedCellArrayPath(), -4, double, 0);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKPatchBasedDenoisingImage::getWorkingMemoryPerPixel(size_t /*inputPixelSize*/, size_t outputPixelSize, unsigned int /*dimension*/) const
+{
+  // Floating point copy of the input, solution and update buffer
+  return static_cast<double>(3 * outputPixelSize);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKPatchBasedDenoisingImage::getRelativeCost(unsigned int dimension) const
+{
+  // Every sampled patch is compared with the patch of each pixel at each iteration
+  return std::pow(2.0 * m_PatchRadius + 1.0, dimension) * std::max(m_NumberOfSamplePatches, 1.0) * std::max(m_NumberOfIterations, 1.0);
 }
 
 // -----------------------------------------------------------------------------
@@ -438,3 +482,15 @@ int ITKPatchBasedDenoisingImage::getNumberOfThreads() const
 {
   return m_NumberOfThreads;
 }
+
+// -----------------------------------------------------------------------------
+void ITKPatchBasedDenoisingImage::setSinglePrecisionIntermediate(bool value)
+{
+  m_SinglePrecisionIntermediate = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ITKPatchBasedDenoisingImage::getSinglePrecisionIntermediate() const
+{
+  return m_SinglePrecisionIntermediate;
+}
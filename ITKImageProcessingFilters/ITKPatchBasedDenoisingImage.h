@@ -49,6 +49,7 @@ class ITKImageProcessing_EXPORT ITKPatchBasedDenoisingImage : public ITKImagePro
   PYB11_PROPERTY(double KernelBandwidthFractionPixelsForEstimation READ getKernelBandwidthFractionPixelsForEstimation WRITE setKernelBandwidthFractionPixelsForEstimation)
   PYB11_PROPERTY(int NoiseModel READ getNoiseModel WRITE setNoiseModel)
   PYB11_PROPERTY(int NumberOfThreads READ getNumberOfThreads WRITE setNumberOfThreads)
+  PYB11_PROPERTY(bool SinglePrecisionIntermediate READ getSinglePrecisionIntermediate WRITE setSinglePrecisionIntermediate)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -227,6 +228,17 @@ public:
   int getNumberOfThreads() const;
   Q_PROPERTY(int NumberOfThreads READ getNumberOfThreads WRITE setNumberOfThreads)
 
+  /**
+   * @brief Setter property for SinglePrecisionIntermediate
+   */
+  void setSinglePrecisionIntermediate(bool value);
+  /**
+   * @brief Getter property for SinglePrecisionIntermediate
+   * @return Value of SinglePrecisionIntermediate
+   */
+  bool getSinglePrecisionIntermediate() const;
+  Q_PROPERTY(bool SinglePrecisionIntermediate READ getSinglePrecisionIntermediate WRITE setSinglePrecisionIntermediate)
+
   /**
    * @brief newFilterInstance Reimplemented from @see AbstractFilter class
    */
@@ -283,6 +295,16 @@ protected:
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
 
+  /**
+   * @brief getWorkingMemoryPerPixel Reimplemented from @see ITKImageProcessingBase class
+   */
+  double getWorkingMemoryPerPixel(size_t inputPixelSize, size_t outputPixelSize, unsigned int dimension) const override;
+
+  /**
+   * @brief getRelativeCost Reimplemented from @see ITKImageProcessingBase class
+   */
+  double getRelativeCost(unsigned int dimension) const override;
+
 public:
   ITKPatchBasedDenoisingImage(const ITKPatchBasedDenoisingImage&) = delete;            // Copy Constructor Not Implemented
   ITKPatchBasedDenoisingImage(ITKPatchBasedDenoisingImage&&) = delete;                 // Move Constructor Not Implemented
@@ -304,6 +326,7 @@ private:
   double m_KernelBandwidthFractionPixelsForEstimation = {};
   int m_NoiseModel = {};
   int m_NumberOfThreads = {};
+  bool m_SinglePrecisionIntermediate = false;
 };
 
 #ifdef __clang__
@@ -104,6 +104,11 @@ protected:
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageProcessingBase class
+   */
+  bool isStreamable() const override;
+
 public:
   ITKRGBToLuminanceImage(const ITKRGBToLuminanceImage&) = delete;            // Copy Constructor Not Implemented
   ITKRGBToLuminanceImage(ITKRGBToLuminanceImage&&) = delete;                 // Move Constructor Not Implemented
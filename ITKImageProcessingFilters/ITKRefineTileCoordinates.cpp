@@ -23,6 +23,7 @@
 #include "SIMPLib/Geometry/ImageGeom.h"
 
 #include "ITKImageProcessing/ITKImageProcessingFilters/util/DetermineStitching.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/ITKFFTPlanCache.h"
 
 /* Create Enumerations to allow the created Attribute Arrays to take part in renaming */
 enum createdPathID : RenameDataPath::DataID_t
@@ -73,6 +74,26 @@ void ITKRefineTileCoordinates::setupFilterParameters()
   }
 
   parameters.push_back(SIMPL_NEW_FLOAT_FP("Tile Overlap (Percent)", TileOverlap, FilterParameter::Category::RequiredArray, ITKRefineTileCoordinates));
+  {
+    LinkedChoicesFilterParameter::Pointer parameter = LinkedChoicesFilterParameter::New();
+    parameter->setHumanLabel("Placement Method");
+    parameter->setPropertyName("PlacementMethod");
+    parameter->setSetterCallback(SIMPL_BIND_SETTER(ITKRefineTileCoordinates, this, PlacementMethod));
+    parameter->setGetterCallback(SIMPL_BIND_GETTER(ITKRefineTileCoordinates, this, PlacementMethod));
+    std::vector<QString> choices;
+    choices.push_back("Chained From Neighbours");
+    choices.push_back("Global Least Squares");
+    parameter->setChoices(choices);
+    std::vector<QString> linkedProps;
+    linkedProps.push_back("RejectOutlierPairs");
+    parameter->setLinkedProperties(linkedProps);
+    parameter->setEditable(false);
+    parameter->setCategory(FilterParameter::Category::Parameter);
+    parameters.push_back(parameter);
+  }
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Reject Outlier Pairs", RejectOutlierPairs, FilterParameter::Category::Parameter, ITKRefineTileCoordinates, 1));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Coarse Registration Factor", CoarseRegistrationFactor, FilterParameter::Category::Parameter, ITKRefineTileCoordinates));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Measure and Cache FFT Plans", MeasureFFTPlans, FilterParameter::Category::Parameter, ITKRefineTileCoordinates));
   parameters.push_back(SIMPL_NEW_BOOL_FP("Apply Refined Origin to Geometries", ApplyRefinedOrigin, FilterParameter::Category::Parameter, ITKRefineTileCoordinates));
 
   MultiDataContainerSelectionFilterParameter::RequirementType req;
@@ -229,6 +250,18 @@ void ITKRefineTileCoordinates::dataCheck()
   {
     return;
   }
+
+  if(m_PlacementMethod < 0 || m_PlacementMethod > 1)
+  {
+    setErrorCondition(-53009, "The 'Placement Method' must be 0 (Chained From Neighbours) or 1 (Global Least Squares).");
+    return;
+  }
+
+  if(m_CoarseRegistrationFactor < 1)
+  {
+    setErrorCondition(-53010, "The 'Coarse Registration Factor' must be at least 1 (1 registers the full resolution overlaps only).");
+    return;
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -271,7 +304,9 @@ void executeRefinement(ITKRefineTileCoordinates* filter)
   // Otherwise, we're not using the zeiss data method so call this and let everything work itself out
   IntVec3Type tileDims = filter->getMontageSize();
   FloatArrayType::Pointer coordsPtr =
-      DetermineStitching::FindGlobalOrigins<T, 3>(filter, tileDims[0], tileDims[1], filter->getImportMode(), filter->getTileOverlap(), pointers, udims, origin, spacing, dataContainerNames);
+      DetermineStitching::FindGlobalOrigins<T, 3>(filter, tileDims[0], tileDims[1], filter->getImportMode(), filter->getTileOverlap(),
+                                                  static_cast<DetermineStitching::PlacementMethod>(filter->getPlacementMethod()), filter->getRejectOutlierPairs(),
+                                                  static_cast<unsigned int>(filter->getCoarseRegistrationFactor()), pointers, udims, origin, spacing, dataContainerNames);
 
   // Check for cancel...
   if(filter->getCancel())
@@ -342,6 +377,7 @@ void ITKRefineTileCoordinates::execute()
   }
   clearErrorCode();
   clearWarningCode();
+  ITKFFTPlanCache::ScopedConfiguration fftPlans(m_MeasureFFTPlans);
 
   ArrayType arrayType = getArrayType();
 
@@ -538,3 +574,51 @@ bool ITKRefineTileCoordinates::getApplyRefinedOrigin() const
 {
   return m_ApplyRefinedOrigin;
 }
+
+// -----------------------------------------------------------------------------
+void ITKRefineTileCoordinates::setPlacementMethod(int value)
+{
+  m_PlacementMethod = value;
+}
+
+// -----------------------------------------------------------------------------
+int ITKRefineTileCoordinates::getPlacementMethod() const
+{
+  return m_PlacementMethod;
+}
+
+// -----------------------------------------------------------------------------
+void ITKRefineTileCoordinates::setRejectOutlierPairs(bool value)
+{
+  m_RejectOutlierPairs = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ITKRefineTileCoordinates::getRejectOutlierPairs() const
+{
+  return m_RejectOutlierPairs;
+}
+
+// -----------------------------------------------------------------------------
+void ITKRefineTileCoordinates::setCoarseRegistrationFactor(int value)
+{
+  m_CoarseRegistrationFactor = value;
+}
+
+// -----------------------------------------------------------------------------
+int ITKRefineTileCoordinates::getCoarseRegistrationFactor() const
+{
+  return m_CoarseRegistrationFactor;
+}
+
+// -----------------------------------------------------------------------------
+void ITKRefineTileCoordinates::setMeasureFFTPlans(bool value)
+{
+  m_MeasureFFTPlans = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ITKRefineTileCoordinates::getMeasureFFTPlans() const
+{
+  return m_MeasureFFTPlans;
+}
@@ -37,6 +37,10 @@ class ITKImageProcessing_EXPORT ITKRefineTileCoordinates : public AbstractFilter
   PYB11_PROPERTY(int ImportMode READ getImportMode WRITE setImportMode)
   PYB11_PROPERTY(float TileOverlap READ getTileOverlap WRITE setTileOverlap)
   PYB11_PROPERTY(bool ApplyRefinedOrigin READ getApplyRefinedOrigin WRITE setApplyRefinedOrigin)
+  PYB11_PROPERTY(int PlacementMethod READ getPlacementMethod WRITE setPlacementMethod)
+  PYB11_PROPERTY(bool RejectOutlierPairs READ getRejectOutlierPairs WRITE setRejectOutlierPairs)
+  PYB11_PROPERTY(int CoarseRegistrationFactor READ getCoarseRegistrationFactor WRITE setCoarseRegistrationFactor)
+  PYB11_PROPERTY(bool MeasureFFTPlans READ getMeasureFFTPlans WRITE setMeasureFFTPlans)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -138,6 +142,50 @@ public:
   bool getApplyRefinedOrigin() const;
   Q_PROPERTY(bool ApplyRefinedOrigin READ getApplyRefinedOrigin WRITE setApplyRefinedOrigin)
 
+  /**
+   * @brief Setter property for PlacementMethod
+   */
+  void setPlacementMethod(int value);
+  /**
+   * @brief Getter property for PlacementMethod
+   * @return Value of PlacementMethod
+   */
+  int getPlacementMethod() const;
+  Q_PROPERTY(int PlacementMethod READ getPlacementMethod WRITE setPlacementMethod)
+
+  /**
+   * @brief Setter property for RejectOutlierPairs
+   */
+  void setRejectOutlierPairs(bool value);
+  /**
+   * @brief Getter property for RejectOutlierPairs
+   * @return Value of RejectOutlierPairs
+   */
+  bool getRejectOutlierPairs() const;
+  Q_PROPERTY(bool RejectOutlierPairs READ getRejectOutlierPairs WRITE setRejectOutlierPairs)
+
+  /**
+   * @brief Setter property for CoarseRegistrationFactor
+   */
+  void setCoarseRegistrationFactor(int value);
+  /**
+   * @brief Getter property for CoarseRegistrationFactor
+   * @return Value of CoarseRegistrationFactor
+   */
+  int getCoarseRegistrationFactor() const;
+  Q_PROPERTY(int CoarseRegistrationFactor READ getCoarseRegistrationFactor WRITE setCoarseRegistrationFactor)
+
+  /**
+   * @brief Setter property for MeasureFFTPlans
+   */
+  void setMeasureFFTPlans(bool value);
+  /**
+   * @brief Getter property for MeasureFFTPlans
+   * @return Value of MeasureFFTPlans
+   */
+  bool getMeasureFFTPlans() const;
+  Q_PROPERTY(bool MeasureFFTPlans READ getMeasureFFTPlans WRITE setMeasureFFTPlans)
+
   /**
    * @brief getCompiledLibraryName Returns the name of the Library that this filter is a part of
    * @return
@@ -238,6 +286,10 @@ private:
   int m_ImportMode = {};
   float m_TileOverlap = {10.0f};
   bool m_ApplyRefinedOrigin = {};
+  int m_PlacementMethod = {0};
+  bool m_RejectOutlierPairs = {true};
+  int m_CoarseRegistrationFactor = {1};
+  bool m_MeasureFFTPlans = {false};
   std::weak_ptr<DataArray<ITKImageProcessingConstants::DefaultPixelType>> m_SelectedCellArrayPtr;
   ITKImageProcessingConstants::DefaultPixelType* m_SelectedCellArray = nullptr;
   std::weak_ptr<DataArray<float>> m_StitchedCoordinatesPtr;
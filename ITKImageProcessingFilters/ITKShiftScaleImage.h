@@ -139,6 +139,11 @@ protected:
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageProcessingBase class
+   */
+  bool isStreamable() const override;
+
 public:
   ITKShiftScaleImage(const ITKShiftScaleImage&) = delete;            // Copy Constructor Not Implemented
   ITKShiftScaleImage(ITKShiftScaleImage&&) = delete;                 // Move Constructor Not Implemented
@@ -44,6 +44,7 @@ void ITKSignedDanielssonDistanceMapImage::setupFilterParameters()
 
   std::vector<QString> linkedProps;
   linkedProps.push_back("NewCellArrayName");
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Category::Parameter, ITKSignedDanielssonDistanceMapImage, linkedProps));
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -53,6 +54,8 @@ void ITKSignedDanielssonDistanceMapImage::setupFilterParameters()
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::CreatedArray));
   parameters.push_back(SIMPL_NEW_STRING_FP("Filtered Array", NewCellArrayName, FilterParameter::Category::CreatedArray, ITKSignedDanielssonDistanceMapImage));
 
+  setupExecutionFilterParameters(parameters);
+
   setFilterParameters(parameters);
 }
 
@@ -64,9 +67,11 @@ void ITKSignedDanielssonDistanceMapImage::readFilterParameters(AbstractFilterPar
   reader->openFilterGroup(this, index);
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
+  setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
   setInsideIsPositive(reader->readValue("InsideIsPositive", getInsideIsPositive()));
   setSquaredDistance(reader->readValue("SquaredDistance", getSquaredDistance()));
   setUseImageSpacing(reader->readValue("UseImageSpacing", getUseImageSpacing()));
+  readExecutionFilterParameters(reader);
 
   reader->closeFilterGroup();
 }
@@ -118,6 +123,23 @@ void ITKSignedDanielssonDistanceMapImage::filterInternal()
   Dream3DArraySwitchMacroOutputType(this->filter, getSelectedCellArrayPath(), -4, float, 0);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKSignedDanielssonDistanceMapImage::getWorkingMemoryPerPixel(size_t inputPixelSize, size_t outputPixelSize, unsigned int dimension) const
+{
+  // Inverted input, then the distance, Voronoi and vector distance maps of the inside and of the outside
+  return static_cast<double>(inputPixelSize + 2 * (inputPixelSize + outputPixelSize + dimension * sizeof(itk::OffsetValueType)));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKSignedDanielssonDistanceMapImage::getRelativeCost(unsigned int dimension) const
+{
+  return 8.0 * dimension + 2.0;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
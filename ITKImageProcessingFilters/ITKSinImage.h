@@ -106,6 +106,11 @@ protected:
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageProcessingBase class
+   */
+  bool isStreamable() const override;
+
 public:
   ITKSinImage(const ITKSinImage&) = delete;            // Copy Constructor Not Implemented
   ITKSinImage(ITKSinImage&&) = delete;                 // Move Constructor Not Implemented
@@ -34,18 +34,29 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "ITKStitchMontage.h"
 
+#include <algorithm>
+#include <cmath>
 #include <sstream>
 
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatFilterParameter.h"
 #include "SIMPLib/FilterParameters/IntFilterParameter.h"
 #include "SIMPLib/FilterParameters/IntVec2FilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedChoicesFilterParameter.h"
 #include "SIMPLib/FilterParameters/MontageSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/MultiDataContainerSelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
 #include "SIMPLib/FilterParameters/PreflightUpdatedValueFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
@@ -60,11 +71,16 @@
 #include "SIMPLib/ITK/itkTransformToDream3DTransformContainer.h"
 
 #include "ITKImageProcessing/ITKImageProcessingConstants.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/ITKExecutionPolicy.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/ITKFilterTelemetry.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/IncrementalStitching.h"
 #include "ITKImageProcessing/ITKImageProcessingFilters/util/MontageImportHelper.h"
 #include "ITKImageProcessing/ITKImageProcessingVersion.h"
 
 #include "util/MontageImportHelper.h"
 
+#include "itkBinShrinkImageFilter.h"
+#include "itkImageFileReader.h"
 #include "itkImageFileWriter.h"
 #include "itkStreamingImageFilter.h"
 #include "itkTileMergeImageFilter.h"
@@ -167,6 +183,150 @@
 
 #define EXECUTE_STITCH_FUNCTION_TEMPLATE(filter, call, inputData, ...) EXECUTE_DATATYPE_FUNCTION_TEMPLATE(filter, call, inputData, __VA_ARGS__)
 
+namespace
+{
+const int k_DataArrayOutput = 0;
+const int k_ImageFileOutput = 1;
+
+// Piece size used when the memory budget is unknown
+const size_t k_DefaultPieceBytes = 256 * 1024 * 1024;
+
+/**
+ * @brief GetStreamPieceCount Returns the number of pieces the montage is written in, so that the pixels and the
+ * accumulation buffer of one piece use at most a quarter of the memory budget. The rest is left for the tiles
+ * the piece is resampled from.
+ * @param pixelCount
+ * @param bytesPerPixel
+ * @return
+ */
+unsigned GetStreamPieceCount(size_t pixelCount, size_t bytesPerPixel)
+{
+  size_t pieceBytes = ITKExecutionPolicy::GetMemoryBudgetInBytes() / 4;
+  if(pieceBytes == 0)
+  {
+    pieceBytes = k_DefaultPieceBytes;
+  }
+  size_t pieces = (pixelCount * bytesPerPixel + pieceBytes - 1) / pieceBytes;
+  return static_cast<unsigned>(std::max<size_t>(pieces, 1));
+}
+
+/**
+ * @brief IsStreamedFileFormat Returns whether ITK can write the file format piece by piece
+ * @param filePath
+ * @return
+ */
+bool IsStreamedFileFormat(const QString& filePath)
+{
+  static const QStringList k_StreamedExtensions = {"mha", "mhd", "nrrd", "nhdr"};
+  return k_StreamedExtensions.contains(QFileInfo(filePath).suffix().toLower());
+}
+
+using RegionType = itk::ImageRegion<2>;
+
+/**
+ * @brief RegionToJson
+ * @param region
+ * @return [index x, index y, size x, size y]
+ */
+QJsonArray RegionToJson(const RegionType& region)
+{
+  return {static_cast<qint64>(region.GetIndex(0)), static_cast<qint64>(region.GetIndex(1)), static_cast<qint64>(region.GetSize(0)), static_cast<qint64>(region.GetSize(1))};
+}
+
+/**
+ * @brief RegionFromJson
+ * @param json See RegionToJson
+ * @return
+ */
+RegionType RegionFromJson(const QJsonArray& json)
+{
+  RegionType region;
+  for(unsigned d = 0; d < 2; d++)
+  {
+    region.SetIndex(d, static_cast<itk::IndexValueType>(json.at(d).toDouble()));
+    region.SetSize(d, static_cast<itk::SizeValueType>(json.at(2 + d).toDouble()));
+  }
+  return region;
+}
+
+/**
+ * @brief AlignRegion Grows a region to whole blocks of 'blockSize' x 'blockSize' pixels, the pixels averaged into
+ * one pixel of the last pyramid level, so that the levels of the region are computed from the region alone.
+ * @param region
+ * @param blockSize
+ * @param largestRegion
+ * @return
+ */
+RegionType AlignRegion(const RegionType& region, itk::IndexValueType blockSize, const RegionType& largestRegion)
+{
+  RegionType aligned;
+  RegionType::IndexType upper;
+  for(unsigned d = 0; d < 2; d++)
+  {
+    const itk::IndexValueType start = largestRegion.GetIndex(d);
+    aligned.SetIndex(d, start + (region.GetIndex(d) - start) / blockSize * blockSize);
+    upper[d] = start + ((region.GetUpperIndex()[d] - start) / blockSize + 1) * blockSize - 1;
+  }
+  aligned.SetUpperIndex(upper);
+  aligned.Crop(largestRegion);
+  return aligned;
+}
+
+/**
+ * @brief SplitRegion Splits an aligned region into the pieces written one after the other, along its rows. Each
+ * piece but the last one has a multiple of 'blockSize' rows, see AlignRegion.
+ * @param region
+ * @param pieceCount
+ * @param blockSize
+ * @return
+ */
+std::vector<RegionType> SplitRegion(const RegionType& region, unsigned pieceCount, itk::SizeValueType blockSize)
+{
+  const itk::SizeValueType rows = region.GetSize(1);
+  itk::SizeValueType pieceRows = (rows + pieceCount - 1) / pieceCount;
+  pieceRows = (pieceRows + blockSize - 1) / blockSize * blockSize;
+
+  std::vector<RegionType> pieces;
+  for(itk::SizeValueType row = 0; row < rows; row += pieceRows)
+  {
+    RegionType piece = region;
+    piece.SetIndex(1, region.GetIndex(1) + static_cast<itk::IndexValueType>(row));
+    piece.SetSize(1, std::min(pieceRows, rows - row));
+    pieces.push_back(piece);
+  }
+  return pieces;
+}
+
+/**
+ * @brief WriteImageFileRegion Writes a region of an image that is already computed to a file. A region smaller
+ * than the image is pasted into the file, which is created when it does not exist yet.
+ * @param image
+ * @param filePath
+ * @param region
+ */
+template <typename ImageType>
+void WriteImageFileRegion(ImageType* image, const QString& filePath, const RegionType& region)
+{
+  using WriterType = itk::ImageFileWriter<ImageType>;
+  const RegionType largestRegion = image->GetLargestPossibleRegion();
+  typename WriterType::Pointer writer = WriterType::New();
+  writer->SetInput(image);
+  writer->SetFileName(filePath.toStdString());
+  writer->UseCompressionOff(); // Compressed files cannot be written piece by piece
+  if(region != largestRegion)
+  {
+    itk::ImageIORegion ioRegion(2);
+    for(unsigned d = 0; d < 2; d++)
+    {
+      ioRegion.SetIndex(d, region.GetIndex(d) - largestRegion.GetIndex(d));
+      ioRegion.SetSize(d, region.GetSize(d));
+    }
+    writer->SetIORegion(ioRegion);
+  }
+  writer->Update();
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -210,9 +370,29 @@ void ITKStitchMontage::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_STRING_FP("Common Attribute Matrix", CommonAttributeMatrixName, FilterParameter::Category::RequiredArray, ITKStitchMontage));
   parameters.push_back(SIMPL_NEW_STRING_FP("Common Data Array", CommonDataArrayName, FilterParameter::Category::RequiredArray, ITKStitchMontage));
 
-  parameters.push_back(SIMPL_NEW_STRING_FP("Montage Data Container Name", MontageDataContainerName, FilterParameter::Category::CreatedArray, ITKStitchMontage));
-  parameters.push_back(SIMPL_NEW_STRING_FP("Montage Attribute Matrix Name", MontageAttributeMatrixName, FilterParameter::Category::CreatedArray, ITKStitchMontage));
-  parameters.push_back(SIMPL_NEW_STRING_FP("Montage Data Array Name", MontageDataArrayName, FilterParameter::Category::CreatedArray, ITKStitchMontage));
+  {
+    LinkedChoicesFilterParameter::Pointer parameter = LinkedChoicesFilterParameter::New();
+    parameter->setHumanLabel("Output Mode");
+    parameter->setPropertyName("OutputMode");
+    parameter->setSetterCallback(SIMPL_BIND_SETTER(ITKStitchMontage, this, OutputMode));
+    parameter->setGetterCallback(SIMPL_BIND_GETTER(ITKStitchMontage, this, OutputMode));
+    std::vector<QString> choices;
+    choices.push_back("Data Array");
+    choices.push_back("Image File");
+    parameter->setChoices(choices);
+    std::vector<QString> linkedProps = {"MontageDataContainerName", "MontageAttributeMatrixName", "MontageDataArrayName", "OutputFilePath", "IncrementalUpdate"};
+    parameter->setLinkedProperties(linkedProps);
+    parameter->setEditable(false);
+    parameter->setCategory(FilterParameter::Category::Parameter);
+    parameters.push_back(parameter);
+  }
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Pyramid Levels", PyramidLevels, FilterParameter::Category::Parameter, ITKStitchMontage));
+  parameters.push_back(SIMPL_NEW_OUTPUT_FILE_FP("Output File", OutputFilePath, FilterParameter::Category::Parameter, ITKStitchMontage, "*.mha *.mhd *.nrrd *.nhdr", "Image", k_ImageFileOutput));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Update Changed Tiles Only", IncrementalUpdate, FilterParameter::Category::Parameter, ITKStitchMontage, k_ImageFileOutput));
+
+  parameters.push_back(SIMPL_NEW_STRING_FP("Montage Data Container Name", MontageDataContainerName, FilterParameter::Category::CreatedArray, ITKStitchMontage, k_DataArrayOutput));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Montage Attribute Matrix Name", MontageAttributeMatrixName, FilterParameter::Category::CreatedArray, ITKStitchMontage, k_DataArrayOutput));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Montage Data Array Name", MontageDataArrayName, FilterParameter::Category::CreatedArray, ITKStitchMontage, k_DataArrayOutput));
 
   setFilterParameters(parameters);
 }
@@ -240,6 +420,13 @@ void ITKStitchMontage::dataCheck()
     return;
   }
 
+  if(getPyramidLevels() < 0)
+  {
+    QString ss = QObject::tr("The number of Pyramid Levels must be 0 or more.");
+    setErrorCondition(-11025, ss);
+    return;
+  }
+
   if(m_MontageSelection.getColStart() > m_MontageSelection.getColEnd())
   {
     QString ss = QObject::tr("Montage Start Column (%1) must be equal or less than Montage End Column(%2)").arg(m_MontageSelection.getColStart()).arg(m_MontageSelection.getColEnd());
@@ -337,7 +524,20 @@ void ITKStitchMontage::dataCheck()
         return;
       }
 
-      tilePtr = dca->getPrereqIDataArrayFromPath(this, testPath);
+      // Tiles imported on demand have no image array, their pixel type is recorded with their file
+      if(MontageImportHelper::GetTileSourceFilePath(dc).isEmpty())
+      {
+        tilePtr = dca->getPrereqIDataArrayFromPath(this, testPath);
+      }
+      else
+      {
+        tilePtr = MontageImportHelper::GetTilePixelArray(dc, getCommonAttributeMatrixName(), getCommonDataArrayName());
+        if(nullptr == tilePtr)
+        {
+          QString ss = QObject::tr("The pixel type of the tile '%1' loaded on demand is not recorded").arg(dcName);
+          setErrorCondition(-11027, ss);
+        }
+      }
       if(getErrorCode() < 0)
       {
         //   dclistOut << "[NOT FOUND]    R=" << row << " C=" << col << "  " << testPath.serialize();
@@ -355,6 +555,27 @@ void ITKStitchMontage::dataCheck()
     }
   }
 
+  // Both output modes resample the tiles on this grid
+  m_MontageSize[0] = m_MontageSelection.getColEnd() - m_MontageSelection.getColStart() + 1;
+  m_MontageSize[1] = m_MontageSelection.getRowEnd() - m_MontageSelection.getRowStart() + 1;
+
+  if(getOutputMode() == k_ImageFileOutput)
+  {
+    // The montage is written to the file during execute, no array is created for it
+    if(getOutputFilePath().isEmpty())
+    {
+      QString ss = QObject::tr("The Output File must be set when the montage is written to an image file.");
+      setErrorCondition(-11021, ss);
+      return;
+    }
+    if(!IsStreamedFileFormat(getOutputFilePath()))
+    {
+      QString ss = QObject::tr("The montage can only be written piece by piece to MetaImage (.mha, .mhd) or NRRD (.nrrd, .nhdr) files.");
+      setErrorCondition(-11022, ss);
+    }
+    return;
+  }
+
   if(getMontageDataContainerName().isEmpty())
   {
     QString ss = QObject::tr("Montage Data Container is empty.");
@@ -385,9 +606,6 @@ void ITKStitchMontage::dataCheck()
     return;
   }
 
-  m_MontageSize[0] = m_MontageSelection.getColEnd() - m_MontageSelection.getColStart() + 1;
-  m_MontageSize[1] = m_MontageSelection.getRowEnd() - m_MontageSelection.getRowStart() + 1;
-
   size_t montageArrayXSize = tileTupleDims[0] * m_MontageSize[0];
   size_t montageArrayYSize = tileTupleDims[1] * m_MontageSize[1];
 
@@ -437,6 +655,36 @@ void ITKStitchMontage::dataCheck()
                    "0% overlap between tiles, so the actual geometry dimensions after executing the stitching algorithm may be smaller.")
            .arg(da->getName(), QLocale::system().toString(static_cast<int>(da->getNumberOfTuples())));
   setWarningCondition(-11014, ss);
+
+  // Each pyramid level is half the size of the previous one, its actual size is set during execute
+  for(int level = 1; level <= getPyramidLevels(); level++)
+  {
+    DataContainer::Pointer levelDc = getDataContainerArray()->createNonPrereqDataContainer(this, getPyramidLevelDataContainerName(level));
+    if(getErrorCode() < 0)
+    {
+      return;
+    }
+
+    size_t levelXSize = std::max<size_t>(montageArrayXSize >> level, 1);
+    size_t levelYSize = std::max<size_t>(montageArrayYSize >> level, 1);
+    FloatVec3Type levelSpacing = tileGeom->getSpacing();
+    levelSpacing[0] *= static_cast<float>(1 << level);
+    levelSpacing[1] *= static_cast<float>(1 << level);
+
+    ImageGeom::Pointer levelGeom = ImageGeom::New();
+    levelGeom->setName("MontageGeometry");
+    levelGeom->setDimensions(levelXSize, levelYSize, 1);
+    levelGeom->setSpacing(levelSpacing);
+    levelGeom->setUnits(tileGeom->getUnits());
+    levelDc->setGeometry(levelGeom);
+
+    AttributeMatrix::Pointer levelAm = levelDc->createNonPrereqAttributeMatrix(this, getMontageAttributeMatrixName(), {levelXSize, levelYSize, 1}, AttributeMatrix::Type::Cell);
+    if(getErrorCode() < 0)
+    {
+      return;
+    }
+    levelAm->addOrReplaceAttributeArray(tilePtr->createNewArray(levelXSize * levelYSize, tilePtr->getComponentDimensions(), getMontageDataArrayName(), !getInPreflight()));
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -449,16 +697,16 @@ void ITKStitchMontage::execute()
   {
     return;
   }
+  ITKExecutionPolicy::Apply();
+  ITKFilterTelemetry telemetry(this);
 
   // Pass to ITK and generate montage
   // ITK returns a new Fiji data structure to DREAM3D
   // Store FIJI DS into SIMPL Transform DS inside the Geometry
-  DataArrayPath dap(m_ImageDataContainers[0]->getName(), getCommonAttributeMatrixName(), getCommonDataArrayName());
-  DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(m_ImageDataContainers[0]->getName());
-  AttributeMatrix::Pointer am = dc->getAttributeMatrix(getCommonAttributeMatrixName());
-  IDataArray::Pointer da = am->getAttributeArray(getCommonDataArrayName());
+  IDataArray::Pointer da = MontageImportHelper::GetTilePixelArray(m_ImageDataContainers[0], getCommonAttributeMatrixName(), getCommonDataArrayName());
 
   EXECUTE_STITCH_FUNCTION_TEMPLATE(this, stitchMontage, da);
+  m_TileSources.clear();
 
   /* Let the GUI know we are done with this filter */
   notifyStatusMessage("Complete");
@@ -488,11 +736,35 @@ void ITKStitchMontage::stitchMontage(int peakMethodToUse, unsigned streamSubdivi
   // Initialize the resampler
   initializeResampler<PixelType, MontageType, Resampler>(resampler);
 
+  if(getOutputMode() == k_ImageFileOutput)
+  {
+    std::vector<itk::ImageRegion<Dimension>> changedRegions;
+    QJsonObject stitchRecord;
+    writeMontageFile<PixelType, AccumulatePixelType, Resampler>(resampler, changedRegions, stitchRecord);
+    // The record is only saved once the files match it
+    if(getErrorCode() >= 0 && getIncrementalUpdate())
+    {
+      QFile recordFile(getStitchRecordFilePath());
+      if(!recordFile.open(QIODevice::WriteOnly) || recordFile.write(QJsonDocument(stitchRecord).toJson()) < 0)
+      {
+        QString ss = QObject::tr("The stitch record '%1' could not be written, the next update will write the whole montage").arg(getStitchRecordFilePath());
+        setWarningCondition(-11026, ss);
+      }
+    }
+    return;
+  }
+
   // Execute the stitching algorithm
   executeStitching<PixelType, Resampler>(resampler, streamSubdivisions);
 
   // Convert montaged image into DREAM3D data structure
-  convertMontageToD3D<PixelType, OriginalImageType>(resampler->GetOutput());
+  DataArrayPath dataArrayPath(getMontageDataContainerName(), getMontageAttributeMatrixName(), getMontageDataArrayName());
+  convertMontageToD3D<PixelType, OriginalImageType>(resampler->GetOutput(), dataArrayPath);
+
+  if(getPyramidLevels() > 0)
+  {
+    createPyramidLevels<PixelType>(resampler->GetOutput());
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -527,7 +799,6 @@ template <typename PixelType, typename MontageType, typename Resampler>
 void ITKStitchMontage::initializeResampler(typename Resampler::Pointer resampler)
 {
   using OriginalImageType = itk::Image<PixelType, Dimension>;
-  using TransformType = itk::TranslationTransform<double, Dimension>;
 
   typename MontageType::TileIndexType ind;
   for(int32_t y = m_MontageSelection.getRowStart(); y <= m_MontageSelection.getRowEnd(); y++)
@@ -543,35 +814,28 @@ void ITKStitchMontage::initializeResampler(typename Resampler::Pointer resampler
       // Check the resolution and fix if necessary
       ImageGeom::Pointer geom = imageDC->getGeometryAs<ImageGeom>();
 
-      toITK->SetInput(imageDC);
-      toITK->SetInPlace(true);
-      toITK->SetAttributeMatrixArrayName(getCommonAttributeMatrixName().toStdString());
-      toITK->SetDataArrayName(getCommonDataArrayName().toStdString());
-      toITK->Update();
+      // Tiles imported on demand are read for each stream piece that needs them, only over the regions it needs
+      // when the file format can be read piece by piece
+      QString tileFilePath = MontageImportHelper::GetTileSourceFilePath(imageDC);
+      if(!tileFilePath.isEmpty())
+      {
+        resampler->SetInputTile(ind, MontageImportHelper::CreateTileSourceImage<OriginalImageType>(imageDC, tileFilePath, m_TileSources));
+      }
+      else
+      {
+        toITK->SetInput(imageDC);
+        toITK->SetInPlace(true);
+        toITK->SetAttributeMatrixArrayName(getCommonAttributeMatrixName().toStdString());
+        toITK->SetDataArrayName(getCommonDataArrayName().toStdString());
+        toITK->Update();
 
-      typename OriginalImageType::Pointer image = toITK->GetOutput();
+        typename OriginalImageType::Pointer image = toITK->GetOutput();
 
-      resampler->SetInputTile(ind, image);
+        resampler->SetInputTile(ind, image);
+      }
 
       typename MontageType::TransformPointer regTr = MontageType::TransformType::New();
-      ITransformContainer::Pointer transformContainer = geom->getTransformContainer();
-      if(transformContainer.get() != nullptr)
-      {
-        using FilterType = itk::Dream3DITransformContainerToTransform<double, 3>;
-        FilterType::Pointer filter = FilterType::New();
-        filter->SetInput(transformContainer);
-        filter->Update();
-
-        AffineType::Pointer itkAffine = dynamic_cast<AffineType*>(filter->GetOutput()->Get().GetPointer());
-        AffineType::TranslationType t = itkAffine->GetTranslation();
-        auto offset = regTr->GetOffset();
-        for(unsigned i = 0; i < TransformType::SpaceDimension; i++)
-        {
-          offset[i] = t[i];
-        }
-
-        regTr->SetOffset(offset);
-      }
+      regTr->SetOffset(getTileOffset(geom));
 
       resampler->SetTileTransform(ind, regTr);
     }
@@ -605,13 +869,104 @@ void ITKStitchMontage::executeStitching(typename Resampler::Pointer resampler, u
   resampler->RemoveObserver(progressObsTag);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename PixelType, typename AccumulatePixelType, typename Resampler>
+void ITKStitchMontage::writeMontageFile(typename Resampler::Pointer resampler, std::vector<itk::ImageRegion<Dimension>>& changedRegions, QJsonObject& stitchRecord)
+{
+  QFileInfo fi(getOutputFilePath());
+  QDir dir;
+  if(!dir.mkpath(fi.path()))
+  {
+    QString ss = QObject::tr("Error creating parent path '%1'").arg(fi.path());
+    setErrorCondition(-11023, ss);
+    return;
+  }
+
+  notifyStatusMessage("Resampling tiles into the stitched image file");
+
+  itk::ProgressObserver::Pointer progressObs = itk::ProgressObserver::New();
+  progressObs->SetFilter(this);
+  progressObs->SetMessagePrefix("Stitching Tiles Together");
+  unsigned long progressObsTag = resampler->AddObserver(itk::ProgressEvent(), progressObs);
+
+  try
+  {
+    resampler->UpdateOutputInformation();
+    const itk::ImageRegion<Dimension> largestRegion = resampler->GetOutput()->GetLargestPossibleRegion();
+    changedRegions = {largestRegion};
+    if(getIncrementalUpdate())
+    {
+      stitchRecord = createStitchRecord(resampler->GetOutput());
+      std::vector<itk::ImageRegion<Dimension>> regions;
+      if(findChangedRegions(stitchRecord, regions))
+      {
+        changedRegions = regions;
+        notifyStatusMessage(QObject::tr("Resampling %1 changed regions of the stitched image file").arg(changedRegions.size()));
+      }
+    }
+    // The record of the previous run no longer matches the file once it is being written
+    QFile::remove(getStitchRecordFilePath());
+    if(changedRegions.size() == 1 && changedRegions.front() == largestRegion)
+    {
+      // The pieces are pasted into the files, which must not keep the extent of a previous montage
+      QFile::remove(getOutputFilePath());
+      for(int level = 1; level <= getPyramidLevels(); level++)
+      {
+        QFile::remove(getPyramidLevelFilePath(level));
+      }
+    }
+
+    // The pieces are aligned to the pixels averaged into one pixel of the last pyramid level
+    const itk::IndexValueType blockSize = itk::IndexValueType(1) << std::min(getPyramidLevels(), 30);
+    std::vector<itk::ImageRegion<Dimension>> alignedRegions;
+    for(const itk::ImageRegion<Dimension>& region : changedRegions)
+    {
+      IncrementalStitching::AddChangedRegion(alignedRegions, AlignRegion(region, blockSize, largestRegion));
+    }
+    changedRegions = alignedRegions;
+
+    // Each piece is resampled, written and downsampled into the pyramid levels before the next one is requested,
+    // the whole montage is never in memory and is never read back
+    typename Resampler::OutputImageType* output = resampler->GetOutput();
+    for(const itk::ImageRegion<Dimension>& region : changedRegions)
+    {
+      const unsigned pieceCount = GetStreamPieceCount(region.GetNumberOfPixels(), 2 * sizeof(PixelType) + sizeof(AccumulatePixelType));
+      for(const itk::ImageRegion<Dimension>& piece : SplitRegion(region, pieceCount, static_cast<itk::SizeValueType>(blockSize)))
+      {
+        output->SetRequestedRegion(piece);
+        output->PropagateRequestedRegion();
+        output->UpdateOutputData();
+        WriteImageFileRegion(output, getOutputFilePath(), piece);
+
+        writePyramidLevelFiles<PixelType>(output, piece);
+        if(getErrorCode() < 0)
+        {
+          break;
+        }
+      }
+      if(getErrorCode() < 0)
+      {
+        break;
+      }
+    }
+  } catch(itk::ExceptionObject& err)
+  {
+    QString ss = QObject::tr("ITK exception was thrown while writing the montage file: %1").arg(err.GetDescription());
+    setErrorCondition(-11024, ss);
+  }
+
+  resampler->RemoveObserver(progressObsTag);
+  notifyStatusMessage("Finished resampling tiles");
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 template <typename PixelType, typename OriginalImageType>
-void ITKStitchMontage::convertMontageToD3D(OriginalImageType* image)
+void ITKStitchMontage::convertMontageToD3D(OriginalImageType* image, const DataArrayPath& dataArrayPath)
 {
-  DataArrayPath dataArrayPath(getMontageDataContainerName(), getMontageAttributeMatrixName(), getMontageDataArrayName());
   DataContainer::Pointer container = getDataContainerArray()->getDataContainer(dataArrayPath.getDataContainerName());
 
   using ToDream3DType = itk::InPlaceImageToDream3DDataFilter<PixelType, Dimension>;
@@ -624,6 +979,246 @@ void ITKStitchMontage::convertMontageToD3D(OriginalImageType* image)
   toDream3DFilter->Update();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename PixelType>
+void ITKStitchMontage::createPyramidLevels(itk::Image<PixelType, Dimension>* image)
+{
+  using ImageType = itk::Image<PixelType, Dimension>;
+  using ShrinkType = itk::BinShrinkImageFilter<ImageType, ImageType>;
+
+  // Each level averages 2x2 pixels of the previous one, which is already in memory and 4 times smaller
+  typename ImageType::Pointer previous = image;
+  for(int level = 1; level <= getPyramidLevels(); level++)
+  {
+    notifyStatusMessage(QObject::tr("Computing pyramid level %1").arg(level));
+
+    typename ShrinkType::Pointer shrink = ShrinkType::New();
+    shrink->SetInput(previous);
+    shrink->SetShrinkFactors(2);
+    ITKExecutionPolicy::ApplyToFilter(shrink);
+    shrink->Update();
+
+    typename ImageType::Pointer current = shrink->GetOutput();
+    current->DisconnectPipeline();
+
+    DataArrayPath dataArrayPath(getPyramidLevelDataContainerName(level), getMontageAttributeMatrixName(), getMontageDataArrayName());
+    convertMontageToD3D<PixelType, ImageType>(current, dataArrayPath);
+    previous = current;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename PixelType>
+void ITKStitchMontage::writePyramidLevelFiles(itk::Image<PixelType, Dimension>* image, const itk::ImageRegion<Dimension>& pieceRegion)
+{
+  using ImageType = itk::Image<PixelType, Dimension>;
+  using ShrinkType = itk::BinShrinkImageFilter<ImageType, ImageType>;
+
+  // Each level averages 2x2 pixels of the previous one, all of them are in the piece since it is aligned
+  typename ImageType::Pointer previous = image;
+  itk::ImageRegion<Dimension> previousRegion = pieceRegion;
+  for(int level = 1; level <= getPyramidLevels(); level++)
+  {
+    try
+    {
+      typename ShrinkType::Pointer shrink = ShrinkType::New();
+      shrink->SetInput(previous);
+      shrink->SetShrinkFactors(2);
+      ITKExecutionPolicy::ApplyToFilter(shrink);
+      shrink->UpdateOutputInformation();
+
+      // The last row or column of an odd sized level is not averaged into the next one
+      itk::ImageRegion<Dimension> region;
+      itk::Index<Dimension> upper;
+      for(unsigned d = 0; d < Dimension; d++)
+      {
+        region.SetIndex(d, previousRegion.GetIndex(d) / 2);
+        upper[d] = (previousRegion.GetUpperIndex()[d] + 1) / 2 - 1;
+      }
+      region.SetUpperIndex(upper);
+      if(region.GetNumberOfPixels() == 0 || !region.Crop(shrink->GetOutput()->GetLargestPossibleRegion()))
+      {
+        return;
+      }
+
+      typename ImageType::Pointer current = shrink->GetOutput();
+      current->SetRequestedRegion(region);
+      current->PropagateRequestedRegion();
+      current->UpdateOutputData();
+      current->DisconnectPipeline();
+
+      WriteImageFileRegion(current.GetPointer(), getPyramidLevelFilePath(level), region);
+      previous = current;
+      previousRegion = region;
+    } catch(itk::ExceptionObject& err)
+    {
+      QString ss = QObject::tr("ITK exception was thrown while writing the pyramid level %1: %2").arg(level).arg(err.GetDescription());
+      setErrorCondition(-11028, ss);
+      return;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+QString ITKStitchMontage::getPyramidLevelDataContainerName(int level) const
+{
+  return QString("%1 Level %2").arg(getMontageDataContainerName()).arg(level);
+}
+
+// -----------------------------------------------------------------------------
+QString ITKStitchMontage::getPyramidLevelFilePath(int level) const
+{
+  QFileInfo fi(getOutputFilePath());
+  return fi.path() + QDir::separator() + QString("%1_Level%2.%3").arg(fi.completeBaseName()).arg(level).arg(fi.suffix());
+}
+
+// -----------------------------------------------------------------------------
+QString ITKStitchMontage::getStitchRecordFilePath() const
+{
+  return getOutputFilePath() + ".stitch.json";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+itk::Vector<double, ITKStitchMontage::Dimension> ITKStitchMontage::getTileOffset(const ImageGeom::Pointer& geom) const
+{
+  itk::Vector<double, Dimension> offset;
+  offset.Fill(0.0);
+  ITransformContainer::Pointer transformContainer = geom->getTransformContainer();
+  if(transformContainer.get() != nullptr)
+  {
+    using FilterType = itk::Dream3DITransformContainerToTransform<double, 3>;
+    FilterType::Pointer filter = FilterType::New();
+    filter->SetInput(transformContainer);
+    filter->Update();
+
+    AffineType::Pointer itkAffine = dynamic_cast<AffineType*>(filter->GetOutput()->Get().GetPointer());
+    AffineType::TranslationType t = itkAffine->GetTranslation();
+    for(unsigned i = 0; i < Dimension; i++)
+    {
+      offset[i] = t[i];
+    }
+  }
+  return offset;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject ITKStitchMontage::createStitchRecord(const itk::ImageBase<Dimension>* output) const
+{
+  const RegionType largestRegion = output->GetLargestPossibleRegion();
+  const itk::ImageBase<Dimension>::PointType outputOrigin = output->GetOrigin();
+  const itk::ImageBase<Dimension>::SpacingType outputSpacing = output->GetSpacing();
+
+  IDataArray::Pointer firstTile = MontageImportHelper::GetTilePixelArray(m_ImageDataContainers[0], getCommonAttributeMatrixName(), getCommonDataArrayName());
+
+  QJsonObject record;
+  record["PixelType"] = QString("%1 x %2").arg(firstTile->getTypeAsString()).arg(firstTile->getNumberOfComponents());
+  record["Origin"] = QJsonArray{outputOrigin[0], outputOrigin[1]};
+  record["Spacing"] = QJsonArray{outputSpacing[0], outputSpacing[1]};
+  record["Region"] = RegionToJson(largestRegion);
+
+  QJsonObject tiles;
+  for(const DataContainer::Pointer& dc : m_ImageDataContainers)
+  {
+    ImageGeom::Pointer geom = dc->getGeometryAs<ImageGeom>();
+    const itk::Vector<double, Dimension> offset = getTileOffset(geom);
+    const FloatVec3Type origin = geom->getOrigin();
+    const FloatVec3Type spacing = geom->getSpacing();
+    const SizeVec3Type dims = geom->getDimensions();
+
+    // The tile is sampled at the montage points shifted by its offset, plus one pixel on each side for the interpolation
+    RegionType footprint;
+    for(unsigned d = 0; d < Dimension; d++)
+    {
+      const double lower = (origin[d] - offset[d] - outputOrigin[d]) / outputSpacing[d];
+      const double upper = lower + dims[d] * spacing[d] / outputSpacing[d];
+      footprint.SetIndex(d, static_cast<itk::IndexValueType>(std::floor(lower)) - 1);
+      footprint.SetSize(d, static_cast<itk::SizeValueType>(std::ceil(upper) - std::floor(lower)) + 2);
+    }
+    if(!footprint.Crop(largestRegion))
+    {
+      footprint = RegionType();
+    }
+
+    QJsonObject tile;
+    tile["Checksum"] = IncrementalStitching::GetTileChecksum(dc, getCommonAttributeMatrixName(), getCommonDataArrayName());
+    tile["Offset"] = QJsonArray{offset[0], offset[1]};
+    tile["Region"] = RegionToJson(footprint);
+    tiles[dc->getName()] = tile;
+  }
+  record["Tiles"] = tiles;
+  return record;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKStitchMontage::findChangedRegions(const QJsonObject& stitchRecord, std::vector<itk::ImageRegion<Dimension>>& changedRegions) const
+{
+  changedRegions.clear();
+  if(!QFileInfo::exists(getOutputFilePath()))
+  {
+    return false;
+  }
+  // The pyramid levels are only written from the pieces of the montage, a missing level needs the whole montage
+  for(int level = 1; level <= getPyramidLevels(); level++)
+  {
+    if(!QFileInfo::exists(getPyramidLevelFilePath(level)))
+    {
+      return false;
+    }
+  }
+  QFile recordFile(getStitchRecordFilePath());
+  if(!recordFile.open(QIODevice::ReadOnly))
+  {
+    return false;
+  }
+  QJsonParseError parseError;
+  QJsonDocument previousDocument = QJsonDocument::fromJson(recordFile.readAll(), &parseError);
+  if(parseError.error != QJsonParseError::NoError || !previousDocument.isObject())
+  {
+    return false;
+  }
+  const QJsonObject previousRecord = previousDocument.object();
+
+  // The file can only be updated in place when the montage keeps the same pixel type and the same extent
+  const QStringList montageKeys = {"PixelType", "Origin", "Spacing", "Region"};
+  for(const QString& key : montageKeys)
+  {
+    if(previousRecord.value(key) != stitchRecord.value(key))
+    {
+      return false;
+    }
+  }
+  const QJsonObject tiles = stitchRecord["Tiles"].toObject();
+  const QJsonObject previousTiles = previousRecord["Tiles"].toObject();
+  if(tiles.keys() != previousTiles.keys())
+  {
+    return false;
+  }
+
+  for(const QString& name : tiles.keys())
+  {
+    const QJsonObject tile = tiles[name].toObject();
+    const QJsonObject previousTile = previousTiles[name].toObject();
+    if(tile == previousTile)
+    {
+      continue;
+    }
+    // The pixels the tile covered and the pixels it covers now are both resampled again
+    IncrementalStitching::AddChangedRegion(changedRegions, RegionFromJson(previousTile["Region"].toArray()));
+    IncrementalStitching::AddChangedRegion(changedRegions, RegionFromJson(tile["Region"].toArray()));
+  }
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -827,3 +1422,51 @@ void ITKStitchMontage::setMontageSelection(const MontageSelection& value)
 {
   m_MontageSelection = value;
 }
+
+// -----------------------------------------------------------------------------
+void ITKStitchMontage::setOutputMode(int value)
+{
+  m_OutputMode = value;
+}
+
+// -----------------------------------------------------------------------------
+int ITKStitchMontage::getOutputMode() const
+{
+  return m_OutputMode;
+}
+
+// -----------------------------------------------------------------------------
+void ITKStitchMontage::setOutputFilePath(const QString& value)
+{
+  m_OutputFilePath = value;
+}
+
+// -----------------------------------------------------------------------------
+QString ITKStitchMontage::getOutputFilePath() const
+{
+  return m_OutputFilePath;
+}
+
+// -----------------------------------------------------------------------------
+void ITKStitchMontage::setPyramidLevels(int value)
+{
+  m_PyramidLevels = value;
+}
+
+// -----------------------------------------------------------------------------
+int ITKStitchMontage::getPyramidLevels() const
+{
+  return m_PyramidLevels;
+}
+
+// -----------------------------------------------------------------------------
+void ITKStitchMontage::setIncrementalUpdate(bool value)
+{
+  m_IncrementalUpdate = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ITKStitchMontage::getIncrementalUpdate() const
+{
+  return m_IncrementalUpdate;
+}
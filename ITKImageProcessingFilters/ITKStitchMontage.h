@@ -36,6 +36,9 @@
 #pragma once
 
 #include <memory>
+#include <vector>
+
+#include <QtCore/QJsonObject>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
@@ -49,6 +52,7 @@
 
 #include "itkAffineTransform.h"
 #include "itkCompositeTransform.h"
+#include "itkImage.h"
 
 #include "ITKImageProcessing/ITKImageProcessingConstants.h"
 #include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
@@ -74,6 +78,10 @@ class ITKImageProcessing_EXPORT ITKStitchMontage : public AbstractFilter
   PYB11_PROPERTY(QString MontageDataContainerName READ getMontageDataContainerName WRITE setMontageDataContainerName)
   PYB11_PROPERTY(QString MontageAttributeMatrixName READ getMontageAttributeMatrixName WRITE setMontageAttributeMatrixName)
   PYB11_PROPERTY(QString MontageDataArrayName READ getMontageDataArrayName WRITE setMontageDataArrayName)
+  PYB11_PROPERTY(int OutputMode READ getOutputMode WRITE setOutputMode)
+  PYB11_PROPERTY(QString OutputFilePath READ getOutputFilePath WRITE setOutputFilePath)
+  PYB11_PROPERTY(int PyramidLevels READ getPyramidLevels WRITE setPyramidLevels)
+  PYB11_PROPERTY(bool IncrementalUpdate READ getIncrementalUpdate WRITE setIncrementalUpdate)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -165,6 +173,50 @@ public:
   QString getMontageDataArrayName() const;
   Q_PROPERTY(QString MontageDataArrayName READ getMontageDataArrayName WRITE setMontageDataArrayName)
 
+  /**
+   * @brief Setter property for OutputMode
+   */
+  void setOutputMode(int value);
+  /**
+   * @brief Getter property for OutputMode
+   * @return Value of OutputMode
+   */
+  int getOutputMode() const;
+  Q_PROPERTY(int OutputMode READ getOutputMode WRITE setOutputMode)
+
+  /**
+   * @brief Setter property for OutputFilePath
+   */
+  void setOutputFilePath(const QString& value);
+  /**
+   * @brief Getter property for OutputFilePath
+   * @return Value of OutputFilePath
+   */
+  QString getOutputFilePath() const;
+  Q_PROPERTY(QString OutputFilePath READ getOutputFilePath WRITE setOutputFilePath)
+
+  /**
+   * @brief Setter property for PyramidLevels
+   */
+  void setPyramidLevels(int value);
+  /**
+   * @brief Getter property for PyramidLevels
+   * @return Value of PyramidLevels
+   */
+  int getPyramidLevels() const;
+  Q_PROPERTY(int PyramidLevels READ getPyramidLevels WRITE setPyramidLevels)
+
+  /**
+   * @brief Setter property for IncrementalUpdate
+   */
+  void setIncrementalUpdate(bool value);
+  /**
+   * @brief Getter property for IncrementalUpdate
+   * @return Value of IncrementalUpdate
+   */
+  bool getIncrementalUpdate() const;
+  Q_PROPERTY(bool IncrementalUpdate READ getIncrementalUpdate WRITE setIncrementalUpdate)
+
   /**
    * @brief getMontageInformation
    * @return
@@ -260,12 +312,18 @@ private:
   QString m_MontageDataContainerName = {ITKImageProcessing::Montage::k_MontageDataContainerDefaultName};
   QString m_MontageAttributeMatrixName = {ITKImageProcessing::Montage::k_MontageAttributeMatrixDefaultName};
   QString m_MontageDataArrayName = {ITKImageProcessing::Montage::k_MontageDataArrayDefaultName};
+  int m_OutputMode = {0};
+  QString m_OutputFilePath = {};
+  int m_PyramidLevels = {0};
+  bool m_IncrementalUpdate = {false};
 
   // QString m_DataContainerList;
 
   static constexpr unsigned Dimension = 2;
-  IntVec2Type m_MontageSize;
+  IntVec2Type m_MontageSize = {0, 0};
   std::vector<DataContainer::Pointer> m_ImageDataContainers;
+  // Filters reading the tiles loaded on demand, kept while the resampler requests their regions
+  std::vector<itk::ProcessObject::Pointer> m_TileSources;
 
   /**
    * @brief createResampler
@@ -290,7 +348,78 @@ private:
    * @brief convertMontageToD3D
    */
   template <typename PixelType, typename OriginalImageType>
-  void convertMontageToD3D(OriginalImageType* image);
+  void convertMontageToD3D(OriginalImageType* image, const DataArrayPath& dataArrayPath);
+
+  /**
+   * @brief createPyramidLevels Stores the montage downsampled by 2, 4, 8... in the pyramid level data containers
+   * @param image
+   */
+  template <typename PixelType>
+  void createPyramidLevels(itk::Image<PixelType, Dimension>* image);
+
+  /**
+   * @brief writePyramidLevelFiles Writes a piece of the montage downsampled by 2, 4, 8... into the pyramid level
+   * files next to the montage file
+   * @param image Montage, whose buffer holds the piece
+   * @param pieceRegion Piece of the montage that was just written, aligned to 2^levels pixels
+   */
+  template <typename PixelType>
+  void writePyramidLevelFiles(itk::Image<PixelType, Dimension>* image, const itk::ImageRegion<Dimension>& pieceRegion);
+
+  /**
+   * @brief getPyramidLevelDataContainerName Returns the name of the data container holding a pyramid level
+   * @param level Level of the pyramid, downsampled by 2^level
+   * @return
+   */
+  QString getPyramidLevelDataContainerName(int level) const;
+
+  /**
+   * @brief getPyramidLevelFilePath Returns the path of the file holding a pyramid level
+   * @param level Level of the pyramid, downsampled by 2^level
+   * @return
+   */
+  QString getPyramidLevelFilePath(int level) const;
+
+  /**
+   * @brief writeMontageFile Resamples the montage piece by piece straight into the output file. With
+   * IncrementalUpdate, only the regions covered by the tiles that changed since the previous run are written again.
+   * The pyramid levels are written from each piece while it is in memory.
+   * @param resampler
+   * @param changedRegions Set to the regions of the file that were written
+   * @param stitchRecord Set to the stitch record of this run when IncrementalUpdate is on
+   */
+  template <typename PixelType, typename AccumulatePixelType, typename Resampler>
+  void writeMontageFile(typename Resampler::Pointer resampler, std::vector<itk::ImageRegion<Dimension>>& changedRegions, QJsonObject& stitchRecord);
+
+  /**
+   * @brief getTileOffset Returns the registration offset stored in the transform of a tile geometry
+   * @param geom
+   * @return
+   */
+  itk::Vector<double, Dimension> getTileOffset(const ImageGeom::Pointer& geom) const;
+
+  /**
+   * @brief getStitchRecordFilePath Returns the path of the file recording the tiles the montage file was written from
+   * @return
+   */
+  QString getStitchRecordFilePath() const;
+
+  /**
+   * @brief createStitchRecord Records the montage geometry and, for each tile, a checksum of its data, its offset
+   * and the region of the montage it covers
+   * @param output Montage image, with its output information up to date
+   * @return
+   */
+  QJsonObject createStitchRecord(const itk::ImageBase<Dimension>* output) const;
+
+  /**
+   * @brief findChangedRegions Compares the stitch record with the one saved with the montage file, and returns
+   * the regions covered by the tiles that changed, before or after the change
+   * @param stitchRecord
+   * @param changedRegions
+   * @return false when the whole montage must be written again
+   */
+  bool findChangedRegions(const QJsonObject& stitchRecord, std::vector<itk::ImageRegion<Dimension>>& changedRegions) const;
 
 public:
   ITKStitchMontage(const ITKStitchMontage&) = delete;            // Copy Constructor Not Implemented
@@ -151,6 +151,11 @@ protected:
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageProcessingBase class
+   */
+  bool isStreamable() const override;
+
 public:
   ITKThresholdImage(const ITKThresholdImage&) = delete;            // Copy Constructor Not Implemented
   ITKThresholdImage(ITKThresholdImage&&) = delete;                 // Move Constructor Not Implemented
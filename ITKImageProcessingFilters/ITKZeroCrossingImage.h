@@ -139,6 +139,11 @@ protected:
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageProcessingBase class
+   */
+  bool isStreamable() const override;
+
 public:
   ITKZeroCrossingImage(const ITKZeroCrossingImage&) = delete;            // Copy Constructor Not Implemented
   ITKZeroCrossingImage(ITKZeroCrossingImage&&) = delete;                 // Move Constructor Not Implemented
@@ -34,7 +34,6 @@
 #include <cstring>
 #include <numeric>
 #include <set>
-#include <thread>
 #include <type_traits>
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
@@ -69,6 +68,8 @@
 #include "ITKImageProcessing/ITKImageProcessingConstants.h"
 #include "ITKImageProcessing/ITKImageProcessingFilters/ITKImageWriter.h"
 #include "ITKImageProcessing/ITKImageProcessingFilters/ITKMedianImage.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/ITKExecutionPolicy.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/ITKFilterTelemetry.h"
 #include "ITKImageProcessing/ITKImageProcessingVersion.h"
 #include "ITKImageProcessing/ZeissXml/ZeissTagMapping.h"
 
@@ -291,8 +292,7 @@ void calculateOutputValues(IlluminationCorrection* filter)
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
     std::shared_ptr<tbb::task_group> g(new tbb::task_group);
-    // C++11 RIGHT HERE....
-    int32_t nthreads = static_cast<int32_t>(std::thread::hardware_concurrency()); // Returns ZERO if not defined on this platform
+    int32_t nthreads = static_cast<int32_t>(ITKExecutionPolicy::GetNumberOfThreads());
     int32_t threadCount = 0;
 #endif
 
@@ -680,6 +680,8 @@ void IlluminationCorrection::execute()
   {
     return;
   }
+  ITKExecutionPolicy::Apply();
+  ITKFilterTelemetry telemetry(this);
   if(m_ExportCorrectedImages)
   {
     QString ss;
@@ -31,6 +31,11 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "DetermineStitching.h"
 
+#include <algorithm>
+#include <cmath>
+
+#include <Eigen/Sparse>
+
 #include "itkImage.h"
 
 #include "SIMPLib/ITK/itkBridge.h"
@@ -45,6 +50,310 @@ DetermineStitching::DetermineStitching() = default;
 // -----------------------------------------------------------------------------
 DetermineStitching::~DetermineStitching() = default;
 
+namespace
+{
+// Rejected pairs keep a tiny weight, so that a tile whose pairs were all rejected is still placed
+const double k_RejectedPairWeight = 1.0e-6;
+// A pair is rejected when its residual exceeds this many times the median residual, and at least this many pixels
+const double k_OutlierResidualRatio = 3.0;
+const double k_MinimumOutlierResidual = 2.0;
+const int k_MaximumRejectionPasses = 5;
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<float> DetermineStitching::ChainTileOrigins(size_t numXtiles, const std::vector<std::vector<float>>& leftShifts, const std::vector<std::vector<float>>& topShifts,
+                                                        const std::vector<float>& leftCropSpecs, const std::vector<float>& topCropSpecs)
+{
+  std::vector<float> origins(2 * leftShifts.size(), 0.0f);
+  for(size_t i = 1; i < leftShifts.size(); i++)
+  {
+    float newXfromleft = 0.0f;
+    float newYfromleft = 0.0f;
+    if(!leftShifts[i].empty())
+    {
+      newXfromleft = origins[2 * (i - 1)] + leftCropSpecs[0] + leftShifts[i][0];
+      newYfromleft = origins[2 * (i - 1) + 1] + leftShifts[i][1];
+    }
+    float newXfromtop = 0.0f;
+    float newYfromtop = 0.0f;
+    if(!topShifts[i].empty())
+    {
+      // Add the local shifts to the previous global value to get the current stitched global shift
+      newXfromtop = origins[2 * (i - numXtiles)] + topShifts[i][0];
+      newYfromtop = origins[2 * (i - numXtiles) + 1] + topShifts[i][1] + topCropSpecs[1];
+    }
+
+    if(leftShifts[i].empty())
+    {
+      origins[2 * i] = newXfromtop;
+      origins[2 * i + 1] = newYfromtop;
+    }
+    else if(topShifts[i].empty())
+    {
+      origins[2 * i] = newXfromleft;
+      origins[2 * i + 1] = newYfromleft;
+    }
+    else
+    {
+      // AVERAGE the two new locations
+      origins[2 * i] = (newXfromtop + newXfromleft) / 2.0f;
+      origins[2 * i + 1] = (newYfromtop + newYfromleft) / 2.0f;
+    }
+  }
+  return origins;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<float> DetermineStitching::SolveTileOrigins(size_t numXtiles, const std::vector<std::vector<float>>& leftShifts, const std::vector<std::vector<float>>& topShifts,
+                                                        const std::vector<float>& leftCropSpecs, const std::vector<float>& topCropSpecs, bool rejectOutlierPairs)
+{
+  const size_t numTiles = leftShifts.size();
+  std::vector<float> origins(2 * numTiles, 0.0f);
+  if(numTiles < 2)
+  {
+    return origins;
+  }
+
+  // The correlation peak (normalized correlation) measures how much a pair can be trusted
+  std::vector<TilePair> pairs;
+  for(size_t i = 1; i < numTiles; i++)
+  {
+    if(!leftShifts[i].empty())
+    {
+      TilePair pair;
+      pair.Current = i;
+      pair.Neighbour = i - 1;
+      pair.X = leftCropSpecs[0] + leftShifts[i][0];
+      pair.Y = leftShifts[i][1];
+      pair.Weight = std::max(static_cast<double>(leftShifts[i][2]), 0.01);
+      pairs.push_back(pair);
+    }
+    if(!topShifts[i].empty())
+    {
+      TilePair pair;
+      pair.Current = i;
+      pair.Neighbour = i - numXtiles;
+      pair.X = topShifts[i][0];
+      pair.Y = topCropSpecs[1] + topShifts[i][1];
+      pair.Weight = std::max(static_cast<double>(topShifts[i][2]), 0.01);
+      pairs.push_back(pair);
+    }
+  }
+
+  std::vector<float> solved;
+  if(!SolvePairOffsets(numTiles, pairs, rejectOutlierPairs, solved))
+  {
+    // Only happens when some tiles are not connected to the first one
+    return ChainTileOrigins(numXtiles, leftShifts, topShifts, leftCropSpecs, topCropSpecs);
+  }
+  return solved;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DetermineStitching::SolvePairOffsets(size_t numTiles, const std::vector<TilePair>& pairs, bool rejectOutlierPairs, std::vector<float>& origins)
+{
+  origins.assign(2 * numTiles, 0.0f);
+  if(numTiles < 2)
+  {
+    return true;
+  }
+
+  // The first tile is fixed at (0, 0), the unknowns are the origins of the other tiles. The normal equations of the
+  // weighted fit are the weighted Laplacian of the tile graph, which is sparse, symmetric and positive definite.
+  const Eigen::Index numUnknowns = static_cast<Eigen::Index>(numTiles - 1);
+  std::vector<bool> rejected(pairs.size(), false);
+  for(int pass = 0; pass <= k_MaximumRejectionPasses; pass++)
+  {
+    std::vector<Eigen::Triplet<double>> triplets;
+    triplets.reserve(4 * pairs.size());
+    Eigen::VectorXd rhsX = Eigen::VectorXd::Zero(numUnknowns);
+    Eigen::VectorXd rhsY = Eigen::VectorXd::Zero(numUnknowns);
+    for(size_t p = 0; p < pairs.size(); p++)
+    {
+      const TilePair& pair = pairs[p];
+      const double weight = rejected[p] ? pair.Weight * k_RejectedPairWeight : pair.Weight;
+      const Eigen::Index a = static_cast<Eigen::Index>(pair.Current) - 1;
+      const Eigen::Index b = static_cast<Eigen::Index>(pair.Neighbour) - 1;
+      if(a >= 0)
+      {
+        triplets.emplace_back(a, a, weight);
+        rhsX[a] += weight * pair.X;
+        rhsY[a] += weight * pair.Y;
+      }
+      if(b >= 0)
+      {
+        triplets.emplace_back(b, b, weight);
+        rhsX[b] -= weight * pair.X;
+        rhsY[b] -= weight * pair.Y;
+      }
+      if(a >= 0 && b >= 0)
+      {
+        triplets.emplace_back(a, b, -weight);
+        triplets.emplace_back(b, a, -weight);
+      }
+    }
+    Eigen::SparseMatrix<double> normalMatrix(numUnknowns, numUnknowns);
+    normalMatrix.setFromTriplets(triplets.begin(), triplets.end());
+
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver;
+    solver.compute(normalMatrix);
+    if(solver.info() != Eigen::Success)
+    {
+      return false;
+    }
+    const Eigen::VectorXd x = solver.solve(rhsX);
+    const Eigen::VectorXd y = solver.solve(rhsY);
+    for(size_t i = 1; i < numTiles; i++)
+    {
+      origins[2 * i] = static_cast<float>(x[static_cast<Eigen::Index>(i) - 1]);
+      origins[2 * i + 1] = static_cast<float>(y[static_cast<Eigen::Index>(i) - 1]);
+    }
+    if(!rejectOutlierPairs)
+    {
+      break;
+    }
+
+    // Reject the pairs that disagree with the fit of all the others
+    std::vector<double> residuals(pairs.size(), 0.0);
+    std::vector<double> acceptedResiduals;
+    for(size_t p = 0; p < pairs.size(); p++)
+    {
+      const TilePair& pair = pairs[p];
+      const double dx = origins[2 * pair.Current] - origins[2 * pair.Neighbour] - pair.X;
+      const double dy = origins[2 * pair.Current + 1] - origins[2 * pair.Neighbour + 1] - pair.Y;
+      residuals[p] = std::sqrt(dx * dx + dy * dy);
+      if(!rejected[p])
+      {
+        acceptedResiduals.push_back(residuals[p]);
+      }
+    }
+    if(acceptedResiduals.empty())
+    {
+      break;
+    }
+    std::nth_element(acceptedResiduals.begin(), acceptedResiduals.begin() + acceptedResiduals.size() / 2, acceptedResiduals.end());
+    const double threshold = std::max(k_OutlierResidualRatio * acceptedResiduals[acceptedResiduals.size() / 2], k_MinimumOutlierResidual);
+    bool changed = false;
+    for(size_t p = 0; p < pairs.size(); p++)
+    {
+      if(!rejected[p] && residuals[p] > threshold)
+      {
+        rejected[p] = true;
+        changed = true;
+      }
+    }
+    if(!changed)
+    {
+      break;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::array<std::vector<DetermineStitching::TilePair>, 4> DetermineStitching::CreatePairBatches(size_t numCols, size_t numRows)
+{
+  std::array<std::vector<TilePair>, 4> batches;
+  for(size_t parity = 0; parity < 2; parity++)
+  {
+    for(size_t row = 0; row < numRows; row++)
+    {
+      for(size_t col = parity; col + 1 < numCols; col += 2)
+      {
+        TilePair pair;
+        pair.Neighbour = row * numCols + col;
+        pair.Current = pair.Neighbour + 1;
+        batches[parity].push_back(pair);
+      }
+    }
+    for(size_t row = parity; row + 1 < numRows; row += 2)
+    {
+      for(size_t col = 0; col < numCols; col++)
+      {
+        TilePair pair;
+        pair.Neighbour = row * numCols + col;
+        pair.Current = pair.Neighbour + numCols;
+        batches[2 + parity].push_back(pair);
+      }
+    }
+  }
+  return batches;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<float> DetermineStitching::GetLeftCropSpecs(const SizeVec3Type& udims, float overlapPer)
+{
+  std::vector<float> cropSpecsIm1Im2(12, 0);
+  // Width of the image * the percentage (say 20%) = the size of the crop we're looking at. Subtract that from the width of the image and you have the origin
+  cropSpecsIm1Im2[0] = udims[0] - (udims[0] * (overlapPer / 100)); // left image X Origin
+  cropSpecsIm1Im2[1] = 0;                                          // left image Y Origin
+  cropSpecsIm1Im2[2] = 0;                                          // left image Z Origin
+  cropSpecsIm1Im2[3] = 0;                                          // current image X Origin
+  cropSpecsIm1Im2[4] = 0;                                          // current image Y Origin
+  cropSpecsIm1Im2[5] = 0;                                          // current image Z Origin
+
+  cropSpecsIm1Im2[6] = udims[0] * (overlapPer / 100); // left image X Size
+  cropSpecsIm1Im2[7] = udims[1];                      // left image Y Size
+  cropSpecsIm1Im2[8] = 1;                             // left image Z Size
+  cropSpecsIm1Im2[9] = udims[0] * (overlapPer / 100); // current image X Size
+  cropSpecsIm1Im2[10] = udims[1];                     // current image Y Size
+  cropSpecsIm1Im2[11] = 1;                            // current image Z Size
+  return cropSpecsIm1Im2;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<float> DetermineStitching::GetTopCropSpecs(const SizeVec3Type& udims, float overlapPer)
+{
+  std::vector<float> cropSpecsIm1Im2(12, 0);
+  cropSpecsIm1Im2[0] = 0;                                          // top image X Origin
+  cropSpecsIm1Im2[1] = udims[1] - (udims[1] * (overlapPer / 100)); // top image Y Origin
+  cropSpecsIm1Im2[2] = 0;                                          // top image Z Origin
+  cropSpecsIm1Im2[3] = 0;                                          // current image X Origin
+  cropSpecsIm1Im2[4] = 0;                                          // current image Y Origin
+  cropSpecsIm1Im2[5] = 0;                                          // current image Z Origin
+
+  cropSpecsIm1Im2[6] = udims[0];                       // top image X Size
+  cropSpecsIm1Im2[7] = udims[1] * (overlapPer / 100);  // top image Y Size
+  cropSpecsIm1Im2[8] = 1;                              // top image Z Size
+  cropSpecsIm1Im2[9] = udims[0];                       // current image X Size
+  cropSpecsIm1Im2[10] = udims[1] * (overlapPer / 100); // current image Y Size
+  cropSpecsIm1Im2[11] = 1;                             // current image Z Size
+  return cropSpecsIm1Im2;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint32_t DetermineStitching::GetMaximumConcurrentPairs(const SizeVec3Type& udims, float overlapPer, size_t pixelSize)
+{
+  const uint32_t numberOfThreads = static_cast<uint32_t>(std::max(ITKExecutionPolicy::GetNumberOfThreads(), 1));
+  const size_t budget = ITKExecutionPolicy::GetMemoryBudgetInBytes();
+  if(budget == 0)
+  {
+    return numberOfThreads;
+  }
+  // The tiles are only wrapped. Each correlation copies both windows, then the masked FFT normalized correlation
+  // works on about a dozen double precision images (including the masks and their transforms) padded to twice
+  // the window size in X and Y.
+  // The left and top windows have the same number of pixels.
+  const double windowPixels = static_cast<double>(udims[0] * udims[1]) * (overlapPer / 100.0);
+  const double bytesPerPair = windowPixels * (2.0 * pixelSize + 4.0 * 12.0 * sizeof(double));
+  const double maximumPairs = std::floor(static_cast<double>(budget) / std::max(bytesPerPair, 1.0));
+  return static_cast<uint32_t>(std::max(1.0, std::min(maximumPairs, static_cast<double>(numberOfThreads))));
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
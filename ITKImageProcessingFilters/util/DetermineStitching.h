@@ -40,6 +40,9 @@
 #endif
 #endif
 
+#include <algorithm>
+#include <array>
+#include <tuple>
 #include <vector>
 
 #include <QtCore/QDir>
@@ -52,29 +55,62 @@
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/ITK/itkBridge.h"
 #include "SIMPLib/ITK/itkSupportConstants.h"
+#include "SIMPLib/Utilities/ParallelTaskAlgorithm.h"
 
+#include "itkBinShrinkImageFilter.h"
 #include "itkChangeInformationImageFilter.h"
 #include "itkImageFileWriter.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
 #include "itkMaskedFFTNormalizedCorrelationImageFilter.h"
 #include "itkMinimumMaximumImageCalculator.h"
 #include "itkRegionOfInterestImageFilter.h"
 
+#include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/ITKExecutionPolicy.h"
+
 #define WRITE_DEBUG_IMAGES 0
 
 /**
  * @brief The DetermineStitching class
  */
-class DetermineStitching
+class ITKImageProcessing_EXPORT DetermineStitching
 {
 public:
   virtual ~DetermineStitching();
 
+  /**
+   * @brief The PlacementMethod enum selects how the pairwise shifts are turned into tile origins: each tile placed
+   * from its already placed left/top neighbours, or all the tiles at once as a weighted least-squares fit
+   */
+  enum class PlacementMethod : int
+  {
+    Chained = 0,
+    LeastSquares = 1
+  };
+
+  /**
+   * @brief The TilePair struct is one measured offset between two neighbouring tiles:
+   * origin[Current] - origin[Neighbour] = (X, Y)
+   */
+  struct TilePair
+  {
+    size_t Current = 0;
+    size_t Neighbour = 0;
+    double X = 0.0;
+    double Y = 0.0;
+    double Weight = 1.0;
+  };
+
   /**
    * @brief FindGlobalOrigins
    * @param xTileCount
    * @param yTileCount
    * @param ImportMode
    * @param overlapPer
+   * @param placementMethod See PlacementMethod
+   * @param rejectOutlierPairs Whether the least-squares fit ignores the pairs that disagree with the others
+   * @param coarseFactor Downsampling factor of the coarse registration (see CoarseToFineCrossCorrelate), 1 to correlate
+   * the full resolution windows only
    * @param dataArrayList
    * @param udims
    * @param sampleOrigin
@@ -82,12 +118,11 @@ public:
    * @return
    */
   template <typename T, unsigned int ImageDimension>
-  static FloatArrayType::Pointer FindGlobalOrigins(AbstractFilter* filter, int xTileCount, int yTileCount, int importMode, float overlapPer,
-                                                   const std::vector<typename DataArray<T>::Pointer>& dataArrayList, const SizeVec3Type& udims, const FloatVec3Type& sampleOrigin,
+  static FloatArrayType::Pointer FindGlobalOrigins(AbstractFilter* filter, int xTileCount, int yTileCount, int importMode, float overlapPer, PlacementMethod placementMethod,
+                                                   bool rejectOutlierPairs, unsigned int coarseFactor, const std::vector<typename DataArray<T>::Pointer>& dataArrayList, const SizeVec3Type& udims, const FloatVec3Type& sampleOrigin,
                                                    const FloatVec3Type& spacing, const std::vector<QString>& dataContainerNames)
   {
-    // The assumption is that we are working on a 2D image where the XY dims are in the 0 and 1 index of the udims variable
-    size_t totalPoints = udims[0] * udims[1];
+    std::ignore = dataContainerNames;
 
     std::vector<size_t> cDims(1, 2); // a dimension for the xvalues and one for the y values
     std::vector<size_t> tDims(1);
@@ -98,231 +133,407 @@ public:
     FloatArrayType::Pointer xyStitchedGlobalListPtr = FloatArrayType::CreateArray(tDims, cDims, "xyGlobalList", true);
     FloatArrayType::Pointer xyStitchedGlobalListPtr_orig = FloatArrayType::CreateArray(tDims, cDims, "xyGlobalList_orig", true);
 
-    int32_t numXtiles = xTileCount;
+    size_t numXtiles = static_cast<size_t>(xTileCount);
 
     // Make sure the combIndexList is large enough to store every value
     std::vector<size_t> combIndexList(numTiles);
 
     combIndexList = ReturnProperIndex(importMode, xTileCount, yTileCount);
 
-    using PixelType = T;
-    using ImageType = itk::Image<PixelType, ImageDimension>;
-    using ImportFilterType = itk::ImportImageFilter<PixelType, ImageDimension>;
-
-    ImageType* currentImage = nullptr;
-    ImageType* leftImage = nullptr;
-    ImageType* aboveImage = nullptr;
+    // IMPORTANT:
+    // cropSpecIm1Im2 is a rather important variable so it's good to understand what each value means
+    // The first 6 values in the array are the crop origin that we'll be looking at (starts at the top left)
+    // The last 6 values in the array are the crop dimensions (size) that we'll look at (goes down to bottom right)
+    // The CropAndCrossCorrelate method crops the images and compares them with each other looking for a spike in similar values (a simplified explanation)
+    // Each image (in comb order) is compared with the image to its left, except in the first column, and with the image above it, except in the first row.
+    const std::vector<float> leftCropSpecs = GetLeftCropSpecs(udims, overlapPer);
+    const std::vector<float> topCropSpecs = GetTopCropSpecs(udims, overlapPer);
+
+    // FIRST PASS: every pair of neighbours is cross correlated independently of the others, as many at once as the
+    // memory budget allows
+    std::vector<std::vector<float>> leftShifts(combIndexList.size());
+    std::vector<std::vector<float>> topShifts(combIndexList.size());
+    ParallelTaskAlgorithm taskAlg;
+    taskAlg.setMaxQueueSize(GetMaximumConcurrentPairs(udims, overlapPer, sizeof(T)));
+    for(size_t i = 1; i < combIndexList.size(); i++)
+    {
+      if(filter->getCancel())
+      {
+        break;
+      }
 
-    typename ImportFilterType::Pointer importFilter;
-    typename ImportFilterType::Pointer importFilter2;
+      filter->notifyStatusMessage(QString("Cross Correlating Image %1 of %2").arg(i).arg(combIndexList.size() - 1));
+      if(i % numXtiles != 0) // every image but the left most column is matched to the image on its left
+      {
+        typename DataArray<T>::Pointer current = dataArrayList[combIndexList[i]];
+        typename DataArray<T>::Pointer left = dataArrayList[combIndexList[i - 1]];
+        taskAlg.execute([&, i, current, left]() { leftShifts[i] = CorrelateTiles<T, ImageDimension>(leftCropSpecs, current, left, udims, sampleOrigin, spacing, coarseFactor); });
+      }
+      if(i >= numXtiles) // every image but the top row is matched to the image above it
+      {
+        typename DataArray<T>::Pointer current = dataArrayList[combIndexList[i]];
+        typename DataArray<T>::Pointer above = dataArrayList[combIndexList[i - numXtiles]];
+        taskAlg.execute([&, i, current, above]() { topShifts[i] = CorrelateTiles<T, ImageDimension>(topCropSpecs, current, above, udims, sampleOrigin, spacing, coarseFactor); });
+      }
+    }
+    taskAlg.wait();
+    if(filter->getCancel())
+    {
+      return xyStitchedGlobalListPtr_orig;
+    }
 
-    std::vector<float> cropSpecsIm1Im2(12, 0);
-    std::vector<float> newXYOrigin(2, 0);
-    std::vector<float> newXYOrigin2(2, 0);
+    // SECOND PASS: the local shifts are turned into origins, either accumulated in comb order from the top left
+    // tile which sits at the origin, or fitted all at once
+    std::vector<float> origins;
+    if(placementMethod == PlacementMethod::LeastSquares)
+    {
+      origins = SolveTileOrigins(numXtiles, leftShifts, topShifts, leftCropSpecs, topCropSpecs, rejectOutlierPairs);
+    }
+    else
+    {
+      origins = ChainTileOrigins(numXtiles, leftShifts, topShifts, leftCropSpecs, topCropSpecs);
+    }
+    for(size_t i = 0; i < combIndexList.size(); i++)
+    {
+      xyStitchedGlobalListPtr->setValue(2 * i, origins[2 * i]);
+      xyStitchedGlobalListPtr->setValue(2 * i + 1, origins[2 * i + 1]);
 
-    // set the stitched global coordinates of the first tile to the top left corner
-    xyStitchedGlobalListPtr->setValue(0, 0);
-    xyStitchedGlobalListPtr->setValue(1, 0);
-    xyStitchedGlobalListPtr_orig->setValue(0, 0);
-    xyStitchedGlobalListPtr_orig->setValue(1, 0);
+      // Put the values found in from going in the comb order into another data array which represents the original order the images came in as
+      xyStitchedGlobalListPtr_orig->setValue(2 * combIndexList[i], origins[2 * i]);
+      xyStitchedGlobalListPtr_orig->setValue(2 * combIndexList[i] + 1, origins[2 * i + 1]);
+    }
 
-    // helper variables to store previous stitched global values
-    float previousXleft = 0;
-    float previousYleft = 0;
+    return xyStitchedGlobalListPtr_orig;
+  }
 
-    float previousXtop = 0;
-    float previousYtop = 0;
+  /**
+   * @brief CorrelateTiles Imports two tiles as ITK images (without copying them) and cross correlates the windows
+   * described by 'cropSpecsIm1Im2' (see CropAndCrossCorrelate)
+   * @param cropSpecsIm1Im2
+   * @param currentArray
+   * @param fixedArray
+   * @param udims
+   * @param sampleOrigin
+   * @param spacing
+   * @param coarseFactor See CoarseToFineCrossCorrelate, 1 to correlate the full resolution windows only
+   * @return Local shift (x, y) and maximum of the correlation
+   */
+  template <typename T, unsigned int ImageDimension>
+  static std::vector<float> CorrelateTiles(const std::vector<float>& cropSpecsIm1Im2, const typename DataArray<T>::Pointer& currentArray, const typename DataArray<T>::Pointer& fixedArray,
+                                           const SizeVec3Type& udims, const FloatVec3Type& sampleOrigin, const FloatVec3Type& spacing, unsigned int coarseFactor)
+  {
+    using ItkBridgeType = ItkBridge<T>;
+    // The assumption is that we are working on a 2D image where the XY dims are in the 0 and 1 index of the udims variable
+    const size_t totalPoints = udims[0] * udims[1];
+    auto importFilter = ItkBridgeType::template Dream3DtoITKImportFilterDataArray<T>(totalPoints, udims, sampleOrigin, spacing, currentArray);
+    auto importFilter2 = ItkBridgeType::template Dream3DtoITKImportFilterDataArray<T>(totalPoints, udims, sampleOrigin, spacing, fixedArray);
+    if(coarseFactor > 1)
+    {
+      return CoarseToFineCrossCorrelate(cropSpecsIm1Im2, importFilter->GetOutput(), importFilter2->GetOutput(), coarseFactor);
+    }
+    return CropAndCrossCorrelate(cropSpecsIm1Im2, importFilter->GetOutput(), importFilter2->GetOutput());
+  }
 
-    float newXfromleft = 0;
-    float newYfromleft = 0;
+  /**
+   * @brief CoarseToFineCrossCorrelate Gives the same result as CropAndCrossCorrelate for large overlaps at a fraction
+   * of the cost. The windows are first cross correlated after downsampling them by 'coarseFactor', which estimates the
+   * shift within a few pixels. The shift is then refined at full resolution on a patch of the estimated overlap
+   * (at most RefinementPatchSize pixels wide), searching only the shifts within 2 * 'coarseFactor' pixels of the estimate.
+   * @param cropSpecsIm1Im2
+   * @param currentImage
+   * @param fixedImage
+   * @param coarseFactor
+   * @return Local shift (x, y) and maximum of the correlation
+   */
+  // clang-format off
+  template<typename PixelType, unsigned int ImageDimension>
+  static std::vector<float> CoarseToFineCrossCorrelate(const std::vector<float>& cropSpecsIm1Im2,
+                                                       itk::Image<PixelType, ImageDimension>* currentImage,
+                                                       itk::Image<PixelType, ImageDimension>* fixedImage,
+                                                       unsigned int coarseFactor)
+  {
+    // clang-format on
+    using ImageType = itk::Image<PixelType, ImageDimension>;
+    using RegionType = typename ImageType::RegionType;
+    using IndexType = typename ImageType::IndexType;
+    const unsigned int PlaneDimension = std::min(ImageDimension, 2u);
 
-    float newXfromtop = 0;
-    float newYfromtop = 0;
+    RegionType fixedRegion;
+    RegionType currentRegion;
+    for(unsigned int d = 0; d < ImageDimension && d < 3; d++)
+    {
+      fixedRegion.SetIndex(d, cropSpecsIm1Im2[d]);
+      fixedRegion.SetSize(d, cropSpecsIm1Im2[6 + d]);
+      currentRegion.SetIndex(d, cropSpecsIm1Im2[3 + d]);
+      currentRegion.SetSize(d, cropSpecsIm1Im2[9 + d]);
+    }
+    typename ImageType::Pointer fixedWindow = ExtractWindow(fixedImage, fixedRegion);
+    typename ImageType::Pointer currentWindow = ExtractWindow(currentImage, currentRegion);
 
-    using ItkBridgeType = ItkBridge<T>;
+    std::vector<float> newXYOrigin(3, 0);
 
-    // IMPORTANT:
-    // This method is set up a bit weird so hopefully this will help
-    // cropSpecIm1Im2 is a rather important variable so it's good to understand what each value means
-    // The first 6 values in the array are the crop origin that we'll be looking at (starts at the top left)
-    // The last 6 values in the array are the crop dimensions (size) that we'll look at (goes down to bottom right)
-    // The CropAndCrossCorrelate method crops the images and compares them with each other looking for a spike in similar values (a simplified explanation)
-    // The loop compares 2 images at once, so if you have a 3 x 3 image, the loop will only go through 8 times. You'll compare the second image with the first image
-    //		first thing so the first if statement will only trigger twice before triggering the second if statement
+    // COARSE: shift of the current window relative to the fixed window on the downsampled windows
+    using ShrinkFilterType = itk::BinShrinkImageFilter<ImageType, ImageType>;
+    typename ShrinkFilterType::ShrinkFactorsType shrinkFactors;
+    shrinkFactors.Fill(1);
+    for(unsigned int d = 0; d < PlaneDimension; d++)
+    {
+      shrinkFactors[d] = coarseFactor;
+    }
+    typename ShrinkFilterType::Pointer fixedShrink = ShrinkFilterType::New();
+    fixedShrink->SetInput(fixedWindow);
+    fixedShrink->SetShrinkFactors(shrinkFactors);
+    typename ShrinkFilterType::Pointer currentShrink = ShrinkFilterType::New();
+    currentShrink->SetInput(currentWindow);
+    currentShrink->SetShrinkFactors(shrinkFactors);
+    fixedShrink->Update();
+    currentShrink->Update();
+
+    IndexType coarseShift;
+    float peak = 0.0f;
+    if(!CorrelateWindows(fixedShrink->GetOutput(), currentShrink->GetOutput(), nullptr, coarseShift, peak))
+    {
+      // Flat correlation, same as CropAndCrossCorrelate
+      newXYOrigin[2] = peak;
+      return newXYOrigin;
+    }
 
-    for(size_t i = 1; i < combIndexList.size(); i++)
+    // FINE: full resolution patch of the overlap of the fixed window, and the same area of the current window enlarged
+    // by the search radius (twice the factor, for the rounding of the downsampled windows)
+    const itk::IndexValueType factor = static_cast<itk::IndexValueType>(coarseFactor);
+    const itk::IndexValueType radius = 2 * factor;
+    IndexType estimate;
+    RegionType fixedPatch;
+    RegionType currentPatch;
+    RegionType searchRange;
+    bool refine = true;
+    for(unsigned int d = 0; d < ImageDimension; d++)
     {
-      if(filter->getCancel())
+      const itk::IndexValueType size = static_cast<itk::IndexValueType>(fixedWindow->GetLargestPossibleRegion().GetSize(d));
+      const itk::IndexValueType currentSize = static_cast<itk::IndexValueType>(currentWindow->GetLargestPossibleRegion().GetSize(d));
+      const bool inPlane = d < PlaneDimension;
+      const itk::IndexValueType r = inPlane ? radius : 0;
+      estimate[d] = inPlane ? coarseShift[d] * factor : 0;
+
+      // Overlap of the two windows in the fixed window, minus the search radius
+      const itk::IndexValueType low = std::max<itk::IndexValueType>(0, estimate[d]) + r;
+      const itk::IndexValueType high = std::min(size, estimate[d] + currentSize) - r;
+      const itk::IndexValueType half = std::min<itk::IndexValueType>(RefinementPatchSize / 2, (high - low) / 2);
+      if(inPlane && half < 1)
       {
+        refine = false;
         break;
       }
+      const itk::IndexValueType center = (low + high) / 2;
+      const itk::IndexValueType patchStart = inPlane ? center - half : 0;
+      const itk::IndexValueType patchSize = inPlane ? 2 * half : size;
+      fixedPatch.SetIndex(d, patchStart);
+      fixedPatch.SetSize(d, static_cast<itk::SizeValueType>(patchSize));
+
+      const itk::IndexValueType currentStart = std::max<itk::IndexValueType>(0, patchStart - estimate[d] - r);
+      const itk::IndexValueType currentEnd = std::min(currentSize, patchStart - estimate[d] + patchSize + r);
+      currentPatch.SetIndex(d, currentStart);
+      currentPatch.SetSize(d, static_cast<itk::SizeValueType>(std::max<itk::IndexValueType>(currentEnd - currentStart, 1)));
+
+      // Shifts of the current patch relative to the fixed patch that are within the radius of the estimate
+      searchRange.SetIndex(d, estimate[d] - r + currentStart - patchStart);
+      searchRange.SetSize(d, static_cast<itk::SizeValueType>(2 * r + 1));
+    }
 
-      filter->notifyStatusMessage(QString("Refining Origin For Image %1").arg(i));
-      if(i < numXtiles) // if the image is in the top row of images, we need only the image to the left
+    IndexType shift = estimate;
+    if(refine)
+    {
+      typename ImageType::Pointer fixedPatchImage = ExtractWindow(fixedWindow.GetPointer(), fixedPatch);
+      typename ImageType::Pointer currentPatchImage = ExtractWindow(currentWindow.GetPointer(), currentPatch);
+      IndexType patchShift;
+      if(CorrelateWindows(fixedPatchImage.GetPointer(), currentPatchImage.GetPointer(), &searchRange, patchShift, peak))
       {
-#if WRITE_DEBUG_IMAGES
-        qDebug() << "LEFT: DataContainer: " << dataContainerNames[combIndexList[i]] << ", " << dataContainerNames[combIndexList[i - 1]];
-        qDebug() << "\t" << combIndexList[i] << "\t" << combIndexList[i - 1];
-#endif
-        importFilter = ItkBridgeType::template Dream3DtoITKImportFilterDataArray<PixelType>(totalPoints, udims, sampleOrigin, spacing, dataArrayList[combIndexList[i]]);
-        currentImage = importFilter->GetOutput();
-        importFilter2 = ItkBridgeType::template Dream3DtoITKImportFilterDataArray<PixelType>(totalPoints, udims, sampleOrigin, spacing, dataArrayList[combIndexList[i - 1]]);
-        leftImage = importFilter2->GetOutput();
-
-        // Determine the windows to be cross correlated depending on the rough overlap as found from the global coordinates
-        cropSpecsIm1Im2[0] =
-            udims[0] -
-            (udims[0] * (overlapPer / 100)); // Width of the image * the percentage (say 20%) = the size of the crop we're looking at. Subtract that from the width of the image and you have the origin
-        cropSpecsIm1Im2[1] = 0;              // left image Y Origin
-        cropSpecsIm1Im2[2] = 0;              // left image Z Origin
-        cropSpecsIm1Im2[3] = 0;              // current image X Origin
-        cropSpecsIm1Im2[4] = 0;              // current image Y Origin
-        cropSpecsIm1Im2[5] = 0;              // current image Z Origin
-
-        cropSpecsIm1Im2[6] = udims[0] * (overlapPer / 100); // left image X Size
-        cropSpecsIm1Im2[7] = udims[1];                      // left image Y Size
-        cropSpecsIm1Im2[8] = 1;                             // left image Z Size
-        cropSpecsIm1Im2[9] = udims[0] * (overlapPer / 100); // current image X Size
-        cropSpecsIm1Im2[10] = udims[1];                     // current image Y Size
-        cropSpecsIm1Im2[11] = 1;                            // current image Z Size
-
-        // Cross correlate the image windows and return the local shifts between the two images
-        newXYOrigin = CropAndCrossCorrelate(cropSpecsIm1Im2, currentImage, leftImage);
-
-        previousXleft = xyStitchedGlobalListPtr->getValue(2 * (i - 1));
-        previousYleft = xyStitchedGlobalListPtr->getValue(2 * (i - 1) + 1);
-
-        newXfromleft = previousXleft + cropSpecsIm1Im2[0] + newXYOrigin[0];
-        newYfromleft = previousYleft + newXYOrigin[1];
-
-        xyStitchedGlobalListPtr->setValue(2 * i, newXfromleft);
-        xyStitchedGlobalListPtr->setValue(2 * i + 1, newYfromleft);
+        for(unsigned int d = 0; d < PlaneDimension; d++)
+        {
+          shift[d] = patchShift[d] - currentPatch.GetIndex(d) + fixedPatch.GetIndex(d);
+        }
       }
-      else if(i % numXtiles == 0) // if the image is in the first (left most) column of images, we only need the top image
-      {
-#if WRITE_DEBUG_IMAGES
-        qDebug() << "TOP: DataContainer: " << dataContainerNames[combIndexList[i]] << ", " << dataContainerNames[combIndexList[i - numXtiles]];
-        qDebug() << "\t" << combIndexList[i] << "\t" << combIndexList[i - numXtiles];
+    }
+
+    // CropAndCrossCorrelate reports the index of the peak minus the window size, which is the shift minus one
+    newXYOrigin[0] = static_cast<float>(shift[0] - 1);
+    newXYOrigin[1] = static_cast<float>(shift[1] - 1);
+    newXYOrigin[2] = peak;
+    return newXYOrigin;
+  }
+
+  /**
+   * @brief ExtractWindow Copies 'region' of 'image' into a new image with its origin at 0, as the cross correlation
+   * filter requires
+   * @param image
+   * @param region
+   * @return
+   */
+  template <typename ImageType>
+  static typename ImageType::Pointer ExtractWindow(const ImageType* image, const typename ImageType::RegionType& region)
+  {
+    using ExtractFilterType = itk::RegionOfInterestImageFilter<ImageType, ImageType>;
+    typename ExtractFilterType::Pointer extractFilter = ExtractFilterType::New();
+    extractFilter->SetRegionOfInterest(region);
+    extractFilter->SetInput(image);
+    extractFilter->Update();
+    typename ImageType::Pointer window = extractFilter->GetOutput();
+    window->DisconnectPipeline();
+    typename ImageType::PointType origin;
+    origin.Fill(0.0);
+    window->SetOrigin(origin);
+    return window;
+  }
+
+  /**
+   * @brief CorrelateWindows Cross correlates two windows (see CropAndCrossCorrelate) and returns in 'shift' the position
+   * of the moving window relative to the fixed window at the correlation peak, searching only the shifts of
+   * 'searchRange' when it is set. Returns false if the correlation is flat.
+   * @param fixedWindow
+   * @param movingWindow
+   * @param searchRange
+   * @param shift
+   * @param peak Maximum of the correlation
+   * @return
+   */
+  template <typename ImageType>
+  static bool CorrelateWindows(const ImageType* fixedWindow, const ImageType* movingWindow, const typename ImageType::RegionType* searchRange, typename ImageType::IndexType& shift, float& peak)
+  {
+    using FloatImageType = itk::Image<float, ImageType::ImageDimension>;
+    using XCFilterType = itk::MaskedFFTNormalizedCorrelationImageFilter<ImageType, FloatImageType, ImageType>;
+    typename XCFilterType::Pointer xCorrFilter = XCFilterType::New();
+    xCorrFilter->SetFixedImage(fixedWindow);
+    xCorrFilter->SetMovingImage(movingWindow);
+    xCorrFilter->SetRequiredFractionOfOverlappingPixels(0.5);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    // The pairs of tiles are cross correlated in parallel (see FindGlobalOrigins)
+    ITKExecutionPolicy::ApplyToNestedFilter(xCorrFilter);
 #endif
-        importFilter = ItkBridgeType::template Dream3DtoITKImportFilterDataArray<PixelType>(totalPoints, udims, sampleOrigin, spacing, dataArrayList[combIndexList[i]]);
-        currentImage = importFilter->GetOutput();
-        importFilter2 = ItkBridgeType::template Dream3DtoITKImportFilterDataArray<PixelType>(totalPoints, udims, sampleOrigin, spacing, dataArrayList[combIndexList[i - numXtiles]]);
-        aboveImage = importFilter2->GetOutput();
-
-        // Determine the windows to be cross correlated depending on the rough overlap as found from the global coordinates
-        cropSpecsIm1Im2[0] = 0; // top image X Origin
-        cropSpecsIm1Im2[1] =
-            udims[1] - (udims[1] * (overlapPer / 100)); // yGlobCoordsList[combIndexList[i]] - xyStitchedGlobalListPtr->getValue(2*(i-numXtiles)+1) - yGlobCoordsList[0]; //top image Y Origin
-        cropSpecsIm1Im2[2] = 0;                         // top image Z Origin
-        cropSpecsIm1Im2[3] = 0;                         // current image X Origin
-        cropSpecsIm1Im2[4] = 0;                         // current image Y Origin
-        cropSpecsIm1Im2[5] = 0;                         // current image Z Origin
-
-        cropSpecsIm1Im2[6] = udims[0];                       // top image X Size
-        cropSpecsIm1Im2[7] = udims[1] * (overlapPer / 100);  // top image Y Size
-        cropSpecsIm1Im2[8] = 1;                              // top image Z Size
-        cropSpecsIm1Im2[9] = udims[0];                       // current image X Size
-        cropSpecsIm1Im2[10] = udims[1] * (overlapPer / 100); // current image Y Size
-        cropSpecsIm1Im2[11] = 1;                             // current image Z Size
-
-        // Cross correlate the image windows and return the local shifts between the two images
-        newXYOrigin = CropAndCrossCorrelate(cropSpecsIm1Im2, currentImage, aboveImage);
-
-        previousXtop = xyStitchedGlobalListPtr->getValue(2 * (i - numXtiles));
-        previousYtop = xyStitchedGlobalListPtr->getValue(2 * (i - numXtiles) + 1);
-
-        // Add the local shifts to the preivous global value to get the current stitched global shift
-        newXfromtop = previousXtop + newXYOrigin[0];
-        newYfromtop = previousYtop + newXYOrigin[1] + cropSpecsIm1Im2[1];
-
-        xyStitchedGlobalListPtr->setValue(2 * i, newXfromtop);
-        xyStitchedGlobalListPtr->setValue(2 * i + 1, newYfromtop);
+    xCorrFilter->Update();
+    const FloatImageType* correlation = xCorrFilter->GetOutput();
+
+    // The output index of a shift is the shift plus the size of the moving window minus one
+    const typename ImageType::SizeType movingSize = movingWindow->GetLargestPossibleRegion().GetSize();
+    typename FloatImageType::RegionType region = correlation->GetLargestPossibleRegion();
+    if(nullptr != searchRange)
+    {
+      typename FloatImageType::RegionType searchRegion;
+      for(unsigned int d = 0; d < ImageType::ImageDimension; d++)
+      {
+        searchRegion.SetIndex(d, searchRange->GetIndex(d) + static_cast<itk::IndexValueType>(movingSize[d]) - 1);
+        searchRegion.SetSize(d, searchRange->GetSize(d));
       }
-      else // for all other images, we need to match to the top and the left
+      if(!searchRegion.Crop(region))
       {
-#if WRITE_DEBUG_IMAGES
-        qDebug() << "TOP/LEFT: DataContainer: " << dataContainerNames[combIndexList[i]] << ", " << dataContainerNames[combIndexList[i - numXtiles]];
-        qDebug() << "\t" << combIndexList[i] << "\t" << combIndexList[i - numXtiles];
-#endif
-        /// TOP IMAGE FIRST
-        importFilter = ItkBridgeType::template Dream3DtoITKImportFilterDataArray<PixelType>(totalPoints, udims, sampleOrigin, spacing, dataArrayList[combIndexList[i]]);
-        currentImage = importFilter->GetOutput();
-        importFilter2 = ItkBridgeType::template Dream3DtoITKImportFilterDataArray<PixelType>(totalPoints, udims, sampleOrigin, spacing, dataArrayList[combIndexList[i - numXtiles]]);
-        aboveImage = importFilter2->GetOutput();
-
-        // Determine the windows to be cross correlated depending on the rough overlap as found from the global coordinates
-        cropSpecsIm1Im2[0] = 0; // top image X Origin
-        cropSpecsIm1Im2[1] =
-            udims[1] - (udims[1] * (overlapPer / 100)); // yGlobCoordsList[combIndexList[i]] - xyStitchedGlobalListPtr->getValue(2*(i-numXtiles)+1) - yGlobCoordsList[0]; //top image Y Origin
-        cropSpecsIm1Im2[2] = 0;                         // top image Z Origin
-        cropSpecsIm1Im2[3] = 0;                         // current image X Origin
-        cropSpecsIm1Im2[4] = 0;                         // current image Y Origin
-        cropSpecsIm1Im2[5] = 0;                         // current image Z Origin
-
-        cropSpecsIm1Im2[6] = udims[0];                       // top image X Size
-        cropSpecsIm1Im2[7] = udims[1] * (overlapPer / 100);  // top image Y Size
-        cropSpecsIm1Im2[8] = 1;                              // top image Z Size
-        cropSpecsIm1Im2[9] = udims[0];                       // current image X Size
-        cropSpecsIm1Im2[10] = udims[1] * (overlapPer / 100); // current image Y Size
-        cropSpecsIm1Im2[11] = 1;                             // current image Z Size
-
-        // Cross correlate the image windows and return the local shifts between the two images
-        newXYOrigin2 = CropAndCrossCorrelate(cropSpecsIm1Im2, currentImage, aboveImage);
-
-        previousXtop = xyStitchedGlobalListPtr->getValue(2 * (i - numXtiles));
-        previousYtop = xyStitchedGlobalListPtr->getValue(2 * (i - numXtiles) + 1);
-
-        // Add the local shifts to the preivous global value to get the current stitched global shift
-        newXfromtop = previousXtop + newXYOrigin2[0];
-        newYfromtop = previousYtop + newXYOrigin2[1] + cropSpecsIm1Im2[1];
-
-#if WRITE_DEBUG_IMAGES
-        qDebug() << "TOP/LEFT: DataContainer: " << dataContainerNames[combIndexList[i]] << ", " << dataContainerNames[combIndexList[i - 1]];
-        qDebug() << "\t" << combIndexList[i] << "\t" << combIndexList[i - 1];
-#endif
-        // BOTTOM IMAGE NEXT
-        importFilter = ITKUtilitiesType::template Dream3DtoITKImportFilterDataArray<PixelType>(totalPoints, udims, sampleOrigin, spacing, dataArrayList[combIndexList[i]]);
-        currentImage = importFilter->GetOutput();
-        importFilter2 = ITKUtilitiesType::template Dream3DtoITKImportFilterDataArray<PixelType>(totalPoints, udims, sampleOrigin, spacing, dataArrayList[combIndexList[i - 1]]);
-        leftImage = importFilter2->GetOutput();
-
-        cropSpecsIm1Im2[0] = udims[0] - (udims[0] * (overlapPer / 100)); // xGlobCoordsList[combIndexList[i]] - xyStitchedGlobalListPtr->getValue(2*(i-1)) - xGlobCoordsList[0]; //left image X Origin
-        cropSpecsIm1Im2[1] = 0;                                          // left image Y Origin
-        cropSpecsIm1Im2[2] = 0;                                          // left image Z Origin
-        cropSpecsIm1Im2[3] = 0;                                          // current image X Origin
-        cropSpecsIm1Im2[4] = 0;                                          // current image Y Origin
-        cropSpecsIm1Im2[5] = 0;                                          // current image Z Origin
-
-        cropSpecsIm1Im2[6] = udims[0] * (overlapPer / 100); // left image X Size
-        cropSpecsIm1Im2[7] = udims[1];                      // left image Y Size
-        cropSpecsIm1Im2[8] = 1;                             // left image Z Size
-        cropSpecsIm1Im2[9] = udims[0] * (overlapPer / 100); // current image X Size
-        cropSpecsIm1Im2[10] = udims[1];                     // current image Y Size
-        cropSpecsIm1Im2[11] = 1;                            // current image Z Size
-
-        // Cross correlate the image windows and return the local shifts between the two images
-        newXYOrigin = CropAndCrossCorrelate(cropSpecsIm1Im2, currentImage, leftImage);
-
-        previousXleft = xyStitchedGlobalListPtr->getValue(2 * (i - 1));
-        previousYleft = xyStitchedGlobalListPtr->getValue(2 * (i - 1) + 1);
-
-        // Add the local shifts to the preivous global value to get the current stitched global shift
-        newXfromleft = previousXleft + cropSpecsIm1Im2[0] + newXYOrigin[0];
-        newYfromleft = previousYleft + newXYOrigin[1];
-
-        // AVERAGE the two new locations
-        xyStitchedGlobalListPtr->setValue(2 * i, (newXfromtop + newXfromleft) / 2.0);
-        xyStitchedGlobalListPtr->setValue(2 * i + 1, (newYfromtop + newYfromleft) / 2.0);
+        return false;
       }
-
-      // Put the values found in from going in the comb order into another data array which represents the original order the images came in as
-      xyStitchedGlobalListPtr_orig->setValue(2 * combIndexList[i], xyStitchedGlobalListPtr->getValue(2 * i));
-      xyStitchedGlobalListPtr_orig->setValue(2 * combIndexList[i] + 1, xyStitchedGlobalListPtr->getValue(2 * i + 1));
+      region = searchRegion;
     }
 
-    return xyStitchedGlobalListPtr_orig;
+    itk::ImageRegionConstIteratorWithIndex<FloatImageType> iter(correlation, region);
+    float minimum = itk::NumericTraits<float>::max();
+    peak = itk::NumericTraits<float>::NonpositiveMin();
+    typename FloatImageType::IndexType peakIndex = region.GetIndex();
+    for(iter.GoToBegin(); !iter.IsAtEnd(); ++iter)
+    {
+      const float value = iter.Get();
+      minimum = std::min(minimum, value);
+      if(value > peak)
+      {
+        peak = value;
+        peakIndex = iter.GetIndex();
+      }
+    }
+    for(unsigned int d = 0; d < ImageType::ImageDimension; d++)
+    {
+      shift[d] = peakIndex[d] - static_cast<itk::IndexValueType>(movingSize[d]) + 1;
+    }
+    return minimum != peak;
   }
 
+  /**
+   * @brief ChainTileOrigins Places the tiles in comb order: each tile is placed from the origin of its left and/or
+   * top neighbour plus the shift between them, averaged when it has both
+   * @param numXtiles
+   * @param leftShifts Shift between each tile and its left neighbour (empty in the first column)
+   * @param topShifts Shift between each tile and its top neighbour (empty in the first row)
+   * @param leftCropSpecs
+   * @param topCropSpecs
+   * @return Origins (x, y) of the tiles in comb order
+   */
+  static std::vector<float> ChainTileOrigins(size_t numXtiles, const std::vector<std::vector<float>>& leftShifts, const std::vector<std::vector<float>>& topShifts,
+                                             const std::vector<float>& leftCropSpecs, const std::vector<float>& topCropSpecs);
+
+  /**
+   * @brief SolveTileOrigins Places all the tiles at once: the origins minimize the sum of the squared differences
+   * between the measured and the fitted offset of each pair of neighbours, weighted by the correlation peak of
+   * the pair. The first tile stays at (0, 0). When 'rejectOutlierPairs' is set, the pairs whose residual is far
+   * above the median residual are dropped and the system is solved again.
+   * @param numXtiles
+   * @param leftShifts See ChainTileOrigins
+   * @param topShifts See ChainTileOrigins
+   * @param leftCropSpecs
+   * @param topCropSpecs
+   * @param rejectOutlierPairs
+   * @return Origins (x, y) of the tiles in comb order
+   */
+  static std::vector<float> SolveTileOrigins(size_t numXtiles, const std::vector<std::vector<float>>& leftShifts, const std::vector<std::vector<float>>& topShifts,
+                                             const std::vector<float>& leftCropSpecs, const std::vector<float>& topCropSpecs, bool rejectOutlierPairs);
+
+  /**
+   * @brief SolvePairOffsets Weighted least-squares fit of the origins of 'numTiles' tiles to the measured offsets
+   * of the pairs, with the first tile at (0, 0). See SolveTileOrigins.
+   * @param numTiles
+   * @param pairs
+   * @param rejectOutlierPairs
+   * @param origins Origins (x, y) of the tiles, resized to 2 * numTiles
+   * @return false when some tiles are not connected to the first one, in which case 'origins' is not usable
+   */
+  static bool SolvePairOffsets(size_t numTiles, const std::vector<TilePair>& pairs, bool rejectOutlierPairs, std::vector<float>& origins);
+
+  /**
+   * @brief CreatePairBatches Splits the pairs of neighbouring tiles of a grid into four batches: horizontal pairs
+   * starting on even columns, on odd columns, then vertical pairs starting on even rows, on odd rows. No tile
+   * belongs to two pairs of the same batch, so the pairs of a batch can be registered at the same time.
+   * @param numCols
+   * @param numRows
+   * @return Pairs of each batch, with the tiles indexed in row-major order and Neighbour left of or above Current
+   */
+  static std::array<std::vector<TilePair>, 4> CreatePairBatches(size_t numCols, size_t numRows);
+
+  /**
+   * @brief GetLeftCropSpecs Returns the windows cross correlated between an image and the image on its left:
+   * the right part of the left image and the left part of the current image
+   * @param udims
+   * @param overlapPer
+   * @return
+   */
+  static std::vector<float> GetLeftCropSpecs(const SizeVec3Type& udims, float overlapPer);
+
+  /**
+   * @brief GetTopCropSpecs Returns the windows cross correlated between an image and the image above it:
+   * the bottom part of the top image and the top part of the current image
+   * @param udims
+   * @param overlapPer
+   * @return
+   */
+  static std::vector<float> GetTopCropSpecs(const SizeVec3Type& udims, float overlapPer);
+
+  /**
+   * @brief GetMaximumConcurrentPairs Returns how many pairs of tiles may be cross correlated at once: the number of
+   * threads, lowered so that the estimated memory of the correlations fits in the memory budget of ITKExecutionPolicy
+   * @param udims
+   * @param overlapPer
+   * @param pixelSize
+   * @return
+   */
+  static uint32_t GetMaximumConcurrentPairs(const SizeVec3Type& udims, float overlapPer, size_t pixelSize);
+
+  /**
+   * @brief Largest width of the full resolution patch CoarseToFineCrossCorrelate refines the shift on
+   */
+  static const itk::IndexValueType RefinementPatchSize = 512;
+
   /**
    * @brief ReturnIndexForCombOrder
    * @param xTileList
@@ -441,6 +652,10 @@ public:
     xCorrFilter->SetFixedImage(fixedImageWindow2);
     xCorrFilter->SetMovingImage(currentImageWindow2);
     xCorrFilter->SetRequiredFractionOfOverlappingPixels(0.5); // currently require that the windows overlap at least 50percent. Might want to make this a user controlled variable
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    // The pairs of tiles are cross correlated in parallel (see FindGlobalOrigins)
+    ITKExecutionPolicy::ApplyToNestedFilter(xCorrFilter);
+#endif
     xCorrFilter->Update();
     ImageProcessingConstants::FloatImageType* xcoutputImage = xCorrFilter->GetOutput();
 
@@ -6,15 +6,19 @@
 //-----------------------------------------------------------------------------
 
 #include "FFTAmoeba.h"
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
+#include <random>
 #include <vector>
 
 #include <vnl/vnl_cost_function.h>
 #include <vnl/vnl_least_squares_function.h>
 #include <vnl/vnl_math.h>
 
+#include "SIMPLib/Utilities/ParallelTaskAlgorithm.h"
+
 #include "ITKImageProcessing/ITKImageProcessingFilters/CalcDewarpParameters.h"
 
 bool fft_amoeba::default_verbose = false;
@@ -29,6 +33,9 @@ fft_amoeba::fft_amoeba(vnl_cost_function& f)
   F_tolerance = 1e-4;
   relative_diameter = 0.05;
   zero_term_delta = 0.00025;
+  parallel_evaluation = false;
+  number_of_starts = 1;
+  m_Cancelled = std::make_shared<std::atomic<bool>>(false);
 }
 
 struct fft_amoebaFit : public fft_amoeba
@@ -56,11 +63,37 @@ struct fft_amoebaFit : public fft_amoeba
   //: Perform optimisation, given simplex to start
   void amoeba(vnl_vector<double>& x, std::vector<fft_amoeba_SimplexCorner>& simplex);
 
+  //: Perform one step evaluating all the candidate points concurrently.
+  //  Returns the name of the step taken.
+  const char* parallel_step(std::vector<fft_amoeba_SimplexCorner>& simplex, const vnl_vector<double>& vbar);
+
   double f(const vnl_vector<double>& x)
   {
     return fptr->f(x);
   }
 
+  //: Evaluate the corners, concurrently if parallel_evaluation is set
+  void evaluate_corners(const std::vector<fft_amoeba_SimplexCorner*>& corners)
+  {
+    if(!parallel_evaluation)
+    {
+      for(auto* corner : corners)
+        corner->fv = f(corner->v);
+      return;
+    }
+    ParallelTaskAlgorithm taskAlg;
+    for(auto* corner : corners)
+    {
+      taskAlg.execute([this, corner]() { corner->fv = f(corner->v); });
+    }
+    taskAlg.wait();
+  }
+
+  static vnl_vector<double> a_plus_bl(const vnl_vector<double>& vbar, const vnl_vector<double>& v, double lambda)
+  {
+    return (1 - lambda) * vbar + lambda * v;
+  }
+
   void set_corner(fft_amoeba_SimplexCorner* s, const vnl_vector<double>& v)
   {
     s->v = v;
@@ -69,7 +102,7 @@ struct fft_amoebaFit : public fft_amoeba
   }
   void set_corner_a_plus_bl(fft_amoeba_SimplexCorner* s, const vnl_vector<double>& vbar, const vnl_vector<double>& v, double lambda)
   {
-    s->v = (1 - lambda) * vbar + lambda * v;
+    s->v = a_plus_bl(vbar, v, lambda);
     s->fv = f(s->v);
     cnt++;
   }
@@ -163,7 +196,6 @@ void fft_amoebaFit::set_up_simplex_relative(std::vector<fft_amoeba_SimplexCorner
   int n = x.size();
 
   simplex[0].v = x;
-  simplex[0].fv = f(x);
 
   // Following improvement suggested by L.Pfeffer at Stanford
   const double usual_delta = relative_diameter; // 5 percent deltas for non-zero terms
@@ -179,9 +211,12 @@ void fft_amoebaFit::set_up_simplex_relative(std::vector<fft_amoeba_SimplexCorner
       s->v[j] = (1 + usual_delta) * s->v[j];
     else
       s->v[j] = zero_term_delta;
-
-    s->fv = f(s->v);
   }
+
+  std::vector<fft_amoeba_SimplexCorner*> corners;
+  for(auto& corner : simplex)
+    corners.push_back(&corner);
+  evaluate_corners(corners);
 }
 
 //: Initialise the simplex given one corner, x and displacements of others
@@ -190,7 +225,6 @@ void fft_amoebaFit::set_up_simplex_absolute(std::vector<fft_amoeba_SimplexCorner
   int n = x.size();
 
   simplex[0].v = x;
-  simplex[0].fv = f(x);
 
   for(int j = 0; j < n; ++j)
   {
@@ -199,9 +233,12 @@ void fft_amoebaFit::set_up_simplex_absolute(std::vector<fft_amoeba_SimplexCorner
 
     // perturb s->v(j)
     s->v[j] = s->v[j] + dx[j];
-
-    s->fv = f(s->v);
   }
+
+  std::vector<fft_amoeba_SimplexCorner*> corners;
+  for(auto& corner : simplex)
+    corners.push_back(&corner);
+  evaluate_corners(corners);
 }
 
 //: FMINS Minimize a function of several variables.
@@ -273,7 +310,7 @@ void fft_amoebaFit::amoeba(vnl_vector<double>& x, std::vector<fft_amoeba_Simplex
   fft_amoeba_SimplexCorner* next;
 
   vnl_vector<double> vbar(n);
-  while(cnt < maxiter)
+  while(cnt < maxiter && !*m_Cancelled)
   {
     frac_range = fractional_range(simplex);
     if(frac_range < F_tolerance)
@@ -288,6 +325,21 @@ void fft_amoebaFit::amoeba(vnl_vector<double>& x, std::vector<fft_amoeba_Simplex
       vbar[k] /= n;
     }
 
+    if(parallel_evaluation)
+    {
+      const char* how = parallel_step(simplex, vbar);
+      sort_simplex(simplex);
+      if(verbose)
+      {
+        std::cerr << "iter " << cnt << ": " << how << ' ' << simplex << '\n';
+      }
+      if(simpl_filter)
+      {
+        simpl_filter->notifyStatusMessage(QString("Completed %1 iterations").arg(cnt));
+      }
+      continue;
+    }
+
     set_corner_a_plus_bl(&reflect, vbar, simplex[n].v, -1);
 
     next = &reflect;
@@ -368,37 +420,140 @@ void fft_amoebaFit::amoeba(vnl_vector<double>& x, std::vector<fft_amoeba_Simplex
   end_error_ = simplex[0].fv;
 }
 
-//: Set max iterations to 0 to stop optimizing
-void fft_amoeba::cancel()
+//: One step of the Nelder-Mead simplex algorithm, evaluating every point the
+//  sequential step may need at once.  Only the evaluations the sequential step
+//  would have made are counted, so maxiter has the same meaning in both modes.
+const char* fft_amoebaFit::parallel_step(std::vector<fft_amoeba_SimplexCorner>& simplex, const vnl_vector<double>& vbar)
 {
-  if(m_Fit)
+  int n = static_cast<int>(simplex.size()) - 1;
+
+  fft_amoeba_SimplexCorner reflect(n);
+  fft_amoeba_SimplexCorner expand(n);
+  fft_amoeba_SimplexCorner contractWorst(n);
+  fft_amoeba_SimplexCorner contractReflect(n);
+  reflect.v = a_plus_bl(vbar, simplex[n].v, -1);
+  expand.v = a_plus_bl(vbar, reflect.v, 2);
+  contractWorst.v = a_plus_bl(vbar, simplex[n].v, 0.5);
+  contractReflect.v = a_plus_bl(vbar, reflect.v, 0.5);
+  evaluate_corners({&reflect, &expand, &contractWorst, &contractReflect});
+  cnt++;
+
+  if(reflect.fv < simplex[n - 1].fv)
   {
-    m_Fit->maxiter = 0;
+    // Reflection not totally crap...
+    if(reflect.fv < simplex[0].fv)
+    {
+      // Reflection actually the best, try expanding
+      cnt++;
+      if(expand.fv < simplex[0].fv)
+      {
+        simplex[n] = expand;
+        return "expand  ";
+      }
+    }
+    simplex[n] = reflect;
+    return "reflect ";
+  }
+
+  // Reflection *is* totally crap, contract towards the better of the reflection and simplex[n]
+  cnt++;
+  const fft_amoeba_SimplexCorner& contract = (reflect.fv < simplex[n].fv) ? contractReflect : contractWorst;
+  if(contract.fv < simplex[0].fv)
+  {
+    // The contraction point was really good, hold it there
+    simplex[n] = contract;
+    return "contract";
+  }
+
+  // The contraction point was only average, shrink the entire simplex.
+  std::vector<fft_amoeba_SimplexCorner*> corners;
+  for(int j = 1; j <= n; ++j)
+  {
+    simplex[j].v = a_plus_bl(simplex[0].v, simplex[j].v, 0.5);
+    corners.push_back(&simplex[j]);
   }
+  evaluate_corners(corners);
+  cnt += n;
+  return "shrink  ";
+}
+
+//: Stop all the simplices of the current and following minimizations
+void fft_amoeba::cancel()
+{
+  *m_Cancelled = true;
 }
 
 //: Modify x to minimise function supplied in constructor
 //  Start simplex defined by scaling elements of x
 void fft_amoeba::minimize(vnl_vector<double>& x)
 {
-  m_Fit = new fft_amoebaFit(*this);
-  m_Fit->amoeba(x);
-  num_evaluations_ = m_Fit->num_evaluations_;
-  end_error_ = m_Fit->end_error_;
-  frac_range = m_Fit->frac_range;
-  delete m_Fit;
-  m_Fit = nullptr;
+  fft_amoebaFit fit(*this);
+  fit.amoeba(x);
+  num_evaluations_ = fit.num_evaluations_;
+  end_error_ = fit.end_error_;
+  frac_range = fit.frac_range;
 }
 
 //: Perform optimisation.  Start simplex defined by adding dx[i] to each x[i]
 void fft_amoeba::minimize(vnl_vector<double>& x, const vnl_vector<double>& dx)
 {
-  m_Fit = new fft_amoebaFit(*this);
-  m_Fit->amoeba(x, dx);
-  num_evaluations_ = m_Fit->num_evaluations_;
-  end_error_ = m_Fit->end_error_;
-  delete m_Fit;
-  m_Fit = nullptr;
+  if(number_of_starts > 1)
+  {
+    minimize_multi_start(x, dx);
+    return;
+  }
+  fft_amoebaFit fit(*this);
+  fit.amoeba(x, dx);
+  num_evaluations_ = fit.num_evaluations_;
+  end_error_ = fit.end_error_;
+}
+
+//: Run number_of_starts simplices concurrently and keep the best end point.
+//  The starts are drawn with a fixed seed so that a run can be repeated.  Each
+//  simplex gets an even share of maxiter, so that the starts together make about
+//  as many evaluations as a single simplex would.
+void fft_amoeba::minimize_multi_start(vnl_vector<double>& x, const vnl_vector<double>& dx)
+{
+  std::vector<vnl_vector<double>> starts(number_of_starts, x);
+  std::mt19937_64 generator(0);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  for(int i = 1; i < number_of_starts; ++i)
+  {
+    for(unsigned j = 0; j < x.size(); ++j)
+      starts[i][j] += distribution(generator) * dx[j];
+  }
+
+  const int maxiterPerStart = std::max(maxiter / number_of_starts, 1);
+  std::vector<std::unique_ptr<fft_amoebaFit>> fits;
+  for(int i = 0; i < number_of_starts; ++i)
+  {
+    fits.emplace_back(new fft_amoebaFit(*this));
+    fits.back()->maxiter = maxiterPerStart;
+    if(i > 0)
+    {
+      // Only the simplex from x reports its progress
+      fits.back()->simpl_filter = nullptr;
+    }
+  }
+
+  ParallelTaskAlgorithm taskAlg;
+  for(int i = 0; i < number_of_starts; ++i)
+  {
+    taskAlg.execute([&fits, &starts, &dx, i]() { fits[i]->amoeba(starts[i], dx); });
+  }
+  taskAlg.wait();
+
+  int best = 0;
+  num_evaluations_ = fits[0]->num_evaluations_;
+  for(int i = 1; i < number_of_starts; ++i)
+  {
+    if(fits[i]->end_error_ < fits[best]->end_error_)
+      best = i;
+    num_evaluations_ += fits[i]->num_evaluations_;
+  }
+  x = starts[best];
+  end_error_ = fits[best]->end_error_;
+  frac_range = fits[best]->frac_range;
 }
 
 //: Static method
@@ -17,6 +17,9 @@
 
 //-----------------------------------------------------------------------------
 
+#include <atomic>
+#include <memory>
+
 #include <vnl/algo/vnl_algo_export.h>
 #include <vnl/vnl_vector.h>
 
@@ -82,10 +85,32 @@ public:
   {
     zero_term_delta = d;
   }
+
+  //: Evaluate the points of each step that do not depend on each other concurrently.
+  //  The initial vertices, the reflection, expansion and both contraction candidates,
+  //  and the shrunk vertices are each evaluated at once.  The decisions are the ones
+  //  of the sequential algorithm, so the simplex follows the same path.  The function
+  //  supplied in the constructor must be safe to call from several threads.
+  void set_parallel_evaluation(bool b)
+  {
+    parallel_evaluation = b;
+  }
+
+  //: Define the number of simplices minimize(x,dx) runs concurrently.  The first one
+  //  starts from x, the others from x moved by up to dx[i] along each axis.  The best
+  //  end point is kept.  maxiter is shared evenly between the simplices, and
+  //  get_num_evaluations() returns the evaluations of all of them.  The function must
+  //  then be safe to call from several threads.
+  void set_number_of_starts(int n)
+  {
+    number_of_starts = n;
+  }
   //: Scaling used to select starting vertices relative to initial x0.
   //  I.e. the i'th vertex has x[i] = x0[i]*(1+relative_diameter)
   double relative_diameter;
   double zero_term_delta;
+  bool parallel_evaluation;
+  int number_of_starts;
   //: Construct and supply function to be minimized
   fft_amoeba(vnl_cost_function& f);
 
@@ -102,7 +127,7 @@ public:
     return end_error_;
   }
 
-  //: Number of evaluations used in last call to minimize
+  //: Number of evaluations used in last call to minimize, summed over all the starts
   int get_num_evaluations() const
   {
     return num_evaluations_;
@@ -139,12 +164,16 @@ public:
   static bool default_verbose;
 
 protected:
+  //: Run number_of_starts simplices from perturbed copies of x and keep the best
+  void minimize_multi_start(vnl_vector<double>& x, const vnl_vector<double>& dx);
+
   vnl_cost_function* fptr;
   double end_error_;
   int num_evaluations_;
   double frac_range;
   AbstractFilter* simpl_filter = nullptr;
-  fft_amoebaFit* m_Fit = nullptr;
+  // Shared with the fits so that cancel() stops all the simplices
+  std::shared_ptr<std::atomic<bool>> m_Cancelled;
 };
 
 // Private struct needs to be declared in the header file
@@ -20,6 +20,44 @@
 
 #include "SIMPLib/Filtering/AbstractFilter.h"
 
+namespace
+{
+/**
+ * @brief The ConcurrentCostFunction class evaluates the cost function like the cost function adaptor of the
+ * optimizer (scales and negation) but without storing the last position and value or reporting the evaluation,
+ * so that several positions can be evaluated at the same time.
+ */
+class ConcurrentCostFunction : public vnl_cost_function
+{
+public:
+  ConcurrentCostFunction(const itk::SingleValuedCostFunction* costFunction, unsigned int numberOfParameters, bool scalesInitialized, const itk::Optimizer::ScalesType& scales, bool negate)
+  : vnl_cost_function(numberOfParameters)
+  , m_CostFunction(costFunction)
+  , m_ScalesInitialized(scalesInitialized)
+  , m_Scales(scales)
+  , m_Negate(negate)
+  {
+  }
+
+  double f(const vnl_vector<double>& x) override
+  {
+    itk::SingleValuedCostFunction::ParametersType parameters(x.size());
+    for(unsigned int i = 0; i < x.size(); i++)
+    {
+      parameters[i] = m_ScalesInitialized ? x[i] / m_Scales[i] : x[i];
+    }
+    const double value = m_CostFunction->GetValue(parameters);
+    return m_Negate ? -value : value;
+  }
+
+private:
+  const itk::SingleValuedCostFunction* m_CostFunction;
+  bool m_ScalesInitialized;
+  itk::Optimizer::ScalesType m_Scales;
+  bool m_Negate;
+};
+} // namespace
+
 namespace itk
 {
 
@@ -51,6 +89,8 @@ void FFTAmoebaOptimizer::PrintSelf(std::ostream& os, Indent indent) const
   os << indent << "FractionalTolerance: " << this->m_FractionalTolerance << std::endl;
   os << indent << "AutomaticInitialSimplex: " << (this->m_AutomaticInitialSimplex ? "On" : "Off") << std::endl;
   os << indent << "InitialSimplexDelta: " << this->m_InitialSimplexDelta << std::endl;
+  os << indent << "ParallelEvaluation: " << (this->m_ParallelEvaluation ? "On" : "Off") << std::endl;
+  os << indent << "NumberOfStarts: " << this->m_NumberOfStarts << std::endl;
 }
 
 FFTAmoebaOptimizer::MeasureType FFTAmoebaOptimizer::GetValue() const
@@ -138,9 +178,22 @@ void FFTAmoebaOptimizer::StartOptimization()
   // get rid of previous instance of the internal optimizer and create a
   // new one
   delete m_VnlOptimizer;
-  m_VnlOptimizer = new fft_amoeba(*adaptor);
+  m_VnlOptimizer = nullptr;
+  m_ConcurrentCostFunction.reset();
+  if(m_ParallelEvaluation || m_NumberOfStarts > 1)
+  {
+    // The adaptor records each evaluation, which cannot be done from several threads
+    m_ConcurrentCostFunction.reset(new ConcurrentCostFunction(adaptor->GetCostFunction(), n, m_ScalesInitialized, scales, GetMaximize()));
+    m_VnlOptimizer = new fft_amoeba(*m_ConcurrentCostFunction);
+  }
+  else
+  {
+    m_VnlOptimizer = new fft_amoeba(*adaptor);
+  }
   m_VnlOptimizer->set_max_iterations(static_cast<int>(m_MaximumNumberOfIterations));
   m_VnlOptimizer->set_f_tolerance(m_FractionalTolerance);
+  m_VnlOptimizer->set_parallel_evaluation(m_ParallelEvaluation);
+  m_VnlOptimizer->set_number_of_starts(static_cast<int>(m_NumberOfStarts));
 
   m_StopConditionDescription.str("");
   m_StopConditionDescription << this->GetNameOfClass() << ": Running";
@@ -320,6 +373,10 @@ void FFTAmoebaOptimizer::ValidateSettings()
   {
     itkExceptionMacro(<< "negative fractional tolerance")
   }
+  if(this->m_NumberOfStarts < 1)
+  {
+    itkExceptionMacro(<< "number of starts must be at least 1")
+  }
 }
 
 } // end namespace itk
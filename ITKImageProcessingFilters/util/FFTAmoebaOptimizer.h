@@ -17,6 +17,8 @@
  *=========================================================================*/
 #pragma once
 
+#include <memory>
+
 #include <itkConfigure.h>
 #define SIMPL_ITK_VERSION_CHECK (ITK_VERSION_MAJOR == 4)
 #if SIMPL_ITK_VERSION_CHECK
@@ -138,6 +140,28 @@ public:
   itkBooleanMacro(OptimizeWithRestarts);
   itkGetConstMacro(OptimizeWithRestarts, bool);
 
+  /** Set/Get whether the cost function is evaluated at several points of the
+   * simplex concurrently (initial corners, reflection, expansion and
+   * contraction candidates, shrunk corners). The simplex follows the same
+   * path as with sequential evaluations, but each step evaluates up to four
+   * candidates where a sequential step evaluates one or two. The cost
+   * function must be safe to evaluate from several threads. Default is off.
+   */
+  itkSetMacro(ParallelEvaluation, bool);
+  itkBooleanMacro(ParallelEvaluation);
+  itkGetConstMacro(ParallelEvaluation, bool);
+
+  /** Set/Get the number of simplices that are optimized concurrently. The
+   * first one starts from the initial position, the others from positions
+   * moved by up to the initial simplex delta along each parameter. The best
+   * result is kept. The maximum number of iterations is shared evenly between
+   * the simplices, and the reported iterations are those of all of them. The
+   * cost function must be safe to evaluate from several threads when this is
+   * greater than 1. Default is 1.
+   */
+  itkSetMacro(NumberOfStarts, unsigned int);
+  itkGetConstMacro(NumberOfStarts, unsigned int);
+
   /** Set/Get the deltas that are used to define the initial simplex
    * when AutomaticInitialSimplex is off. */
   void SetInitialSimplexDelta(ParametersType initialSimplexDelta, bool automaticInitialSimplex = false);
@@ -182,7 +206,10 @@ private:
   bool m_AutomaticInitialSimplex;
   ParametersType m_InitialSimplexDelta;
   bool m_OptimizeWithRestarts;
+  bool m_ParallelEvaluation = false;
+  unsigned int m_NumberOfStarts = 1;
   fft_amoeba* m_VnlOptimizer;
+  std::unique_ptr<vnl_cost_function> m_ConcurrentCostFunction;
   bool m_Cancel = false;
   AbstractFilter* m_SIMPLFilter = nullptr;
 
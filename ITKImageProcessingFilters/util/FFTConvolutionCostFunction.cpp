@@ -53,6 +53,7 @@ using ScopedLockType = int;
 #include "SIMPLib/Utilities/ParallelTaskAlgorithm.h"
 
 #include "ITKImageProcessingFilters/util/FFTDewarpHelper.h"
+#include "ITKImageProcessingFilters/util/ITKExecutionPolicy.h"
 
 /**
  * @class FFTConvolutionCostFunction FFTConvolutionCostFunction.h ITKImageProcessingFilters/util/FFTConvolutionCostFunction.h
@@ -144,13 +145,16 @@ public:
    * @param imageDim_x
    * @param imageDim_y
    * @param parameters
+   * @param regionBounds
+   * @param boundsMutex Guards the region bounds of the overlap
    */
   FFTImageOverlapGenerator(const InputImage::Pointer& baseImg, const InputImage::Pointer& image, const PixelCoord& offset, size_t imageDim_x, size_t imageDim_y, const ParametersType& parameters,
-                           RegionBounds& regionBounds)
+                           RegionBounds& regionBounds, MutexType& boundsMutex)
   : m_BaseImg(baseImg)
   , m_Image(image)
   , m_Parameters(parameters)
   , m_Bounds(regionBounds)
+  , m_BoundsMutex(boundsMutex)
   {
     double x_trans = (imageDim_x - 1) / 2.0;
     double y_trans = (imageDim_y - 1) / 2.0;
@@ -163,8 +167,6 @@ public:
    */
   void updateRegionBounds(const PixelCoord& index) const
   {
-    static MutexType mutex;
-
     auto origin = m_Image->GetOrigin();
     auto size = m_Image->GetRequestedRegion().GetSize();
 
@@ -173,7 +175,7 @@ public:
     const int64_t distLeft = index[0] - origin[0];
     const int64_t distRight = origin[0] + size[0] - index[0];
 
-    ScopedLockType scopedLock(mutex);
+    ScopedLockType scopedLock(m_BoundsMutex);
     if(distTop <= distBot && distTop <= distLeft && distTop <= distRight)
     {
       m_Bounds.topBound = std::max(m_Bounds.topBound, static_cast<int64_t>(index[1]));
@@ -264,6 +266,7 @@ private:
   FFTDewarpHelper::PixelIndex m_Offset;
   ParametersType m_Parameters;
   RegionBounds& m_Bounds;
+  MutexType& m_BoundsMutex;
 };
 
 // -----------------------------------------------------------------------------
@@ -275,7 +278,11 @@ void FFTConvolutionCostFunction::Initialize(const GridMontageShPtr& montage, con
   m_Montage = montage;
 
   m_ImageGrid.clear();
-
+  {
+    // The buffers of the previous overlaps cannot be reused
+    std::lock_guard<std::mutex> lock(m_BuffersMutex);
+    m_FreeBuffers.clear();
+  }
   calculateImageDim(montage);
 
   const size_t numRows = montage->getRowCount();
@@ -455,20 +462,56 @@ uint32_t FFTConvolutionCostFunction::GetNumberOfParameters() const
 // -----------------------------------------------------------------------------
 FFTConvolutionCostFunction::MeasureType FFTConvolutionCostFunction::GetValue(const ParametersType& parameters) const
 {
+  std::unique_ptr<EvaluationBuffers> buffers = acquireEvaluationBuffers();
+
   ParallelTaskAlgorithm taskAlg;
-  MeasureType residual = 0.0;
-  // Find the FFT Convolution and accumulate the maximum value from each overlap
-  for(const auto& overlap : m_Overlaps) // Parallelize this
+  std::vector<MeasureType> maxValues(m_Overlaps.size(), 0.0);
+  // Find the FFT Convolution and the maximum value of each overlap
+  for(size_t i = 0; i < m_Overlaps.size(); i++)
   {
-    taskAlg.execute(std::bind(&FFTConvolutionCostFunction::findFFTConvolutionAndMaxValue, this, overlap, parameters, std::ref(residual)));
+    taskAlg.execute(std::bind(&FFTConvolutionCostFunction::findFFTConvolutionAndMaxValue, this, std::cref(m_Overlaps[i]), std::cref(parameters), std::ref((*buffers)[i]), std::ref(maxValues[i])));
   }
   taskAlg.wait();
 
+  releaseEvaluationBuffers(std::move(buffers));
+
+  // Summing in the order of the overlaps keeps the order of the additions independent of the number of threads
+  MeasureType residual = 0.0;
+  for(const MeasureType& maxValue : maxValues)
+  {
+    residual += maxValue;
+  }
+
   // The value to maximize is the square of the sum of the maximum value of the fft convolution
   MeasureType result = residual * residual;
   return result;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::unique_ptr<FFTConvolutionCostFunction::EvaluationBuffers> FFTConvolutionCostFunction::acquireEvaluationBuffers() const
+{
+  std::lock_guard<std::mutex> lock(m_BuffersMutex);
+  if(m_FreeBuffers.empty())
+  {
+    // The images and filters are created by the first evaluation of each overlap
+    return std::unique_ptr<EvaluationBuffers>(new EvaluationBuffers(m_Overlaps.size()));
+  }
+  std::unique_ptr<EvaluationBuffers> buffers = std::move(m_FreeBuffers.back());
+  m_FreeBuffers.pop_back();
+  return buffers;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FFTConvolutionCostFunction::releaseEvaluationBuffers(std::unique_ptr<EvaluationBuffers> buffers) const
+{
+  std::lock_guard<std::mutex> lock(m_BuffersMutex);
+  m_FreeBuffers.push_back(std::move(buffers));
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -554,7 +597,7 @@ FFTConvolutionCostFunction::InputImage::RegionType FFTConvolutionCostFunction::c
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-FFTConvolutionCostFunction::ImagePair FFTConvolutionCostFunction::createOverlapImages(const OverlapPair& overlap, const ParametersType& parameters) const
+void FFTConvolutionCostFunction::createOverlapImages(const OverlapPair& overlap, const ParametersType& parameters, OverlapBuffers& buffers) const
 {
   // First image calculation
   InputImage::RegionType region = overlap.second;
@@ -566,30 +609,47 @@ FFTConvolutionCostFunction::ImagePair FFTConvolutionCostFunction::createOverlapI
   bounds.bottomBound = region.GetIndex()[1] + region.GetSize()[1];
   bounds.leftBound = region.GetIndex()[0];
   bounds.rightBound = region.GetIndex()[0] + region.GetSize()[0];
+  // Only the tasks generating this overlap update its bounds
+  MutexType boundsMutex{};
 
-  InputImage::Pointer firstOverlapImg = InputImage::New();
-  firstOverlapImg->SetRegions({region.GetIndex(), region.GetSize()});
-  firstOverlapImg->Allocate();
+  if(nullptr == buffers.FirstImage)
+  {
+    buffers.FirstImage = InputImage::New();
+    buffers.FirstImage->SetRegions({region.GetIndex(), region.GetSize()});
+    buffers.FirstImage->Allocate();
+  }
+  InputImage::Pointer firstOverlapImg = buffers.FirstImage;
+  // The previous evaluation cropped the requested region
+  firstOverlapImg->SetRequestedRegionToLargestPossibleRegion();
 
   auto index = region.GetIndex();
   ParallelData2DAlgorithm dataAlg;
   dataAlg.setRange(index[1], index[0], index[1] + region.GetSize()[1], index[0] + region.GetSize()[0]);
-  dataAlg.execute(FFTImageOverlapGenerator(firstBaseImg, firstOverlapImg, index, m_ImageDim_x, m_ImageDim_y, parameters, bounds));
+  dataAlg.execute(FFTImageOverlapGenerator(firstBaseImg, firstOverlapImg, index, m_ImageDim_x, m_ImageDim_y, parameters, bounds, boundsMutex));
 
   // Second image calculation
   const InputImage::Pointer secondBaseImg = m_ImageGrid.at(overlap.first.second);
 
-  InputImage::Pointer secondOverlapImg = InputImage::New();
-  secondOverlapImg->SetRegions({region.GetIndex(), region.GetSize()});
-  secondOverlapImg->Allocate();
+  if(nullptr == buffers.SecondImage)
+  {
+    buffers.SecondImage = InputImage::New();
+    buffers.SecondImage->SetRegions({region.GetIndex(), region.GetSize()});
+    buffers.SecondImage->Allocate();
+  }
+  InputImage::Pointer secondOverlapImg = buffers.SecondImage;
+  secondOverlapImg->SetRequestedRegionToLargestPossibleRegion();
 
   index = region.GetIndex();
   dataAlg.setRange(index[1], index[0], index[1] + region.GetSize()[1], index[0] + region.GetSize()[0]);
-  dataAlg.execute(FFTImageOverlapGenerator(secondBaseImg, secondOverlapImg, index, m_ImageDim_x, m_ImageDim_y, parameters, bounds));
+  dataAlg.execute(FFTImageOverlapGenerator(secondBaseImg, secondOverlapImg, index, m_ImageDim_x, m_ImageDim_y, parameters, bounds, boundsMutex));
+
+  // The pixels were written directly, so the convolution filter has to be told that its inputs changed
+  firstOverlapImg->Modified();
+  secondOverlapImg->Modified();
 
   // Crop images
   ImagePair imgPair = std::make_pair(firstOverlapImg, secondOverlapImg);
-  return cropOverlapImages(imgPair, bounds);
+  cropOverlapImages(imgPair, bounds);
 }
 
 // -----------------------------------------------------------------------------
@@ -629,28 +689,29 @@ double maxFromArray(double* ptr, size_t count)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void FFTConvolutionCostFunction::findFFTConvolutionAndMaxValue(const OverlapPair& overlap, const ParametersType& parameters, MeasureType& residual) const
+void FFTConvolutionCostFunction::findFFTConvolutionAndMaxValue(const OverlapPair& overlap, const ParametersType& parameters, OverlapBuffers& buffers, MeasureType& maxValue) const
 {
-  static MutexType mutex;
+  createOverlapImages(overlap, parameters, buffers);
 
-  ImagePair overlapImgs = createOverlapImages(overlap, parameters);
-
-  ConvolutionFilter::Pointer filter = ConvolutionFilter::New();
-  filter->SetInput(overlapImgs.first);
-  filter->SetKernelImage(overlapImgs.second);
-  filter->Update();
-  OutputImage::Pointer fftConvolve = filter->GetOutput();
+  // The filter keeps its output image between the evaluations
+  if(nullptr == buffers.Filter)
+  {
+    buffers.Filter = ConvolutionFilter::New();
+    buffers.Filter->SetInput(buffers.FirstImage);
+    buffers.Filter->SetKernelImage(buffers.SecondImage);
+    // This runs in one of the parallel tasks of GetValue
+    ITKExecutionPolicy::ApplyToNestedFilter(buffers.Filter);
+  }
+  buffers.Filter->Update();
+  OutputImage::Pointer fftConvolve = buffers.Filter->GetOutput();
 
-  // Increment by the maximum value of the output of the fftConvolve
+  // Store the maximum value of the output of the fftConvolve
   // NOTE This methodology of getting the max element from the fftConvolve
   // output might require a deeper look
   auto pixelContainer = fftConvolve->GetPixelContainer();
   OutputValue_T* bufferPtr = pixelContainer->GetBufferPointer();
   itk::SizeValueType bufferSize = pixelContainer->Size();
-  MeasureType maxValue = maxFromArray(bufferPtr, bufferSize);
-
-  ScopedLockType lock(mutex);
-  residual += maxValue;
+  maxValue = maxFromArray(bufferPtr, bufferSize);
 }
 
 // -----------------------------------------------------------------------------
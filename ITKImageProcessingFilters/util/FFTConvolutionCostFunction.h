@@ -32,6 +32,10 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
@@ -168,6 +172,30 @@ public:
   double getImageDimY() const;
 
 private:
+  /**
+   * @brief The OverlapBuffers struct holds the images and the FFT convolution filter used to evaluate one overlap.
+   * They are allocated by the first evaluation and reused by the following ones.
+   */
+  struct OverlapBuffers
+  {
+    InputImage::Pointer FirstImage;
+    InputImage::Pointer SecondImage;
+    ConvolutionFilter::Pointer Filter;
+  };
+  using EvaluationBuffers = std::vector<OverlapBuffers>;
+
+  /**
+   * @brief Returns a set of buffers for all the overlaps that is not used by another evaluation.
+   * @return
+   */
+  std::unique_ptr<EvaluationBuffers> acquireEvaluationBuffers() const;
+
+  /**
+   * @brief Gives back the buffers of an evaluation so the following evaluations can reuse them.
+   * @param buffers
+   */
+  void releaseEvaluationBuffers(std::unique_ptr<EvaluationBuffers> buffers) const;
+
   /**
    * @brief This method is called by Initialize as a parallel task algorithm operating on each DataContainer.
    * @param montage
@@ -207,12 +235,12 @@ private:
   InputImage::RegionType createBottomRegionPairs(const RegionBounds& top, const RegionBounds& bottom) const;
 
   /**
-   * @brief Creates and returns a pair of images containing the overlap section based on the given parameters.
+   * @brief Fills the pair of images of the buffers with the overlap section based on the given parameters.
    * @param overlap
    * @param parameters
-   * @return
+   * @param buffers
    */
-  ImagePair createOverlapImages(const OverlapPair& overlap, const ParametersType& parameters) const;
+  void createOverlapImages(const OverlapPair& overlap, const ParametersType& parameters, OverlapBuffers& buffers) const;
 
   /**
    * @brief crops the ImagePair regions to match the RegionBounds provided.
@@ -222,12 +250,13 @@ private:
   ImagePair cropOverlapImages(const ImagePair& imagePair, const RegionBounds& bounds) const;
 
   /**
-   * @brief This method is called by GetValue to find the FFT Convolution and accumulate the maximum value from each overlap.
+   * @brief This method is called by GetValue to find the FFT Convolution and the maximum value of an overlap.
    * @param overlap
    * @param parameters
-   * @param residual
+   * @param buffers
+   * @param maxValue
    */
-  void findFFTConvolutionAndMaxValue(const OverlapPair& overlap, const ParametersType& parameters, MeasureType& residual) const;
+  void findFFTConvolutionAndMaxValue(const OverlapPair& overlap, const ParametersType& parameters, OverlapBuffers& buffers, MeasureType& maxValue) const;
 
   /**
    * @brief Calculates the ImageDim_x and ImageDim_y values for a montage.
@@ -253,6 +282,8 @@ private:
   double m_ImageDim_x;
   double m_ImageDim_y;
   OverlapPairs m_Overlaps;
+  mutable std::mutex m_BuffersMutex;
+  mutable std::vector<std::unique_ptr<EvaluationBuffers>> m_FreeBuffers;
 };
 
 #if SIMPL_ITK_VERSION_CHECK
@@ -32,6 +32,53 @@
 
 #include "FFTDewarpHelper.h"
 
+#include <limits>
+
+namespace
+{
+/**
+ * @brief The ComputeIndexMapImpl class evaluates the dewarp polynomial for blocks of rows of the index map
+ */
+template <typename IndexType>
+class ComputeIndexMapImpl
+{
+public:
+  ComputeIndexMapImpl(const FFTDewarpHelper::ParametersType& parameters, const FFTDewarpHelper::PixelIndex& offset, size_t width, size_t height, IndexType* indices)
+  : m_Parameters(parameters)
+  , m_Offset(offset)
+  , m_Width(static_cast<int64_t>(width))
+  , m_Height(static_cast<int64_t>(height))
+  , m_Indices(indices)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t y = range.min(); y < range.max(); y++)
+    {
+      IndexType* indices = m_Indices + y * m_Width;
+      for(int64_t x = 0; x < m_Width; x++)
+      {
+        const FFTDewarpHelper::PixelIndex oldPixelIndex = FFTDewarpHelper::getOldIndex(FFTDewarpHelper::pixelIndex(x, static_cast<int64_t>(y)), m_Offset, m_Parameters);
+        if(oldPixelIndex[0] < 0 || oldPixelIndex[1] < 0 || oldPixelIndex[0] >= m_Width || oldPixelIndex[1] >= m_Height)
+        {
+          indices[x] = -1;
+          continue;
+        }
+        indices[x] = static_cast<IndexType>(oldPixelIndex[1] * m_Width + oldPixelIndex[0]);
+      }
+    }
+  }
+
+private:
+  const FFTDewarpHelper::ParametersType& m_Parameters;
+  FFTDewarpHelper::PixelIndex m_Offset;
+  int64_t m_Width;
+  int64_t m_Height;
+  IndexType* m_Indices;
+};
+} // namespace
+
 // ----------------------------------------------------------------------------
 FFTDewarpHelper::PixelIndex FFTDewarpHelper::pixelIndex(int64_t x, int64_t y)
 {
@@ -97,3 +144,26 @@ int64_t FFTDewarpHelper::py(PixelIndex newIndex, PixelIndex offset, const Parame
 
   return static_cast<int64_t>(std::floor(oldYPrime + offset[1]));
 }
+
+// ----------------------------------------------------------------------------
+FFTDewarpHelper::IndexMap FFTDewarpHelper::createIndexMap(const ParametersType& parameters, size_t width, size_t height, PixelIndex offset)
+{
+  IndexMap indexMap;
+  indexMap.Width = width;
+  indexMap.Height = height;
+  const size_t pixelCount = width * height;
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, height);
+  if(pixelCount <= static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+  {
+    indexMap.CompactIndices.resize(pixelCount);
+    dataAlg.execute(ComputeIndexMapImpl<int32_t>(parameters, offset, width, height, indexMap.CompactIndices.data()));
+  }
+  else
+  {
+    indexMap.Indices.resize(pixelCount);
+    dataAlg.execute(ComputeIndexMapImpl<int64_t>(parameters, offset, width, height, indexMap.Indices.data()));
+  }
+  return indexMap;
+}
@@ -32,7 +32,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <vector>
 
 #include <itkConfigure.h>
 #define SIMPL_ITK_VERSION_CHECK (ITK_VERSION_MAJOR == 4)
@@ -45,6 +47,10 @@
 
 #include <itkSingleValuedCostFunction.h>
 
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+#include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
+
 namespace FFTDewarpHelper
 {
 using PixelIndex = std::array<int64_t, 2>;
@@ -56,9 +62,9 @@ using ParametersType = itk::SingleValuedCostFunction::ParametersType;
  * @param y
  * @return
  */
-PixelIndex pixelIndex(int64_t x, int64_t y);
-PixelIndex pixelIndex(size_t x, size_t y);
-PixelIndex pixelIndex(double x, double y);
+ITKImageProcessing_EXPORT PixelIndex pixelIndex(int64_t x, int64_t y);
+ITKImageProcessing_EXPORT PixelIndex pixelIndex(size_t x, size_t y);
+ITKImageProcessing_EXPORT PixelIndex pixelIndex(double x, double y);
 
 /**
  * @brief Returns the number of parameters for either X or Y
@@ -82,9 +88,104 @@ constexpr uint32_t getReqParameterSize()
  * @brief Returns the old pixel index from which to extract the value for the given parameters.
  * @param
  */
-PixelIndex getOldIndex(PixelIndex newIndex, PixelIndex offset, const ParametersType& parameters);
-int64_t px(PixelIndex newIndex, PixelIndex offset, const ParametersType& parameters);
-int64_t py(PixelIndex newIndex, PixelIndex offset, const ParametersType& parameters);
+ITKImageProcessing_EXPORT PixelIndex getOldIndex(PixelIndex newIndex, PixelIndex offset, const ParametersType& parameters);
+ITKImageProcessing_EXPORT int64_t px(PixelIndex newIndex, PixelIndex offset, const ParametersType& parameters);
+ITKImageProcessing_EXPORT int64_t py(PixelIndex newIndex, PixelIndex offset, const ParametersType& parameters);
+
+/**
+ * @brief The IndexMap struct holds, for each pixel of a dewarped tile, the index of the pixel it comes from
+ * in the original tile, or -1 when that pixel is outside of the tile. The map only depends on the tile dimensions,
+ * the translation and the parameters, so it is computed once and shared by all the arrays of all the tiles with
+ * the same dimensions. The indices are stored on 32 bits (CompactIndices) unless the tile has 2^31 pixels or more.
+ */
+struct IndexMap
+{
+  size_t Width = 0;
+  size_t Height = 0;
+  std::vector<int32_t> CompactIndices;
+  std::vector<int64_t> Indices;
+};
+
+/**
+ * @brief Evaluates getOldIndex for every pixel of a tile, in parallel by rows.
+ * @param parameters
+ * @param width
+ * @param height
+ * @param offset Translation of the tile, see getOldIndex
+ * @return
+ */
+ITKImageProcessing_EXPORT IndexMap createIndexMap(const ParametersType& parameters, size_t width, size_t height, PixelIndex offset);
+
+/**
+ * @brief The GatherTuplesImpl class moves the tuples of a tile array to their dewarped position: each new pixel
+ * gathers the tuple of the pixel given by the index map in a copy of the original values, or the init value of
+ * the array. Blocks of rows are processed in parallel, each row from left to right, reading and writing the
+ * tuples through the raw array pointers.
+ */
+template <typename T, typename IndexType>
+class GatherTuplesImpl
+{
+public:
+  GatherTuplesImpl(const IndexType* indices, size_t width, const T* source, T* destination, size_t numComps, T initValue)
+  : m_Indices(indices)
+  , m_Width(width)
+  , m_Source(source)
+  , m_Destination(destination)
+  , m_NumComps(numComps)
+  , m_InitValue(initValue)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t y = range.min(); y < range.max(); y++)
+    {
+      const IndexType* indices = m_Indices + y * m_Width;
+      T* destination = m_Destination + y * m_Width * m_NumComps;
+      for(size_t x = 0; x < m_Width; x++, destination += m_NumComps)
+      {
+        if(indices[x] < 0)
+        {
+          std::fill_n(destination, m_NumComps, m_InitValue);
+          continue;
+        }
+        std::copy_n(m_Source + static_cast<size_t>(indices[x]) * m_NumComps, m_NumComps, destination);
+      }
+    }
+  }
+
+private:
+  const IndexType* m_Indices;
+  size_t m_Width;
+  const T* m_Source;
+  T* m_Destination;
+  size_t m_NumComps;
+  T m_InitValue;
+};
+
+/**
+ * @brief Writes the dewarped tuples of source into destination. Both hold Width * Height tuples of numComps values
+ * and must not overlap.
+ * @param indexMap
+ * @param source
+ * @param destination
+ * @param numComps
+ * @param initValue Value of the pixels that come from outside of the tile
+ */
+template <typename T>
+void gatherTuples(const IndexMap& indexMap, const T* source, T* destination, size_t numComps, T initValue)
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, indexMap.Height);
+  if(!indexMap.CompactIndices.empty())
+  {
+    dataAlg.execute(GatherTuplesImpl<T, int32_t>(indexMap.CompactIndices.data(), indexMap.Width, source, destination, numComps, initValue));
+  }
+  else
+  {
+    dataAlg.execute(GatherTuplesImpl<T, int64_t>(indexMap.Indices.data(), indexMap.Width, source, destination, numComps, initValue));
+  }
+}
 } // namespace FFTDewarpHelper
 
 #if SIMPL_ITK_VERSION_CHECK
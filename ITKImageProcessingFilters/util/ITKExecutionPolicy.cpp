@@ -0,0 +1,249 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ITKExecutionPolicy.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#if ITK_VERSION_MAJOR >= 5
+#include <itkMultiThreaderBase.h>
+using ITKMultiThreaderType = itk::MultiThreaderBase;
+#else
+#include <itkMultiThreader.h>
+using ITKMultiThreaderType = itk::MultiThreader;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/global_control.h>
+#endif
+
+namespace
+{
+// ----------------------------------------------------------------------------
+int readEnvironmentValue(const char* name)
+{
+  const char* value = std::getenv(name);
+  if(nullptr == value)
+  {
+    return 0;
+  }
+  return std::max(std::atoi(value), 0);
+}
+
+std::mutex s_ApplyMutex;
+int s_AppliedNumberOfThreads = -1;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+std::unique_ptr<tbb::global_control> s_TBBControl;
+#endif
+} // namespace
+
+int ITKExecutionPolicy::s_MaximumNumberOfThreads = readEnvironmentValue("ITKIMAGEPROCESSING_MAX_THREADS");
+int ITKExecutionPolicy::s_NumberOfWorkUnits = readEnvironmentValue("ITKIMAGEPROCESSING_WORK_UNITS");
+int ITKExecutionPolicy::s_MemoryBudget = readEnvironmentValue("ITKIMAGEPROCESSING_MEMORY_BUDGET");
+bool ITKExecutionPolicy::s_RefuseOverBudget = readEnvironmentValue("ITKIMAGEPROCESSING_REFUSE_OVER_BUDGET") > 0;
+
+// ----------------------------------------------------------------------------
+void ITKExecutionPolicy::SetMaximumNumberOfThreads(int value)
+{
+  s_MaximumNumberOfThreads = std::max(value, 0);
+}
+
+// ----------------------------------------------------------------------------
+int ITKExecutionPolicy::GetMaximumNumberOfThreads()
+{
+  return s_MaximumNumberOfThreads;
+}
+
+// ----------------------------------------------------------------------------
+void ITKExecutionPolicy::SetNumberOfWorkUnits(int value)
+{
+  s_NumberOfWorkUnits = std::max(value, 0);
+}
+
+// ----------------------------------------------------------------------------
+int ITKExecutionPolicy::GetNumberOfWorkUnits()
+{
+  return s_NumberOfWorkUnits;
+}
+
+// ----------------------------------------------------------------------------
+int ITKExecutionPolicy::GetNumberOfThreads()
+{
+  const int hardwareThreads = std::max(static_cast<int>(std::thread::hardware_concurrency()), 1); // Returns ZERO if not defined on this platform
+  if(s_MaximumNumberOfThreads > 0)
+  {
+    return std::min(s_MaximumNumberOfThreads, hardwareThreads);
+  }
+  return hardwareThreads;
+}
+
+// ----------------------------------------------------------------------------
+void ITKExecutionPolicy::SetMemoryBudget(int value)
+{
+  s_MemoryBudget = std::max(value, 0);
+}
+
+// ----------------------------------------------------------------------------
+int ITKExecutionPolicy::GetMemoryBudget()
+{
+  return s_MemoryBudget;
+}
+
+// ----------------------------------------------------------------------------
+void ITKExecutionPolicy::SetRefuseOverBudget(bool value)
+{
+  s_RefuseOverBudget = value;
+}
+
+// ----------------------------------------------------------------------------
+bool ITKExecutionPolicy::GetRefuseOverBudget()
+{
+  return s_RefuseOverBudget;
+}
+
+// ----------------------------------------------------------------------------
+size_t ITKExecutionPolicy::GetMemoryBudgetInBytes()
+{
+  if(s_MemoryBudget > 0)
+  {
+    return static_cast<size_t>(s_MemoryBudget) * 1024 * 1024;
+  }
+  return GetPhysicalMemory();
+}
+
+// ----------------------------------------------------------------------------
+size_t ITKExecutionPolicy::GetPhysicalMemory()
+{
+#if defined(_WIN32)
+  MEMORYSTATUSEX status;
+  status.dwLength = sizeof(status);
+  if(GlobalMemoryStatusEx(&status) == 0)
+  {
+    return 0;
+  }
+  return static_cast<size_t>(status.ullTotalPhys);
+#else
+  const long pages = sysconf(_SC_PHYS_PAGES);
+  const long pageSize = sysconf(_SC_PAGE_SIZE);
+  if(pages <= 0 || pageSize <= 0)
+  {
+    return 0;
+  }
+  return static_cast<size_t>(pages) * static_cast<size_t>(pageSize);
+#endif
+}
+
+// ----------------------------------------------------------------------------
+void ITKExecutionPolicy::Apply()
+{
+  std::lock_guard<std::mutex> lock(s_ApplyMutex);
+  const int numberOfThreads = GetNumberOfThreads();
+  if(numberOfThreads == s_AppliedNumberOfThreads)
+  {
+    return;
+  }
+
+#if defined(ITK_USE_TBB) && ITK_VERSION_MAJOR >= 5
+  // ITK filters then run their work units as TBB tasks, in the same pool as the TBB loops of the plugin
+  ITKMultiThreaderType::SetGlobalDefaultThreader(ITKMultiThreaderType::ThreaderTypeFromString("TBB"));
+#endif
+  ITKMultiThreaderType::SetGlobalMaximumNumberOfThreads(numberOfThreads);
+  ITKMultiThreaderType::SetGlobalDefaultNumberOfThreads(numberOfThreads);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  s_TBBControl.reset();
+  if(s_MaximumNumberOfThreads > 0)
+  {
+    s_TBBControl = std::make_unique<tbb::global_control>(tbb::global_control::max_allowed_parallelism, static_cast<size_t>(numberOfThreads));
+  }
+#endif
+
+  s_AppliedNumberOfThreads = numberOfThreads;
+}
+
+// ----------------------------------------------------------------------------
+void ITKExecutionPolicy::ApplyToFilter(itk::ProcessObject* filter, int maximumNumberOfThreads, int numberOfWorkUnits)
+{
+  if(nullptr == filter)
+  {
+    return;
+  }
+  const int numberOfThreads = (maximumNumberOfThreads > 0) ? std::min(maximumNumberOfThreads, GetNumberOfThreads()) : 0;
+  const int workUnits = (numberOfWorkUnits > 0) ? numberOfWorkUnits : s_NumberOfWorkUnits;
+#if ITK_VERSION_MAJOR >= 5
+  if(numberOfThreads > 0)
+  {
+    filter->GetMultiThreader()->SetMaximumNumberOfThreads(static_cast<itk::ThreadIdType>(numberOfThreads));
+  }
+  if(workUnits > 0)
+  {
+    filter->SetNumberOfWorkUnits(static_cast<itk::ThreadIdType>(workUnits));
+  }
+#else
+  // ITK 4 runs one work unit per thread
+  if(numberOfThreads > 0 || workUnits > 0)
+  {
+    const int threads = (numberOfThreads > 0) ? numberOfThreads : GetNumberOfThreads();
+    filter->SetNumberOfThreads(static_cast<itk::ThreadIdType>((workUnits > 0) ? std::min(workUnits, threads) : threads));
+  }
+#endif
+}
+
+// ----------------------------------------------------------------------------
+void ITKExecutionPolicy::ApplyToNestedFilter(itk::ProcessObject* filter)
+{
+  if(nullptr == filter)
+  {
+    return;
+  }
+#if defined(ITK_USE_TBB) && ITK_VERSION_MAJOR >= 5
+  // The TBB threader schedules the work units of the nested filter in the shared pool
+  ApplyToFilter(filter);
+#elif ITK_VERSION_MAJOR >= 5
+  filter->SetNumberOfWorkUnits(1);
+#else
+  filter->SetNumberOfThreads(1);
+#endif
+}
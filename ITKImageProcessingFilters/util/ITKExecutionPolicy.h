@@ -0,0 +1,151 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <cstddef>
+
+#include <itkConfigure.h>
+#include <itkProcessObject.h>
+
+#include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
+
+/**
+ * @brief The ITKExecutionPolicy class holds the plugin-wide threading settings shared by the ITK filters
+ * (through itk::MultiThreaderBase) and the filters of this plugin that use TBB directly. The settings are
+ * initialized from the ITKIMAGEPROCESSING_MAX_THREADS and ITKIMAGEPROCESSING_WORK_UNITS environment variables
+ * and can be changed with the setters. They are pushed to ITK and TBB by Apply(), which every filter of the
+ * plugin calls at the start of its execution.
+ *
+ * It also holds the memory budget the ITK filters check their estimated peak memory against during preflight
+ * (ITKIMAGEPROCESSING_MEMORY_BUDGET in MB, ITKIMAGEPROCESSING_REFUSE_OVER_BUDGET to turn the warning into an error).
+ *
+ * Each ITK filter can lower the number of threads and set its own number of work units and memory budget
+ * (see the MaximumNumberOfThreads, NumberOfWorkUnits and MemoryBudget properties of ITKImageBase).
+ */
+class ITKImageProcessing_EXPORT ITKExecutionPolicy
+{
+public:
+  /**
+   * @brief SetMaximumNumberOfThreads Sets the maximum number of threads used by ITK and TBB (0 means all the cores)
+   * @param value
+   */
+  static void SetMaximumNumberOfThreads(int value);
+
+  /**
+   * @brief GetMaximumNumberOfThreads
+   * @return The maximum number of threads, 0 if it is not limited
+   */
+  static int GetMaximumNumberOfThreads();
+
+  /**
+   * @brief SetNumberOfWorkUnits Sets the number of pieces each ITK filter splits its output in (0 means the ITK default)
+   * @param value
+   */
+  static void SetNumberOfWorkUnits(int value);
+
+  /**
+   * @brief GetNumberOfWorkUnits
+   * @return The number of work units of each ITK filter, 0 for the ITK default
+   */
+  static int GetNumberOfWorkUnits();
+
+  /**
+   * @brief GetNumberOfThreads Returns the number of threads a parallel loop of the plugin should use
+   * @return
+   */
+  static int GetNumberOfThreads();
+
+  /**
+   * @brief SetMemoryBudget Sets the memory (in MB) an ITK filter may need (0 means the physical memory of the machine)
+   * @param value
+   */
+  static void SetMemoryBudget(int value);
+
+  /**
+   * @brief GetMemoryBudget
+   * @return The memory budget in MB, 0 if it is the physical memory of the machine
+   */
+  static int GetMemoryBudget();
+
+  /**
+   * @brief SetRefuseOverBudget Sets whether the filters whose estimated peak memory exceeds the budget fail
+   * preflight (true) or only report a warning (false)
+   * @param value
+   */
+  static void SetRefuseOverBudget(bool value);
+
+  /**
+   * @brief GetRefuseOverBudget
+   * @return
+   */
+  static bool GetRefuseOverBudget();
+
+  /**
+   * @brief GetMemoryBudgetInBytes Returns the memory budget in bytes, 0 if there is no budget and the physical memory is unknown
+   * @return
+   */
+  static size_t GetMemoryBudgetInBytes();
+
+  /**
+   * @brief GetPhysicalMemory Returns the physical memory of the machine in bytes, 0 if it is unknown
+   * @return
+   */
+  static size_t GetPhysicalMemory();
+
+  /**
+   * @brief Apply Pushes the policy to ITK (global number of threads, TBB threader when ITK is built with it)
+   * and to TBB (maximum allowed parallelism).
+   */
+  static void Apply();
+
+  /**
+   * @brief ApplyToFilter Sets the number of work units of an ITK filter. A filter can use fewer threads than the
+   * policy (maximumNumberOfThreads) and its own number of work units (numberOfWorkUnits), 0 keeps the policy.
+   * @param filter
+   * @param maximumNumberOfThreads
+   * @param numberOfWorkUnits
+   */
+  static void ApplyToFilter(itk::ProcessObject* filter, int maximumNumberOfThreads = 0, int numberOfWorkUnits = 0);
+
+  /**
+   * @brief ApplyToNestedFilter Configures an ITK filter that is updated from a task already running in parallel.
+   * Unless ITK shares the TBB pool, the filter runs on the calling thread to avoid oversubscription.
+   * @param filter
+   */
+  static void ApplyToNestedFilter(itk::ProcessObject* filter);
+
+private:
+  static int s_MaximumNumberOfThreads;
+  static int s_NumberOfWorkUnits;
+  static int s_MemoryBudget;
+  static bool s_RefuseOverBudget;
+};
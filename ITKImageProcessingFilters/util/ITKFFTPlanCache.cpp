@@ -0,0 +1,113 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "ITKFFTPlanCache.h"
+
+#include <cstdlib>
+
+#include <QtCore/QDir>
+#include <QtCore/QStandardPaths>
+
+#include <itkConfigure.h>
+
+#if defined(ITK_USE_FFTWF) || defined(ITK_USE_FFTWD)
+#define ITKIMAGEPROCESSING_USE_FFTW 1
+#include <itkFFTWGlobalConfiguration.h>
+#else
+#define ITKIMAGEPROCESSING_USE_FFTW 0
+#endif
+
+// ----------------------------------------------------------------------------
+ITKFFTPlanCache::ScopedConfiguration::ScopedConfiguration(bool measurePlans)
+{
+#if ITKIMAGEPROCESSING_USE_FFTW
+  if(!measurePlans || nullptr != std::getenv("ITK_FFTW_PLAN_RIGOR"))
+  {
+    return;
+  }
+  const QString directory = GetWisdomDirectory();
+  if(directory.isEmpty() || !QDir().mkpath(directory))
+  {
+    return;
+  }
+  m_Applied = true;
+  m_PlanRigor = itk::FFTWGlobalConfiguration::GetPlanRigor();
+  m_ReadWisdomCache = itk::FFTWGlobalConfiguration::GetReadWisdomCache();
+  m_WriteWisdomCache = itk::FFTWGlobalConfiguration::GetWriteWisdomCache();
+  m_WisdomCacheBase = itk::FFTWGlobalConfiguration::GetWisdomCacheBase();
+
+  itk::FFTWGlobalConfiguration::SetWisdomCacheBase(QDir::toNativeSeparators(directory).toStdString());
+  itk::FFTWGlobalConfiguration::SetReadWisdomCache(true);
+  itk::FFTWGlobalConfiguration::SetWriteWisdomCache(true);
+  // Measuring a plan is only worth it because the same sizes come back for every pair of tiles
+  itk::FFTWGlobalConfiguration::SetPlanRigor(itk::FFTWGlobalConfiguration::GetPlanRigorValue("FFTW_MEASURE"));
+#else
+  (void)measurePlans;
+#endif
+}
+
+// ----------------------------------------------------------------------------
+ITKFFTPlanCache::ScopedConfiguration::~ScopedConfiguration()
+{
+#if ITKIMAGEPROCESSING_USE_FFTW
+  if(!m_Applied)
+  {
+    return;
+  }
+  // Plans made from now on are estimated again, and do not read the measured plans of the wisdom
+  itk::FFTWGlobalConfiguration::SetPlanRigor(m_PlanRigor);
+  itk::FFTWGlobalConfiguration::SetReadWisdomCache(m_ReadWisdomCache);
+  itk::FFTWGlobalConfiguration::SetWriteWisdomCache(m_WriteWisdomCache);
+  itk::FFTWGlobalConfiguration::SetWisdomCacheBase(m_WisdomCacheBase);
+#endif
+}
+
+// ----------------------------------------------------------------------------
+bool ITKFFTPlanCache::IsAvailable()
+{
+  return ITKIMAGEPROCESSING_USE_FFTW != 0;
+}
+
+// ----------------------------------------------------------------------------
+QString ITKFFTPlanCache::GetWisdomDirectory()
+{
+  const char* directory = std::getenv("ITKIMAGEPROCESSING_FFTW_WISDOM_DIR");
+  if(nullptr != directory)
+  {
+    return QString::fromLocal8Bit(directory);
+  }
+  const QString cacheLocation = QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation);
+  if(cacheLocation.isEmpty())
+  {
+    return QString();
+  }
+  return cacheLocation + QDir::separator() + "ITKImageProcessing" + QDir::separator() + "FFTW";
+}
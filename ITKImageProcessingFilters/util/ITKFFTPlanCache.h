@@ -0,0 +1,89 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <string>
+
+#include <QtCore/QString>
+
+#include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
+
+/**
+ * @brief The ITKFFTPlanCache class lets the FFT filters of the montage registrations reuse measured FFT plans. The
+ * overlap windows of a montage all have the same few sizes, so when ITK computes its FFTs with FFTW, each plan can be
+ * measured once per size and kept as FFTW wisdom, in memory for the following pairs and on disk for the following
+ * runs. Measured plans are faster but FFTW may pick a different plan on each run, so the results are only
+ * reproducible to the last bits with the default estimated plans. The filters therefore only measure plans when
+ * asked to (see ScopedConfiguration). The per tile spectra themselves are cached by the montage classes of ITK
+ * (TileMontage).
+ */
+class ITKImageProcessing_EXPORT ITKFFTPlanCache
+{
+public:
+  /**
+   * @brief The ScopedConfiguration class measures the FFTW plans and uses the wisdom cache in GetWisdomDirectory()
+   * while it exists, then restores the previous FFTW configuration. The FFTW configuration of ITK is global to the
+   * process. Does nothing when 'measurePlans' is false, when ITK does not use FFTW, or when the plan rigor is set
+   * with the ITK_FFTW_PLAN_RIGOR environment variable.
+   */
+  class ITKImageProcessing_EXPORT ScopedConfiguration
+  {
+  public:
+    explicit ScopedConfiguration(bool measurePlans);
+    ~ScopedConfiguration();
+
+    ScopedConfiguration(const ScopedConfiguration&) = delete;            // Copy Constructor Not Implemented
+    ScopedConfiguration(ScopedConfiguration&&) = delete;                 // Move Constructor Not Implemented
+    ScopedConfiguration& operator=(const ScopedConfiguration&) = delete; // Copy Assignment Not Implemented
+    ScopedConfiguration& operator=(ScopedConfiguration&&) = delete;      // Move Assignment Not Implemented
+
+  private:
+    bool m_Applied = false;
+    int m_PlanRigor = 0;
+    bool m_ReadWisdomCache = false;
+    bool m_WriteWisdomCache = false;
+    std::string m_WisdomCacheBase;
+  };
+
+  /**
+   * @brief IsAvailable Returns whether ITK computes its FFTs with FFTW
+   * @return
+   */
+  static bool IsAvailable();
+
+  /**
+   * @brief GetWisdomDirectory Returns the directory of the FFTW wisdom files: ITKIMAGEPROCESSING_FFTW_WISDOM_DIR if it
+   * is set, otherwise a directory in the cache location of the user
+   * @return
+   */
+  static QString GetWisdomDirectory();
+};
@@ -0,0 +1,332 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ITKFilterTelemetry.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QStringList>
+#include <QtCore/QTextStream>
+
+#include "SIMPLib/Filtering/AbstractFilter.h"
+
+namespace
+{
+// ----------------------------------------------------------------------------
+bool readEnabledFromEnvironment()
+{
+  const char* value = std::getenv("ITKIMAGEPROCESSING_TELEMETRY");
+  return nullptr != value && std::atoi(value) != 0;
+}
+
+// ----------------------------------------------------------------------------
+QString readSinkFileFromEnvironment()
+{
+  const char* value = std::getenv("ITKIMAGEPROCESSING_TELEMETRY_FILE");
+  return nullptr == value ? QString() : QString::fromLocal8Bit(value);
+}
+
+std::mutex s_SinkMutex;
+bool s_Enabled = readEnabledFromEnvironment();
+QString s_SinkFile = readSinkFileFromEnvironment();
+
+const QString k_UpdatePhase("Update");
+} // namespace
+
+// ----------------------------------------------------------------------------
+ITKFilterTelemetry::ITKFilterTelemetry(AbstractFilter* filter)
+: m_Filter(filter)
+, m_SinkFile(GetSinkFile())
+{
+  // Nothing is measured when the records are not published, executions without telemetry pay no system call
+  m_Active = IsEnabled() || !m_SinkFile.isEmpty();
+  if(!m_Active)
+  {
+    return;
+  }
+  m_WallStart = std::chrono::steady_clock::now();
+  m_CpuStart = GetProcessCpuTime();
+  m_PeakMemoryStart = GetPeakResidentMemory();
+}
+
+// ----------------------------------------------------------------------------
+ITKFilterTelemetry::~ITKFilterTelemetry()
+{
+  finish();
+}
+
+// ----------------------------------------------------------------------------
+ITKFilterTelemetry::ScopedPhase::ScopedPhase(ITKFilterTelemetry* telemetry, const QString& name)
+: m_Telemetry(nullptr != telemetry && telemetry->m_Active ? telemetry : nullptr)
+, m_Name(name)
+{
+  if(nullptr != m_Telemetry)
+  {
+    m_WallStart = std::chrono::steady_clock::now();
+    m_CpuStart = GetProcessCpuTime();
+  }
+}
+
+// ----------------------------------------------------------------------------
+ITKFilterTelemetry::ScopedPhase::~ScopedPhase()
+{
+  if(nullptr != m_Telemetry)
+  {
+    std::chrono::duration<double> wallTime = std::chrono::steady_clock::now() - m_WallStart;
+    m_Telemetry->addPhase(m_Name, wallTime.count(), GetProcessCpuTime() - m_CpuStart);
+  }
+}
+
+// ----------------------------------------------------------------------------
+void ITKFilterTelemetry::addPhase(const QString& name, double wallTime, double cpuTime)
+{
+  // Phases run several times (e.g. once per streamed piece) are accumulated
+  for(auto& phase : m_Phases)
+  {
+    if(phase.Name == name)
+    {
+      phase.WallTime += wallTime;
+      phase.CpuTime += cpuTime;
+      return;
+    }
+  }
+  m_Phases.push_back({name, wallTime, cpuTime});
+}
+
+// ----------------------------------------------------------------------------
+void ITKFilterTelemetry::setNumberOfVoxels(size_t value)
+{
+  m_NumberOfVoxels = value;
+}
+
+// ----------------------------------------------------------------------------
+void ITKFilterTelemetry::addAllocatedBytes(size_t value)
+{
+  m_AllocatedBytes += value;
+}
+
+// ----------------------------------------------------------------------------
+void ITKFilterTelemetry::finish()
+{
+  if(m_Finished)
+  {
+    return;
+  }
+  m_Finished = true;
+  if(!m_Active)
+  {
+    return;
+  }
+
+  std::chrono::duration<double> wallTime = std::chrono::steady_clock::now() - m_WallStart;
+  m_WallTime = wallTime.count();
+  m_CpuTime = GetProcessCpuTime() - m_CpuStart;
+  m_PeakMemory = GetPeakResidentMemory();
+
+  if(nullptr != m_Filter)
+  {
+    QString ss;
+    QTextStream out(&ss);
+    out << "Telemetry: wall " << m_WallTime << " s, cpu " << m_CpuTime << " s";
+    for(const auto& phase : m_Phases)
+    {
+      out << ", " << phase.Name << " " << phase.WallTime << " s";
+    }
+    out << ", peak memory " << m_PeakMemory / (1024 * 1024) << " MB (+" << (m_PeakMemory - std::min(m_PeakMemory, m_PeakMemoryStart)) / (1024 * 1024) << " MB)";
+    out << ", allocated " << m_AllocatedBytes / (1024 * 1024) << " MB";
+    if(m_NumberOfVoxels > 0 && m_WallTime > 0.0)
+    {
+      out << ", " << static_cast<double>(m_NumberOfVoxels) / m_WallTime / 1.0e6 << " Mvoxels/s";
+    }
+    m_Filter->notifyStatusMessage(ss);
+  }
+
+  if(!m_SinkFile.isEmpty())
+  {
+    writeToSink(m_SinkFile);
+  }
+}
+
+// ----------------------------------------------------------------------------
+void ITKFilterTelemetry::writeToSink(const QString& filePath) const
+{
+  const QString filterName = nullptr != m_Filter ? m_Filter->getNameOfClass() : QString();
+  const int errorCode = nullptr != m_Filter ? m_Filter->getErrorCode() : 0;
+  const size_t peakMemoryGrowth = m_PeakMemory - std::min(m_PeakMemory, m_PeakMemoryStart);
+  double updateTime = m_WallTime;
+  for(const auto& phase : m_Phases)
+  {
+    if(phase.Name == k_UpdatePhase)
+    {
+      updateTime = phase.WallTime;
+    }
+  }
+  const double voxelsPerSecond = updateTime > 0.0 ? static_cast<double>(m_NumberOfVoxels) / updateTime : 0.0;
+
+  std::lock_guard<std::mutex> lock(s_SinkMutex);
+  QFile file(filePath);
+  const bool isNewFile = !file.exists() || file.size() == 0;
+  if(!file.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text))
+  {
+    return;
+  }
+  QTextStream out(&file);
+
+  if(filePath.endsWith(".csv", Qt::CaseInsensitive))
+  {
+    if(isNewFile)
+    {
+      out << "Filter,ErrorCode,WallTime,CpuTime,PeakResidentMemory,PeakResidentMemoryGrowth,AllocatedBytes,Voxels,VoxelsPerSecond,Phases\n";
+    }
+    QStringList phases;
+    for(const auto& phase : m_Phases)
+    {
+      phases << QString("%1:%2:%3").arg(phase.Name).arg(phase.WallTime).arg(phase.CpuTime);
+    }
+    out << filterName << "," << errorCode << "," << m_WallTime << "," << m_CpuTime << "," << m_PeakMemory << "," << peakMemoryGrowth << "," << m_AllocatedBytes << "," << m_NumberOfVoxels << ","
+        << voxelsPerSecond << "," << phases.join(';') << "\n";
+    return;
+  }
+
+  QJsonObject record;
+  record["Filter"] = filterName;
+  record["ErrorCode"] = errorCode;
+  record["WallTime"] = m_WallTime;
+  record["CpuTime"] = m_CpuTime;
+  record["PeakResidentMemory"] = static_cast<double>(m_PeakMemory);
+  record["PeakResidentMemoryGrowth"] = static_cast<double>(peakMemoryGrowth);
+  record["AllocatedBytes"] = static_cast<double>(m_AllocatedBytes);
+  record["Voxels"] = static_cast<double>(m_NumberOfVoxels);
+  record["VoxelsPerSecond"] = voxelsPerSecond;
+  QJsonArray phases;
+  for(const auto& phase : m_Phases)
+  {
+    QJsonObject phaseObject;
+    phaseObject["Name"] = phase.Name;
+    phaseObject["WallTime"] = phase.WallTime;
+    phaseObject["CpuTime"] = phase.CpuTime;
+    phases.append(phaseObject);
+  }
+  record["Phases"] = phases;
+  out << QJsonDocument(record).toJson(QJsonDocument::Compact) << "\n";
+}
+
+// ----------------------------------------------------------------------------
+bool ITKFilterTelemetry::IsEnabled()
+{
+  return s_Enabled;
+}
+
+// ----------------------------------------------------------------------------
+void ITKFilterTelemetry::SetEnabled(bool value)
+{
+  s_Enabled = value;
+}
+
+// ----------------------------------------------------------------------------
+void ITKFilterTelemetry::SetSinkFile(const QString& filePath)
+{
+  std::lock_guard<std::mutex> lock(s_SinkMutex);
+  s_SinkFile = filePath;
+}
+
+// ----------------------------------------------------------------------------
+QString ITKFilterTelemetry::GetSinkFile()
+{
+  std::lock_guard<std::mutex> lock(s_SinkMutex);
+  return s_SinkFile;
+}
+
+// ----------------------------------------------------------------------------
+double ITKFilterTelemetry::GetProcessCpuTime()
+{
+#if defined(_WIN32)
+  FILETIME creationTime;
+  FILETIME exitTime;
+  FILETIME kernelTime;
+  FILETIME userTime;
+  if(GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime) == 0)
+  {
+    return 0.0;
+  }
+  auto toSeconds = [](const FILETIME& time) { return static_cast<double>((static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime) * 1.0e-7; };
+  return toSeconds(kernelTime) + toSeconds(userTime);
+#else
+  rusage usage;
+  if(getrusage(RUSAGE_SELF, &usage) != 0)
+  {
+    return 0.0;
+  }
+  return static_cast<double>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) + static_cast<double>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) * 1.0e-6;
+#endif
+}
+
+// ----------------------------------------------------------------------------
+size_t ITKFilterTelemetry::GetPeakResidentMemory()
+{
+#if defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS counters;
+  if(GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) == 0)
+  {
+    return 0;
+  }
+  return static_cast<size_t>(counters.PeakWorkingSetSize);
+#else
+  rusage usage;
+  if(getrusage(RUSAGE_SELF, &usage) != 0)
+  {
+    return 0;
+  }
+#if defined(__APPLE__)
+  return static_cast<size_t>(usage.ru_maxrss); // bytes
+#else
+  return static_cast<size_t>(usage.ru_maxrss) * 1024; // kilobytes
+#endif
+#endif
+}
@@ -0,0 +1,174 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <chrono>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
+
+class AbstractFilter;
+
+/**
+ * @brief The ITKFilterTelemetry class measures the execution of a filter: wall and CPU time of the whole
+ * execution and of named phases (e.g. conversion to ITK, ITK update, conversion back to DREAM.3D), growth of
+ * the peak resident memory of the process, bytes allocated for the output and voxel throughput.
+ *
+ * Telemetry is off unless the ITKIMAGEPROCESSING_TELEMETRY environment variable is set to a non zero value
+ * or a sink file is given (ITKIMAGEPROCESSING_TELEMETRY_FILE or SetSinkFile()). When enabled, each record is
+ * published as a status message of the filter and appended to the sink file, as one JSON object per line
+ * or, when the file name ends with .csv, as a CSV row. Whether a record is published is decided when the
+ * measure starts: when telemetry is off, nothing is measured.
+ */
+class ITKImageProcessing_EXPORT ITKFilterTelemetry
+{
+public:
+  /**
+   * @brief ITKFilterTelemetry Starts measuring the execution of 'filter', if telemetry is enabled or a sink
+   * file is set
+   * @param filter
+   */
+  explicit ITKFilterTelemetry(AbstractFilter* filter);
+
+  /**
+   * @brief Publishes the record if finish() was not called
+   */
+  ~ITKFilterTelemetry();
+
+  ITKFilterTelemetry(const ITKFilterTelemetry&) = delete;
+  ITKFilterTelemetry(ITKFilterTelemetry&&) = delete;
+  ITKFilterTelemetry& operator=(const ITKFilterTelemetry&) = delete;
+  ITKFilterTelemetry& operator=(ITKFilterTelemetry&&) = delete;
+
+  /**
+   * @brief The ScopedPhase class adds the wall and CPU time of its scope to a phase of a telemetry record.
+   * A null telemetry is accepted so that callers do not need to check if telemetry is active.
+   */
+  class ITKImageProcessing_EXPORT ScopedPhase
+  {
+  public:
+    ScopedPhase(ITKFilterTelemetry* telemetry, const QString& name);
+    ~ScopedPhase();
+
+    ScopedPhase(const ScopedPhase&) = delete;
+    ScopedPhase(ScopedPhase&&) = delete;
+    ScopedPhase& operator=(const ScopedPhase&) = delete;
+    ScopedPhase& operator=(ScopedPhase&&) = delete;
+
+  private:
+    ITKFilterTelemetry* m_Telemetry = nullptr;
+    QString m_Name;
+    std::chrono::steady_clock::time_point m_WallStart;
+    double m_CpuStart = 0.0;
+  };
+
+  /**
+   * @brief setNumberOfVoxels Sets the number of voxels processed, used for the throughput
+   * @param value
+   */
+  void setNumberOfVoxels(size_t value);
+
+  /**
+   * @brief addAllocatedBytes Adds to the number of bytes allocated by the filter
+   * @param value
+   */
+  void addAllocatedBytes(size_t value);
+
+  /**
+   * @brief finish Stops the measure and publishes the record
+   */
+  void finish();
+
+  /**
+   * @brief IsEnabled
+   * @return True if the records are published
+   */
+  static bool IsEnabled();
+
+  /**
+   * @brief SetEnabled Enables or disables the publication of the records
+   * @param value
+   */
+  static void SetEnabled(bool value);
+
+  /**
+   * @brief SetSinkFile Sets the file the records are appended to. An empty path disables the file sink.
+   * @param filePath
+   */
+  static void SetSinkFile(const QString& filePath);
+
+  /**
+   * @brief GetSinkFile
+   * @return The file the records are appended to
+   */
+  static QString GetSinkFile();
+
+  /**
+   * @brief GetProcessCpuTime Returns the user and system CPU time of the process in seconds
+   * @return
+   */
+  static double GetProcessCpuTime();
+
+  /**
+   * @brief GetPeakResidentMemory Returns the peak resident memory of the process in bytes
+   * @return
+   */
+  static size_t GetPeakResidentMemory();
+
+protected:
+  struct Phase
+  {
+    QString Name;
+    double WallTime = 0.0;
+    double CpuTime = 0.0;
+  };
+
+  void addPhase(const QString& name, double wallTime, double cpuTime);
+  void writeToSink(const QString& filePath) const;
+
+private:
+  AbstractFilter* m_Filter = nullptr;
+  QString m_SinkFile;
+  bool m_Active = false;
+  bool m_Finished = false;
+  std::chrono::steady_clock::time_point m_WallStart;
+  double m_CpuStart = 0.0;
+  size_t m_PeakMemoryStart = 0;
+  double m_WallTime = 0.0;
+  double m_CpuTime = 0.0;
+  size_t m_PeakMemory = 0;
+  size_t m_NumberOfVoxels = 0;
+  size_t m_AllocatedBytes = 0;
+  std::vector<Phase> m_Phases;
+};
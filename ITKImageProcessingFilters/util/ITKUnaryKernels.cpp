@@ -0,0 +1,107 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ITKUnaryKernels.h"
+
+#include <cmath>
+
+#define ITK_UNARY_KERNEL(Name, Expression)                                                                                                                                                            \
+  void compute##Name(double* values, size_t count, double parameter)                                                                                                                                  \
+  {                                                                                                                                                                                                    \
+    (void)parameter;                                                                                                                                                                                   \
+    for(size_t i = 0; i < count; i++)                                                                                                                                                                  \
+    {                                                                                                                                                                                                  \
+      const double value = values[i];                                                                                                                                                                  \
+      values[i] = Expression;                                                                                                                                                                          \
+    }                                                                                                                                                                                                  \
+  }
+
+namespace
+{
+// Same expressions as the functors of the corresponding ITK filters
+ITK_UNARY_KERNEL(Acos, std::acos(value))
+ITK_UNARY_KERNEL(Asin, std::asin(value))
+ITK_UNARY_KERNEL(Atan, std::atan(value))
+ITK_UNARY_KERNEL(Cos, std::cos(value))
+ITK_UNARY_KERNEL(Sin, std::sin(value))
+ITK_UNARY_KERNEL(Tan, std::tan(value))
+ITK_UNARY_KERNEL(Exp, std::exp(value))
+ITK_UNARY_KERNEL(ExpNegative, std::exp(-parameter * value))
+ITK_UNARY_KERNEL(Log, std::log(value))
+ITK_UNARY_KERNEL(Log10, std::log10(value))
+ITK_UNARY_KERNEL(Square, value * value)
+ITK_UNARY_KERNEL(BoundedReciprocal, 1.0 / (1.0 + value))
+} // namespace
+
+// ----------------------------------------------------------------------------
+void ITKUnaryKernels::Compute(Operation operation, double* values, size_t count, double parameter)
+{
+  switch(operation)
+  {
+  case Operation::Acos:
+    computeAcos(values, count, parameter);
+    break;
+  case Operation::Asin:
+    computeAsin(values, count, parameter);
+    break;
+  case Operation::Atan:
+    computeAtan(values, count, parameter);
+    break;
+  case Operation::Cos:
+    computeCos(values, count, parameter);
+    break;
+  case Operation::Sin:
+    computeSin(values, count, parameter);
+    break;
+  case Operation::Tan:
+    computeTan(values, count, parameter);
+    break;
+  case Operation::Exp:
+    computeExp(values, count, parameter);
+    break;
+  case Operation::ExpNegative:
+    computeExpNegative(values, count, parameter);
+    break;
+  case Operation::Log:
+    computeLog(values, count, parameter);
+    break;
+  case Operation::Log10:
+    computeLog10(values, count, parameter);
+    break;
+  case Operation::Square:
+    computeSquare(values, count, parameter);
+    break;
+  case Operation::BoundedReciprocal:
+    computeBoundedReciprocal(values, count, parameter);
+    break;
+  }
+}
@@ -0,0 +1,134 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+#include "SIMPLib/Common/SIMPLRange.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+#include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
+
+/**
+ * @brief The ITKUnaryKernels class computes the pixel-wise operations of the unary ITK filters (Acos, Exp,
+ * Square...) directly on contiguous scalar buffers. Each value is converted to double, transformed and cast
+ * to the output type exactly like the ITK functors do, so the results are identical to the ITK filters.
+ * The buffers are processed in parallel, in blocks of BlockSize values converted to double.
+ */
+class ITKImageProcessing_EXPORT ITKUnaryKernels
+{
+public:
+  enum class Operation : int
+  {
+    Acos = 0,
+    Asin,
+    Atan,
+    Cos,
+    Sin,
+    Tan,
+    Exp,
+    ExpNegative,
+    Log,
+    Log10,
+    Square,
+    BoundedReciprocal
+  };
+
+  static const size_t BlockSize = 4096;
+
+  /**
+   * @brief Compute Replaces each of the 'count' values by the result of the operation
+   * @param operation
+   * @param values
+   * @param count
+   * @param parameter Factor of ExpNegative, unused by the other operations
+   */
+  static void Compute(Operation operation, double* values, size_t count, double parameter);
+
+  /**
+   * @brief Apply Computes 'output[i] = operation(input[i])' for the 'count' values of the buffers. 'output' may
+   * be the same buffer as 'input'.
+   * @param operation
+   * @param parameter Factor of ExpNegative, unused by the other operations
+   * @param input
+   * @param output
+   * @param count
+   */
+  template <typename InputType, typename OutputType>
+  static void Apply(Operation operation, double parameter, const InputType* input, OutputType* output, size_t count)
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, count);
+    dataAlg.execute(ApplyImpl<InputType, OutputType>(operation, parameter, input, output));
+  }
+
+private:
+  template <typename InputType, typename OutputType>
+  class ApplyImpl
+  {
+  public:
+    ApplyImpl(Operation operation, double parameter, const InputType* input, OutputType* output)
+    : m_Operation(operation)
+    , m_Parameter(parameter)
+    , m_Input(input)
+    , m_Output(output)
+    {
+    }
+
+    void operator()(const SIMPLRange& range) const
+    {
+      double buffer[BlockSize];
+      for(size_t start = range.min(); start < range.max(); start += BlockSize)
+      {
+        const size_t count = std::min(BlockSize, range.max() - start);
+        const InputType* input = m_Input + start;
+        OutputType* output = m_Output + start;
+        for(size_t i = 0; i < count; i++)
+        {
+          buffer[i] = static_cast<double>(input[i]);
+        }
+        Compute(m_Operation, buffer, count, m_Parameter);
+        for(size_t i = 0; i < count; i++)
+        {
+          output[i] = static_cast<OutputType>(buffer[i]);
+        }
+      }
+    }
+
+  private:
+    Operation m_Operation;
+    double m_Parameter;
+    const InputType* m_Input;
+    OutputType* m_Output;
+  };
+};
@@ -0,0 +1,185 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "IncrementalStitching.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <QtCore/QDateTime>
+#include <QtCore/QFileInfo>
+
+#include "SIMPLib/Common/SIMPLRange.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/MontageImportHelper.h"
+
+namespace
+{
+// 64 bit FNV-1a constants
+const uint64_t k_OffsetBasis = 14695981039346656037ULL;
+const uint64_t k_Prime = 1099511628211ULL;
+
+/**
+ * @brief HashBytes FNV-1a over the 8 byte words of a buffer, the trailing bytes one by one. The high half of the
+ * hash is folded into the low half after each word, so that every bit of a word reaches every bit of the hash.
+ * @param bytes
+ * @param count
+ * @param hash
+ * @return
+ */
+uint64_t HashBytes(const uint8_t* bytes, size_t count, uint64_t hash)
+{
+  const size_t wordCount = count / sizeof(uint64_t);
+  for(size_t i = 0; i < wordCount; i++)
+  {
+    uint64_t word = 0;
+    std::memcpy(&word, bytes + i * sizeof(uint64_t), sizeof(uint64_t));
+    hash = (hash ^ word) * k_Prime;
+    hash ^= hash >> 32;
+  }
+  for(size_t i = wordCount * sizeof(uint64_t); i < count; i++)
+  {
+    hash = (hash ^ bytes[i]) * k_Prime;
+  }
+  return hash;
+}
+
+/**
+ * @brief The ChecksumBlocksImpl class hashes the blocks of a buffer, see IncrementalStitching::ComputeChecksum
+ */
+class ChecksumBlocksImpl
+{
+public:
+  ChecksumBlocksImpl(const uint8_t* bytes, size_t byteCount, uint64_t* blockHashes)
+  : m_Bytes(bytes)
+  , m_ByteCount(byteCount)
+  , m_BlockHashes(blockHashes)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t block = range.min(); block < range.max(); block++)
+    {
+      const size_t start = block * IncrementalStitching::ChecksumBlockBytes;
+      const size_t count = std::min(IncrementalStitching::ChecksumBlockBytes, m_ByteCount - start);
+      m_BlockHashes[block] = HashBytes(m_Bytes + start, count, k_OffsetBasis);
+    }
+  }
+
+private:
+  const uint8_t* m_Bytes;
+  size_t m_ByteCount;
+  uint64_t* m_BlockHashes;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IncrementalStitching::IncrementalStitching() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IncrementalStitching::~IncrementalStitching() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IncrementalStitching::AddChangedRegion(std::vector<RegionType>& regions, RegionType region)
+{
+  if(region.GetNumberOfPixels() == 0)
+  {
+    return;
+  }
+  bool merged = true;
+  while(merged)
+  {
+    merged = false;
+    for(auto iter = regions.begin(); iter != regions.end(); ++iter)
+    {
+      RegionType overlap = *iter;
+      if(!overlap.Crop(region))
+      {
+        continue;
+      }
+      RegionType::IndexType lower;
+      RegionType::IndexType upper;
+      for(unsigned d = 0; d < 2; d++)
+      {
+        lower[d] = std::min(region.GetIndex(d), iter->GetIndex(d));
+        upper[d] = std::max(region.GetUpperIndex()[d], iter->GetUpperIndex()[d]);
+      }
+      region.SetIndex(lower);
+      region.SetUpperIndex(upper);
+      regions.erase(iter);
+      merged = true;
+      break;
+    }
+  }
+  regions.push_back(region);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t IncrementalStitching::ComputeChecksum(const void* data, size_t byteCount)
+{
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  const size_t blockCount = (byteCount + ChecksumBlockBytes - 1) / ChecksumBlockBytes;
+  std::vector<uint64_t> blockHashes(blockCount, 0);
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, blockCount);
+  dataAlg.execute(ChecksumBlocksImpl(bytes, byteCount, blockHashes.data()));
+
+  uint64_t hash = HashBytes(reinterpret_cast<const uint8_t*>(blockHashes.data()), blockCount * sizeof(uint64_t), k_OffsetBasis);
+  return (hash ^ static_cast<uint64_t>(byteCount)) * k_Prime;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString IncrementalStitching::GetTileChecksum(const DataContainer::Pointer& dc, const QString& amName, const QString& daName)
+{
+  QString tileFilePath = MontageImportHelper::GetTileSourceFilePath(dc);
+  if(!tileFilePath.isEmpty())
+  {
+    QFileInfo fi(tileFilePath);
+    return QString("%1:%2:%3").arg(fi.absoluteFilePath()).arg(fi.size()).arg(fi.lastModified().toMSecsSinceEpoch());
+  }
+
+  IDataArray::Pointer da = dc->getAttributeMatrix(amName)->getAttributeArray(daName);
+  return QString::number(ComputeChecksum(da->getVoidPointer(0), da->getSize() * da->getTypeSize()), 16);
+}
@@ -0,0 +1,95 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/DataContainers/DataContainer.h"
+
+#include "itkImageRegion.h"
+
+#include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
+
+/**
+ * @brief The IncrementalStitching class holds what ITKStitchMontage needs to find the regions of a montage file
+ * that must be written again: the checksums identifying the tiles of a stitch and the merging of the regions
+ * covered by the tiles that changed.
+ */
+class ITKImageProcessing_EXPORT IncrementalStitching
+{
+public:
+  using RegionType = itk::ImageRegion<2>;
+
+  /**
+   * @brief AddChangedRegion Adds a region to the regions to write again. Overlapping regions are merged into their
+   * bounding box, so that no pixel is resampled twice. Empty regions are ignored.
+   * @param regions
+   * @param region
+   */
+  static void AddChangedRegion(std::vector<RegionType>& regions, RegionType region);
+
+  /**
+   * @brief ComputeChecksum Returns a 64 bit checksum of a buffer. The buffer is hashed 8 bytes at a time, in
+   * blocks of ChecksumBlockBytes hashed in parallel and combined in order, so the checksum does not depend on the
+   * number of threads.
+   * @param data
+   * @param byteCount
+   * @return
+   */
+  static uint64_t ComputeChecksum(const void* data, size_t byteCount);
+
+  /**
+   * @brief GetTileChecksum Returns a checksum of the pixels of a tile. Tiles loaded on demand are identified by
+   * their file, its size and its modification time instead, so that they are not read.
+   * @param dc
+   * @param amName
+   * @param daName
+   * @return
+   */
+  static QString GetTileChecksum(const DataContainer::Pointer& dc, const QString& amName, const QString& daName);
+
+  static constexpr size_t ChecksumBlockBytes = 1024 * 1024;
+
+protected:
+  IncrementalStitching();
+  ~IncrementalStitching();
+
+public:
+  IncrementalStitching(const IncrementalStitching&) = delete;            // Copy Constructor Not Implemented
+  IncrementalStitching(IncrementalStitching&&) = delete;                 // Move Constructor Not Implemented
+  IncrementalStitching& operator=(const IncrementalStitching&) = delete; // Copy Assignment Not Implemented
+  IncrementalStitching& operator=(IncrementalStitching&&) = delete;      // Move Assignment Not Implemented
+};
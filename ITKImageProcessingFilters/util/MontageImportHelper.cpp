@@ -34,8 +34,11 @@
 
 #include <QtCore/QObject>
 
+#include "SIMPLib/DataArrays/StringDataArray.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 
+#include "ITKImageProcessing/ITKImageProcessingConstants.h"
+
 #include "ITKImageProcessing/ITKImageProcessingFilters/MetaXmlUtils.h"
 
 // -----------------------------------------------------------------------------
@@ -179,3 +182,53 @@ QString MontageImportHelper::GenerateDataContainerName(const QString& dataContai
   dcNameStream << col;
   return dcName;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MontageImportHelper::SetTileSourceFilePath(const DataContainer::Pointer& dc, const QString& filePath, const IDataArray::Pointer& imageData)
+{
+  AttributeMatrix::Pointer sourceAttrMat = AttributeMatrix::New({1}, ITKImageProcessing::Montage::k_TileSourceAttributeMatrixName, AttributeMatrix::Type::Generic);
+  StringDataArray::Pointer filePathArray = StringDataArray::CreateArray(1, ITKImageProcessing::Montage::k_TileSourceFilePathArrayName, true);
+  filePathArray->setValue(0, filePath);
+  sourceAttrMat->addOrReplaceAttributeArray(filePathArray);
+  IDataArray::Pointer pixelTypeArray = imageData->createNewArray(1, imageData->getComponentDimensions(), ITKImageProcessing::Montage::k_TileSourcePixelTypeArrayName, true);
+  pixelTypeArray->initializeWithZeros();
+  sourceAttrMat->addOrReplaceAttributeArray(pixelTypeArray);
+  dc->addOrReplaceAttributeMatrix(sourceAttrMat);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString MontageImportHelper::GetTileSourceFilePath(const DataContainer::Pointer& dc)
+{
+  AttributeMatrix::Pointer sourceAttrMat = dc->getAttributeMatrix(ITKImageProcessing::Montage::k_TileSourceAttributeMatrixName);
+  if(nullptr == sourceAttrMat.get())
+  {
+    return {};
+  }
+  StringDataArray::Pointer filePathArray = sourceAttrMat->getAttributeArrayAs<StringDataArray>(ITKImageProcessing::Montage::k_TileSourceFilePathArrayName);
+  if(nullptr == filePathArray.get() || filePathArray->getNumberOfTuples() == 0)
+  {
+    return {};
+  }
+  return filePathArray->getValue(0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer MontageImportHelper::GetTilePixelArray(const DataContainer::Pointer& dc, const QString& amName, const QString& daName)
+{
+  if(!GetTileSourceFilePath(dc).isEmpty())
+  {
+    return dc->getAttributeMatrix(ITKImageProcessing::Montage::k_TileSourceAttributeMatrixName)->getAttributeArray(ITKImageProcessing::Montage::k_TileSourcePixelTypeArrayName);
+  }
+  AttributeMatrix::Pointer am = dc->getAttributeMatrix(amName);
+  if(nullptr == am.get())
+  {
+    return {};
+  }
+  return am->getAttributeArray(daName);
+}
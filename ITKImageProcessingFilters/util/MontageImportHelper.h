@@ -31,7 +31,17 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #pragma once
 
+#include <vector>
+
 #include "SIMPLib/CoreFilters/ConvertColorToGrayScale.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+#include "SIMPLib/ITK/itkInPlaceDream3DDataToImageFilter.h"
+
+#include "itkChangeInformationImageFilter.h"
+#include "itkImageFileReader.h"
+#include "itkRGBToLuminanceImageFilter.h"
 
 #include "ITKImageProcessing/ITKImageProcessingFilters/ITKImageReader.h"
 #include "ITKImageProcessing/ITKImageProcessingPlugin.h"
@@ -87,6 +97,111 @@ public:
    */
   static QString GenerateDataContainerName(const QString& dataContainerPrefix, const IntVec2Type& montageMaxValues, int32_t row, int32_t col);
 
+  /**
+   * @brief SetTileSourceFilePath Records the image file of a tile whose pixels are not read by the importer,
+   * so that the montage filters can load it on demand. The tile keeps no image array: a single pixel of the type
+   * of 'imageData' is recorded next to the file instead, so that the montage filters know the pixel type.
+   * @param dc
+   * @param filePath
+   * @param imageData
+   */
+  static void SetTileSourceFilePath(const DataContainer::Pointer& dc, const QString& filePath, const IDataArray::Pointer& imageData);
+
+  /**
+   * @brief GetTileSourceFilePath Returns the image file recorded for a tile, or an empty string when the
+   * tile pixels are stored in the data container.
+   * @param dc
+   * @return
+   */
+  static QString GetTileSourceFilePath(const DataContainer::Pointer& dc);
+
+  /**
+   * @brief GetTilePixelArray Returns the image array of a tile or, for a tile loaded on demand, the single pixel
+   * recorded with its file. Only the type and the components of the returned array may be used.
+   * @param dc
+   * @param amName
+   * @param daName
+   * @return
+   */
+  static IDataArray::Pointer GetTilePixelArray(const DataContainer::Pointer& dc, const QString& amName, const QString& daName);
+
+  /**
+   * @brief CreateTileSourceImage Returns the image of a tile loaded on demand, placed at the origin and spacing
+   * of the tile geometry like the images of the tiles stored in the data container. The file is only read when
+   * the filter using the image is updated, and the pixels are released once that update is done. The filters
+   * reading the file are added to 'sources', which must be kept until then.
+   * @param dc
+   * @param filePath
+   * @param sources
+   * @return
+   */
+  template <typename ImageType>
+  static typename ImageType::Pointer CreateTileSourceImage(const DataContainer::Pointer& dc, const QString& filePath, std::vector<itk::ProcessObject::Pointer>& sources)
+  {
+    using ReaderType = itk::ImageFileReader<ImageType>;
+    typename ReaderType::Pointer reader = ReaderType::New();
+    reader->SetFileName(filePath.toStdString());
+
+    ImageGeom::Pointer geom = dc->getGeometryAs<ImageGeom>();
+    const FloatVec3Type geomOrigin = geom->getOrigin();
+    const FloatVec3Type geomSpacing = geom->getSpacing();
+    typename ImageType::PointType origin;
+    typename ImageType::SpacingType spacing;
+    for(unsigned int d = 0; d < ImageType::ImageDimension; d++)
+    {
+      origin[d] = geomOrigin[d];
+      spacing[d] = geomSpacing[d];
+    }
+
+    using ChangeInformationType = itk::ChangeInformationImageFilter<ImageType>;
+    typename ChangeInformationType::Pointer changeInformation = ChangeInformationType::New();
+    changeInformation->SetInput(reader->GetOutput());
+    changeInformation->SetOutputOrigin(origin);
+    changeInformation->ChangeOriginOn();
+    changeInformation->SetOutputSpacing(spacing);
+    changeInformation->ChangeSpacingOn();
+    reader->GetOutput()->ReleaseDataFlagOn();
+    changeInformation->GetOutput()->ReleaseDataFlagOn();
+    sources.push_back(reader.GetPointer());
+    sources.push_back(changeInformation.GetPointer());
+    return changeInformation->GetOutput();
+  }
+
+  /**
+   * @brief CreateTileLuminanceImage Returns the luminance image of a colour tile without computing it: the montage
+   * filters only request the overlap regions they correlate, so only those are converted, into a buffer of their
+   * size that is released as soon as the filter reading it is updated. The conversion filter is added to 'sources',
+   * which must be kept until then.
+   * @param dc
+   * @param amName
+   * @param daName
+   * @param sources
+   * @return
+   */
+  template <typename PixelType, unsigned Dimension>
+  static typename itk::Image<typename itk::NumericTraits<PixelType>::ValueType, Dimension>::Pointer CreateTileLuminanceImage(const DataContainer::Pointer& dc, const QString& amName,
+                                                                                                                             const QString& daName, std::vector<itk::ProcessObject::Pointer>& sources)
+  {
+    using ScalarImageType = itk::Image<typename itk::NumericTraits<PixelType>::ValueType, Dimension>;
+    using OriginalImageType = itk::Image<PixelType, Dimension>;
+
+    // The tile array is wrapped, not copied
+    using InPlaceDream3DToImageFileType = itk::InPlaceDream3DDataToImageFilter<PixelType, Dimension>;
+    typename InPlaceDream3DToImageFileType::Pointer toITK = InPlaceDream3DToImageFileType::New();
+    toITK->SetInput(dc);
+    toITK->SetInPlace(true);
+    toITK->SetAttributeMatrixArrayName(amName.toStdString());
+    toITK->SetDataArrayName(daName.toStdString());
+    toITK->Update();
+
+    using FilterType = itk::RGBToLuminanceImageFilter<OriginalImageType, ScalarImageType>;
+    typename FilterType::Pointer filter = FilterType::New();
+    filter->SetInput(toITK->GetOutput());
+    filter->GetOutput()->ReleaseDataFlagOn();
+    sources.push_back(filter.GetPointer());
+    return filter->GetOutput();
+  }
+
 protected:
   MontageImportHelper();
   ~MontageImportHelper();
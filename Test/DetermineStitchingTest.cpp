@@ -0,0 +1,402 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/DetermineStitching.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/ITKExecutionPolicy.h"
+#include "ITKImageProcessingTestFileLocations.h"
+
+class DetermineStitchingTest
+{
+
+public:
+  DetermineStitchingTest() = default;
+  ~DetermineStitchingTest() = default;
+  DetermineStitchingTest(const DetermineStitchingTest&) = delete;            // Copy Constructor
+  DetermineStitchingTest(DetermineStitchingTest&&) = delete;                 // Move Constructor
+  DetermineStitchingTest& operator=(const DetermineStitchingTest&) = delete; // Copy Assignment
+  DetermineStitchingTest& operator=(DetermineStitchingTest&&) = delete;      // Move Assignment
+
+  const size_t k_TileWidth = 100;
+  const size_t k_TileHeight = 80;
+  const float k_OverlapPercent = 20.0f;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief CreateTiles Cuts 'numXtiles' x 'numYtiles' overlapping tiles (comb order) out of one noise texture. The
+   * tiles are placed on the nominal grid given by the overlap, plus 'jitter' (x, y) pixels for each tile.
+   */
+  std::vector<FloatArrayType::Pointer> CreateTiles(size_t numXtiles, size_t numYtiles, const std::vector<int>& jitter)
+  {
+    const size_t stepX = k_TileWidth - static_cast<size_t>(k_TileWidth * k_OverlapPercent / 100.0f);
+    const size_t stepY = k_TileHeight - static_cast<size_t>(k_TileHeight * k_OverlapPercent / 100.0f);
+    const size_t margin = 8;
+    const size_t textureWidth = stepX * numXtiles + k_TileWidth + 2 * margin;
+    const size_t textureHeight = stepY * numYtiles + k_TileHeight + 2 * margin;
+    std::vector<float> texture(textureWidth * textureHeight);
+    std::mt19937 generator(5489u);
+    std::uniform_real_distribution<float> distribution(0.0f, 255.0f);
+    for(float& value : texture)
+    {
+      value = distribution(generator);
+    }
+
+    std::vector<FloatArrayType::Pointer> tiles;
+    for(size_t i = 0; i < numXtiles * numYtiles; i++)
+    {
+      const size_t originX = margin + (i % numXtiles) * stepX + jitter[2 * i];
+      const size_t originY = margin + (i / numXtiles) * stepY + jitter[2 * i + 1];
+      FloatArrayType::Pointer tile = FloatArrayType::CreateArray(k_TileWidth * k_TileHeight, QString("Tile %1").arg(i), true);
+      for(size_t y = 0; y < k_TileHeight; y++)
+      {
+        for(size_t x = 0; x < k_TileWidth; x++)
+        {
+          tile->setValue(y * k_TileWidth + x, texture[(originY + y) * textureWidth + originX + x]);
+        }
+      }
+      tiles.push_back(tile);
+    }
+    return tiles;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FloatArrayType::Pointer FindGlobalOrigins(size_t numXtiles, size_t numYtiles, const std::vector<FloatArrayType::Pointer>& tiles)
+  {
+    AbstractFilter::Pointer filter = AbstractFilter::New();
+    const SizeVec3Type udims(k_TileWidth, k_TileHeight, 1);
+    const FloatVec3Type origin(0.0f, 0.0f, 0.0f);
+    const FloatVec3Type spacing(1.0f, 1.0f, 1.0f);
+    const std::vector<QString> dataContainerNames(tiles.size());
+    return DetermineStitching::FindGlobalOrigins<float, 3>(filter.get(), static_cast<int>(numXtiles), static_cast<int>(numYtiles), 0, k_OverlapPercent, DetermineStitching::PlacementMethod::Chained,
+                                                           false, 1, tiles, udims, origin, spacing, dataContainerNames);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestFindGlobalOriginsConcurrentPairs()
+  {
+    const size_t numXtiles = 3;
+    const size_t numYtiles = 2;
+    const std::vector<FloatArrayType::Pointer> tiles = CreateTiles(numXtiles, numYtiles, std::vector<int>(2 * numXtiles * numYtiles, 0));
+
+    // One pair at a time
+    const int maximumNumberOfThreads = ITKExecutionPolicy::GetMaximumNumberOfThreads();
+    ITKExecutionPolicy::SetMaximumNumberOfThreads(1);
+    FloatArrayType::Pointer sequential = FindGlobalOrigins(numXtiles, numYtiles, tiles);
+    ITKExecutionPolicy::SetMaximumNumberOfThreads(maximumNumberOfThreads);
+
+    // As many pairs at once as there are threads
+    FloatArrayType::Pointer concurrent = FindGlobalOrigins(numXtiles, numYtiles, tiles);
+
+    DREAM3D_REQUIRE_EQUAL(sequential->getNumberOfTuples(), numXtiles * numYtiles);
+    DREAM3D_REQUIRE_EQUAL(concurrent->getNumberOfTuples(), numXtiles * numYtiles);
+    for(size_t i = 0; i < 2 * numXtiles * numYtiles; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(sequential->getValue(i), concurrent->getValue(i));
+    }
+
+    // The tiles lie on the nominal grid
+    const float stepX = k_TileWidth - k_TileWidth * k_OverlapPercent / 100.0f;
+    const float stepY = k_TileHeight - k_TileHeight * k_OverlapPercent / 100.0f;
+    for(size_t i = 0; i < numXtiles * numYtiles; i++)
+    {
+      DREAM3D_REQUIRE(std::abs(concurrent->getValue(2 * i) - (i % numXtiles) * stepX) < 1.0f);
+      DREAM3D_REQUIRE(std::abs(concurrent->getValue(2 * i + 1) - (i / numXtiles) * stepY) < 1.0f);
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestMaximumConcurrentPairs()
+  {
+    const SizeVec3Type udims(512, 512, 1);
+    const int memoryBudget = ITKExecutionPolicy::GetMemoryBudget();
+
+    // The physical memory holds one pair per thread
+    ITKExecutionPolicy::SetMemoryBudget(0);
+    const uint32_t numberOfThreads = static_cast<uint32_t>(std::max(ITKExecutionPolicy::GetNumberOfThreads(), 1));
+    DREAM3D_REQUIRE_EQUAL(DetermineStitching::GetMaximumConcurrentPairs(udims, k_OverlapPercent, sizeof(float)), numberOfThreads);
+
+    // A budget smaller than one pair still lets one pair run
+    ITKExecutionPolicy::SetMemoryBudget(1);
+    DREAM3D_REQUIRE_EQUAL(DetermineStitching::GetMaximumConcurrentPairs(udims, k_OverlapPercent, sizeof(float)), 1u);
+
+    ITKExecutionPolicy::SetMemoryBudget(memoryBudget);
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief CreateGridPairs Returns the exact offsets between each tile of a 3 x 3 grid and its left and top
+   * neighbours, for tiles placed at 'origins' (x, y in comb order)
+   */
+  std::vector<DetermineStitching::TilePair> CreateGridPairs(const std::vector<float>& origins)
+  {
+    const size_t numXtiles = 3;
+    std::vector<DetermineStitching::TilePair> pairs;
+    for(size_t i = 0; i < origins.size() / 2; i++)
+    {
+      std::vector<size_t> neighbours;
+      if(i % numXtiles != 0)
+      {
+        neighbours.push_back(i - 1);
+      }
+      if(i >= numXtiles)
+      {
+        neighbours.push_back(i - numXtiles);
+      }
+      for(size_t neighbour : neighbours)
+      {
+        DetermineStitching::TilePair pair;
+        pair.Current = i;
+        pair.Neighbour = neighbour;
+        pair.X = origins[2 * i] - origins[2 * neighbour];
+        pair.Y = origins[2 * i + 1] - origins[2 * neighbour + 1];
+        pair.Weight = 0.9;
+        pairs.push_back(pair);
+      }
+    }
+    return pairs;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  float MaximumDistance(const std::vector<float>& origins, const std::vector<float>& expected)
+  {
+    float distance = 0.0f;
+    for(size_t i = 0; i < expected.size() / 2; i++)
+    {
+      distance = std::max(distance, std::hypot(origins[2 * i] - expected[2 * i], origins[2 * i + 1] - expected[2 * i + 1]));
+    }
+    return distance;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestSolvePairOffsets()
+  {
+    const std::vector<float> expected = {0.0f, 0.0f, 82.0f, 0.0f, 164.0f, 0.0f, 3.0f, 65.0f, 80.0f, 65.0f, 162.0f, 65.0f, 1.0f, 130.0f, 83.0f, 130.0f, 160.0f, 130.0f};
+    std::vector<DetermineStitching::TilePair> pairs = CreateGridPairs(expected);
+    DREAM3D_REQUIRE_EQUAL(pairs.size(), 12);
+    std::vector<float> origins;
+
+    // Consistent offsets are fitted exactly, with or without rejection
+    DREAM3D_REQUIRE(DetermineStitching::SolvePairOffsets(9, pairs, false, origins));
+    DREAM3D_REQUIRE_EQUAL(origins.size(), expected.size());
+    DREAM3D_REQUIRE(MaximumDistance(origins, expected) < 0.01f);
+    DREAM3D_REQUIRE(DetermineStitching::SolvePairOffsets(9, pairs, true, origins));
+    DREAM3D_REQUIRE(MaximumDistance(origins, expected) < 0.01f);
+
+    // One wrong offset with a weak correlation peak: the plain fit spreads the error over its neighbours, the
+    // rejection drops it and recovers the other offsets
+    pairs[5].X += 40.0;
+    pairs[5].Y -= 25.0;
+    pairs[5].Weight = 0.3;
+    DREAM3D_REQUIRE(DetermineStitching::SolvePairOffsets(9, pairs, false, origins));
+    DREAM3D_REQUIRE(MaximumDistance(origins, expected) > 5.0f);
+    DREAM3D_REQUIRE(DetermineStitching::SolvePairOffsets(9, pairs, true, origins));
+    DREAM3D_REQUIRE(MaximumDistance(origins, expected) < 0.01f);
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestSolvePairOffsetsDisconnected()
+  {
+    // The third tile has no pair
+    DetermineStitching::TilePair pair;
+    pair.Current = 1;
+    pair.Neighbour = 0;
+    pair.X = 80.0;
+    pair.Y = 1.0;
+    std::vector<float> origins;
+    DREAM3D_REQUIRE_EQUAL(DetermineStitching::SolvePairOffsets(3, {pair}, true, origins), false);
+
+    // A single tile stays at the origin
+    DREAM3D_REQUIRE(DetermineStitching::SolvePairOffsets(1, {}, true, origins));
+    DREAM3D_REQUIRE_EQUAL(origins.size(), 2);
+    DREAM3D_REQUIRE_EQUAL(origins[0], 0.0f);
+    DREAM3D_REQUIRE_EQUAL(origins[1], 0.0f);
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief CreateTilePair Cuts two 'udims' tiles out of one noise texture, the second one 'offsetX', 'offsetY'
+   * pixels from the first one
+   */
+  std::vector<FloatArrayType::Pointer> CreateTilePair(const SizeVec3Type& udims, size_t offsetX, size_t offsetY)
+  {
+    const size_t textureWidth = udims[0] + offsetX;
+    const size_t textureHeight = udims[1] + offsetY;
+    std::vector<float> texture(textureWidth * textureHeight);
+    std::mt19937 generator(5489u);
+    std::uniform_real_distribution<float> distribution(0.0f, 255.0f);
+    for(float& value : texture)
+    {
+      value = distribution(generator);
+    }
+
+    std::vector<FloatArrayType::Pointer> tiles;
+    for(size_t i = 0; i < 2; i++)
+    {
+      const size_t originX = i * offsetX;
+      const size_t originY = i * offsetY;
+      FloatArrayType::Pointer tile = FloatArrayType::CreateArray(udims[0] * udims[1], QString("Tile %1").arg(i), true);
+      for(size_t y = 0; y < udims[1]; y++)
+      {
+        for(size_t x = 0; x < udims[0]; x++)
+        {
+          tile->setValue(y * udims[0] + x, texture[(originY + y) * textureWidth + originX + x]);
+        }
+      }
+      tiles.push_back(tile);
+    }
+    return tiles;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestCoarseToFineCrossCorrelate()
+  {
+    // Tiles large enough for a coarse registration of the overlap windows
+    const SizeVec3Type udims(320, 240, 1);
+    const FloatVec3Type origin(0.0f, 0.0f, 0.0f);
+    const FloatVec3Type spacing(1.0f, 1.0f, 1.0f);
+    const float overlapPercent = 25.0f;
+    const std::vector<float> leftCropSpecs = DetermineStitching::GetLeftCropSpecs(udims, overlapPercent);
+    const std::vector<float> topCropSpecs = DetermineStitching::GetTopCropSpecs(udims, overlapPercent);
+
+    // Offsets of the current tile that are not multiples of the coarse factor
+    const std::vector<size_t> jitters = {0, 3, 5, 6, 10};
+    for(size_t jitter : jitters)
+    {
+      std::vector<FloatArrayType::Pointer> leftPair = CreateTilePair(udims, 240 - 5 + jitter, 7 - jitter / 2);
+      std::vector<float> full = DetermineStitching::CorrelateTiles<float, 3>(leftCropSpecs, leftPair[1], leftPair[0], udims, origin, spacing, 1);
+      for(unsigned int coarseFactor : {2u, 4u})
+      {
+        std::vector<float> coarseToFine = DetermineStitching::CorrelateTiles<float, 3>(leftCropSpecs, leftPair[1], leftPair[0], udims, origin, spacing, coarseFactor);
+        DREAM3D_REQUIRE_EQUAL(coarseToFine[0], full[0]);
+        DREAM3D_REQUIRE_EQUAL(coarseToFine[1], full[1]);
+      }
+
+      std::vector<FloatArrayType::Pointer> topPair = CreateTilePair(udims, 6 - jitter / 2, 180 - 5 + jitter);
+      full = DetermineStitching::CorrelateTiles<float, 3>(topCropSpecs, topPair[1], topPair[0], udims, origin, spacing, 1);
+      for(unsigned int coarseFactor : {2u, 4u})
+      {
+        std::vector<float> coarseToFine = DetermineStitching::CorrelateTiles<float, 3>(topCropSpecs, topPair[1], topPair[0], udims, origin, spacing, coarseFactor);
+        DREAM3D_REQUIRE_EQUAL(coarseToFine[0], full[0]);
+        DREAM3D_REQUIRE_EQUAL(coarseToFine[1], full[1]);
+      }
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestCreatePairBatches()
+  {
+    // Even and odd sizes, single rows and columns
+    const std::vector<std::pair<size_t, size_t>> grids = {{1, 1}, {2, 1}, {1, 3}, {2, 2}, {3, 3}, {4, 3}, {5, 4}, {7, 2}};
+    for(const auto& grid : grids)
+    {
+      const size_t numCols = grid.first;
+      const size_t numRows = grid.second;
+      const std::array<std::vector<DetermineStitching::TilePair>, 4> batches = DetermineStitching::CreatePairBatches(numCols, numRows);
+
+      std::vector<int> horizontalCount(numCols * numRows, 0);
+      std::vector<int> verticalCount(numCols * numRows, 0);
+      for(size_t b = 0; b < batches.size(); b++)
+      {
+        // No tile is read by two pairs of the same batch
+        std::vector<int> tileUse(numCols * numRows, 0);
+        for(const DetermineStitching::TilePair& pair : batches[b])
+        {
+          DREAM3D_REQUIRE(pair.Current < numCols * numRows);
+          DREAM3D_REQUIRE_EQUAL(tileUse[pair.Current]++, 0);
+          DREAM3D_REQUIRE_EQUAL(tileUse[pair.Neighbour]++, 0);
+
+          const size_t col = pair.Neighbour % numCols;
+          const size_t row = pair.Neighbour / numCols;
+          if(b < 2)
+          {
+            // Horizontal pairs start on even columns, then on odd columns
+            DREAM3D_REQUIRE_EQUAL(pair.Current, pair.Neighbour + 1);
+            DREAM3D_REQUIRE(col + 1 < numCols);
+            DREAM3D_REQUIRE_EQUAL(col % 2, b);
+            horizontalCount[pair.Neighbour]++;
+          }
+          else
+          {
+            // Vertical pairs start on even rows, then on odd rows
+            DREAM3D_REQUIRE_EQUAL(pair.Current, pair.Neighbour + numCols);
+            DREAM3D_REQUIRE(row + 1 < numRows);
+            DREAM3D_REQUIRE_EQUAL(row % 2, b - 2);
+            verticalCount[pair.Neighbour]++;
+          }
+        }
+      }
+
+      // Every pair of neighbouring tiles is registered exactly once
+      for(size_t row = 0; row < numRows; row++)
+      {
+        for(size_t col = 0; col < numCols; col++)
+        {
+          const size_t tile = row * numCols + col;
+          DREAM3D_REQUIRE_EQUAL(horizontalCount[tile], col + 1 < numCols ? 1 : 0);
+          DREAM3D_REQUIRE_EQUAL(verticalCount[tile], row + 1 < numRows ? 1 : 0);
+        }
+      }
+      const size_t pairCount = batches[0].size() + batches[1].size() + batches[2].size() + batches[3].size();
+      DREAM3D_REQUIRE_EQUAL(pairCount, (numCols - 1) * numRows + numCols * (numRows - 1));
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "---------------- DetermineStitchingTest ---------------------" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestFindGlobalOriginsConcurrentPairs())
+    DREAM3D_REGISTER_TEST(TestMaximumConcurrentPairs())
+    DREAM3D_REGISTER_TEST(TestSolvePairOffsets())
+    DREAM3D_REGISTER_TEST(TestSolvePairOffsetsDisconnected())
+    DREAM3D_REGISTER_TEST(TestCreatePairBatches())
+    DREAM3D_REGISTER_TEST(TestCoarseToFineCrossCorrelate())
+  }
+
+private:
+};
@@ -0,0 +1,165 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+#pragma once
+
+#include <atomic>
+
+#include <vnl/vnl_cost_function.h>
+#include <vnl/vnl_vector.h>
+
+#include "SIMPLib/SIMPLib.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/FFTAmoeba.h"
+
+class FFTAmoebaTest
+{
+
+public:
+  FFTAmoebaTest() = default;
+  ~FFTAmoebaTest() = default;
+  FFTAmoebaTest(const FFTAmoebaTest&) = delete;            // Copy Constructor
+  FFTAmoebaTest(FFTAmoebaTest&&) = delete;                 // Move Constructor
+  FFTAmoebaTest& operator=(const FFTAmoebaTest&) = delete; // Copy Assignment
+  FFTAmoebaTest& operator=(FFTAmoebaTest&&) = delete;      // Move Assignment
+
+  /**
+   * @brief The Rosenbrock class is the extended Rosenbrock function, whose minimum 0 is at (1, ..., 1). It counts
+   * its evaluations and can be called from several threads.
+   */
+  class Rosenbrock : public vnl_cost_function
+  {
+  public:
+    Rosenbrock(int numberOfUnknowns)
+    : vnl_cost_function(numberOfUnknowns)
+    {
+    }
+
+    double f(const vnl_vector<double>& x) override
+    {
+      m_Evaluations++;
+      double value = 0.0;
+      for(unsigned i = 0; i + 1 < x.size(); i++)
+      {
+        const double a = x[i + 1] - x[i] * x[i];
+        const double b = 1.0 - x[i];
+        value += 100.0 * a * a + b * b;
+      }
+      return value;
+    }
+
+    int getEvaluations() const
+    {
+      return m_Evaluations;
+    }
+
+  private:
+    std::atomic<int> m_Evaluations{0};
+  };
+
+  const int k_NumberOfUnknowns = 4;
+  const int k_MaxIterations = 1500;
+
+  struct Result
+  {
+    vnl_vector<double> X;
+    double EndError = 0.0;
+    int NumEvaluations = 0;
+    int CostEvaluations = 0;
+  };
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  Result Minimize(bool parallelEvaluation, int numberOfStarts, int maxIterations)
+  {
+    Rosenbrock rosenbrock(k_NumberOfUnknowns);
+    fft_amoeba amoeba(rosenbrock);
+    amoeba.set_max_iterations(maxIterations);
+    amoeba.set_f_tolerance(1e-10);
+    amoeba.set_parallel_evaluation(parallelEvaluation);
+    amoeba.set_number_of_starts(numberOfStarts);
+
+    Result result;
+    result.X.set_size(k_NumberOfUnknowns);
+    vnl_vector<double> dx(k_NumberOfUnknowns, 0.1);
+    for(int i = 0; i < k_NumberOfUnknowns; i++)
+    {
+      result.X[i] = (i % 2 == 0) ? -1.2 : 1.0;
+    }
+    amoeba.minimize(result.X, dx);
+    result.EndError = amoeba.get_end_error();
+    result.NumEvaluations = amoeba.get_num_evaluations();
+    result.CostEvaluations = rosenbrock.getEvaluations();
+    return result;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestParallelEvaluation()
+  {
+    const Result sequential = Minimize(false, 1, k_MaxIterations);
+    const Result parallel = Minimize(true, 1, k_MaxIterations);
+
+    // The simplex moved towards the minimum
+    DREAM3D_REQUIRE(sequential.EndError < 1.0)
+    DREAM3D_REQUIRED(sequential.NumEvaluations, >, 0)
+
+    // The parallel steps make the decisions of the sequential ones on the same values, and count only the evaluations
+    // a sequential step would have made
+    DREAM3D_REQUIRE(parallel.X == sequential.X)
+    DREAM3D_REQUIRE_EQUAL(parallel.EndError, sequential.EndError)
+    DREAM3D_REQUIRE_EQUAL(parallel.NumEvaluations, sequential.NumEvaluations)
+
+    // The initial corners are evaluated but not counted
+    DREAM3D_REQUIRE_EQUAL(sequential.CostEvaluations, sequential.NumEvaluations + k_NumberOfUnknowns + 1)
+    DREAM3D_REQUIRED(parallel.CostEvaluations, >=, sequential.CostEvaluations)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestMultiStart()
+  {
+    const int numberOfStarts = 3;
+    const Result multiStart = Minimize(false, numberOfStarts, k_MaxIterations);
+
+    // The reported evaluations are those of all the starts. The iterations are shared between the starts, and the
+    // last step of each start may go up to k_NumberOfUnknowns + 1 evaluations past its share.
+    DREAM3D_REQUIRE_EQUAL(multiStart.CostEvaluations, multiStart.NumEvaluations + numberOfStarts * (k_NumberOfUnknowns + 1))
+    DREAM3D_REQUIRED(multiStart.NumEvaluations, <=, k_MaxIterations + numberOfStarts * (k_NumberOfUnknowns + 1))
+
+    // The first start is the simplex of a single start run with its share of the iterations
+    const Result firstStart = Minimize(false, 1, k_MaxIterations / numberOfStarts);
+    DREAM3D_REQUIRED(multiStart.EndError, <=, firstStart.EndError)
+
+    // The other starts are drawn with a fixed seed
+    const Result repeated = Minimize(false, numberOfStarts, k_MaxIterations);
+    DREAM3D_REQUIRE(repeated.X == multiStart.X)
+    DREAM3D_REQUIRE_EQUAL(repeated.NumEvaluations, multiStart.NumEvaluations)
+
+    // Evaluating the points of each step in parallel does not change the result either
+    const Result parallel = Minimize(true, numberOfStarts, k_MaxIterations);
+    DREAM3D_REQUIRE(parallel.X == multiStart.X)
+    DREAM3D_REQUIRE_EQUAL(parallel.NumEvaluations, multiStart.NumEvaluations)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "---------------- FFTAmoebaTest ---------------------" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestParallelEvaluation())
+    DREAM3D_REGISTER_TEST(TestMultiStart())
+  }
+
+private:
+};
@@ -0,0 +1,233 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+#pragma once
+
+#include <cmath>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Montages/GridMontage.h"
+#include "SIMPLib/Utilities/ParallelTaskAlgorithm.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/FFTConvolutionCostFunction.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/FFTDewarpHelper.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/ITKExecutionPolicy.h"
+
+class FFTConvolutionCostFunctionTest
+{
+
+public:
+  FFTConvolutionCostFunctionTest() = default;
+  ~FFTConvolutionCostFunctionTest() = default;
+  FFTConvolutionCostFunctionTest(const FFTConvolutionCostFunctionTest&) = delete;            // Copy Constructor
+  FFTConvolutionCostFunctionTest(FFTConvolutionCostFunctionTest&&) = delete;                 // Move Constructor
+  FFTConvolutionCostFunctionTest& operator=(const FFTConvolutionCostFunctionTest&) = delete; // Copy Assignment
+  FFTConvolutionCostFunctionTest& operator=(FFTConvolutionCostFunctionTest&&) = delete;      // Move Assignment
+
+  const size_t k_Rows = 2;
+  const size_t k_Cols = 3;
+  const size_t k_TileWidth = 48;
+  const size_t k_TileHeight = 40;
+  const size_t k_Overlap = 8;
+  const QString k_MontageName = QString("Grid Montage");
+  const QString k_TileData = QString("Tile Data");
+  const QString k_Image = QString("Image");
+
+  using ParametersType = FFTConvolutionCostFunction::ParametersType;
+  using MeasureType = FFTConvolutionCostFunction::MeasureType;
+
+  // -----------------------------------------------------------------------------
+  // Tiles of one textured grayscale image, each overlapping its neighbours by k_Overlap pixels
+  // -----------------------------------------------------------------------------
+  GridMontage::Pointer CreateMontage(const DataContainerArray::Pointer& dca)
+  {
+    GridMontage::Pointer montage = GridMontage::New(k_MontageName, k_Rows, k_Cols);
+    for(size_t row = 0; row < k_Rows; row++)
+    {
+      for(size_t col = 0; col < k_Cols; col++)
+      {
+        const size_t xOrigin = col * (k_TileWidth - k_Overlap);
+        const size_t yOrigin = row * (k_TileHeight - k_Overlap);
+
+        DataContainer::Pointer dc = DataContainer::New(QString("Tile_r%1c%2").arg(row).arg(col));
+        ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+        std::vector<size_t> dims = {k_TileWidth, k_TileHeight, 1};
+        image->setDimensions(dims.data());
+        image->setOrigin(FloatVec3Type(static_cast<float>(xOrigin), static_cast<float>(yOrigin), 0.0f));
+        image->setSpacing(FloatVec3Type(1.0f, 1.0f, 1.0f));
+        dc->setGeometry(image);
+        AttributeMatrix::Pointer am = dc->createAndAddAttributeMatrix(dims, k_TileData, AttributeMatrix::Type::Cell);
+        UInt8ArrayType::Pointer data = UInt8ArrayType::CreateArray(dims, std::vector<size_t>(1, 1), k_Image, true);
+        for(size_t y = 0; y < k_TileHeight; y++)
+        {
+          for(size_t x = 0; x < k_TileWidth; x++)
+          {
+            const double gx = static_cast<double>(xOrigin + x);
+            const double gy = static_cast<double>(yOrigin + y);
+            const double value = 128.0 + 60.0 * std::sin(gx * 0.21) * std::cos(gy * 0.17) + 30.0 * std::sin((gx + 2.0 * gy) * 0.05);
+            data->setValue(y * k_TileWidth + x, static_cast<uint8_t>(value));
+          }
+        }
+        am->insertOrAssign(data);
+        dca->addOrReplaceDataContainer(dc);
+        montage->setDataContainer(montage->getTileIndex(row, col), dc);
+      }
+    }
+    dca->addOrReplaceMontage(montage);
+    return montage;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FFTConvolutionCostFunction::Pointer CreateCostFunction(const DataContainerArray::Pointer& dca, const GridMontage::Pointer& montage)
+  {
+    FFTConvolutionCostFunction::Pointer costFunction = FFTConvolutionCostFunction::New();
+    costFunction->Initialize(montage, dca, k_TileData, k_Image);
+    return costFunction;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  ParametersType CreateParameters(const std::vector<double>& values)
+  {
+    ParametersType parameters(FFTDewarpHelper::getReqParameterSize());
+    for(size_t i = 0; i < values.size(); i++)
+    {
+      parameters[i] = values[i];
+    }
+    return parameters;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  ParametersType CreateIdentityParameters()
+  {
+    return CreateParameters({1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 0.0});
+  }
+
+  // -----------------------------------------------------------------------------
+  // A warp of the size found for EBSD scans, which moves some pixels of the overlaps out of the tiles and crops the
+  // overlap images
+  // -----------------------------------------------------------------------------
+  ParametersType CreateWarpParameters()
+  {
+    return CreateParameters({1.008, 0.011, 2.4e-5, -9.0e-7, 2.8e-5, -3.6e-8, -3.3e-8, -0.0144, 1.011, -2.0e-6, 3.4e-5, -7.3e-5, -3.9e-8, -4.7e-8});
+  }
+
+  // -----------------------------------------------------------------------------
+  // The FFT plans are made again for each evaluation and may pick other codelets depending on the alignment of the
+  // buffers, so the values are compared with a relative tolerance of 1e-12 instead of bit for bit.
+  // -----------------------------------------------------------------------------
+  void RequireSameValue(MeasureType value, MeasureType expected)
+  {
+    DREAM3D_REQUIRE(expected > 0.0)
+    DREAM3D_REQUIRED(std::abs(value - expected), <=, 1.0e-12 * expected)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestValueWithReusedBuffers()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    GridMontage::Pointer montage = CreateMontage(dca);
+
+    const ParametersType identity = CreateIdentityParameters();
+    const ParametersType warp = CreateWarpParameters();
+
+    // Each value evaluated by a cost function that has no buffers yet
+    const MeasureType freshIdentity = CreateCostFunction(dca, montage)->GetValue(identity);
+    const MeasureType freshWarp = CreateCostFunction(dca, montage)->GetValue(warp);
+    DREAM3D_REQUIRE(freshIdentity != freshWarp)
+
+    // The same values evaluated alternately with the buffers of the previous evaluations, whose overlap images were
+    // cropped differently
+    FFTConvolutionCostFunction::Pointer costFunction = CreateCostFunction(dca, montage);
+    for(size_t i = 0; i < 3; i++)
+    {
+      RequireSameValue(costFunction->GetValue(identity), freshIdentity);
+      RequireSameValue(costFunction->GetValue(warp), freshWarp);
+    }
+
+    // Concurrent evaluations each take their own buffers
+    std::vector<MeasureType> values(8, 0.0);
+    ParallelTaskAlgorithm taskAlg;
+    for(size_t i = 0; i < values.size(); i++)
+    {
+      const ParametersType& parameters = (i % 2 == 0) ? identity : warp;
+      MeasureType& value = values[i];
+      taskAlg.execute([costFunction, &parameters, &value]() { value = costFunction->GetValue(parameters); });
+    }
+    taskAlg.wait();
+    for(size_t i = 0; i < values.size(); i++)
+    {
+      RequireSameValue(values[i], (i % 2 == 0) ? freshIdentity : freshWarp);
+    }
+
+    // Initialize drops the buffers of the previous overlaps
+    costFunction->Initialize(montage, dca, k_TileData, k_Image);
+    RequireSameValue(costFunction->GetValue(warp), freshWarp);
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestValueAcrossThreadCounts()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    GridMontage::Pointer montage = CreateMontage(dca);
+    const std::vector<ParametersType> parameters = {CreateIdentityParameters(), CreateWarpParameters()};
+
+    // One cost function evaluates at every thread count, so only the order in which the overlap tasks finish changes.
+    // The maximum of each overlap is summed in the overlap order after the tasks, but the FFT of each overlap is still
+    // planned again on every evaluation, so the values are compared with the same tolerance as above.
+    const int previousMaximumNumberOfThreads = ITKExecutionPolicy::GetMaximumNumberOfThreads();
+    ITKExecutionPolicy::SetMaximumNumberOfThreads(1);
+    ITKExecutionPolicy::Apply();
+    FFTConvolutionCostFunction::Pointer costFunction = CreateCostFunction(dca, montage);
+    std::vector<MeasureType> expected;
+    for(const ParametersType& parameter : parameters)
+    {
+      expected.push_back(costFunction->GetValue(parameter));
+    }
+
+    for(int numberOfThreads : {2, 3, 0})
+    {
+      ITKExecutionPolicy::SetMaximumNumberOfThreads(numberOfThreads);
+      ITKExecutionPolicy::Apply();
+      for(size_t i = 0; i < parameters.size(); i++)
+      {
+        RequireSameValue(costFunction->GetValue(parameters[i]), expected[i]);
+      }
+    }
+
+    ITKExecutionPolicy::SetMaximumNumberOfThreads(previousMaximumNumberOfThreads);
+    ITKExecutionPolicy::Apply();
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "---------------- FFTConvolutionCostFunctionTest ---------------------" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestValueWithReusedBuffers())
+    DREAM3D_REGISTER_TEST(TestValueAcrossThreadCounts())
+  }
+
+private:
+};
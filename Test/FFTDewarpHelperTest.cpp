@@ -0,0 +1,131 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/FFTDewarpHelper.h"
+
+class FFTDewarpHelperTest
+{
+
+public:
+  FFTDewarpHelperTest() = default;
+  ~FFTDewarpHelperTest() = default;
+  FFTDewarpHelperTest(const FFTDewarpHelperTest&) = delete;            // Copy Constructor
+  FFTDewarpHelperTest(FFTDewarpHelperTest&&) = delete;                 // Move Constructor
+  FFTDewarpHelperTest& operator=(const FFTDewarpHelperTest&) = delete; // Copy Assignment
+  FFTDewarpHelperTest& operator=(FFTDewarpHelperTest&&) = delete;      // Move Assignment
+
+  const size_t k_Width = 61;
+  const size_t k_Height = 47;
+  const size_t k_NumComps = 3;
+  const uint16_t k_InitValue = 0;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FFTDewarpHelper::ParametersType CreateParameters(const std::vector<double>& values)
+  {
+    FFTDewarpHelper::ParametersType parameters(FFTDewarpHelper::getReqParameterSize());
+    for(size_t i = 0; i < values.size(); i++)
+    {
+      parameters[i] = values[i];
+    }
+    return parameters;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Moves each tuple on its own, the way ApplyDewarpParameters did before the index map
+  // -----------------------------------------------------------------------------
+  std::vector<uint16_t> TransformPerPixel(const FFTDewarpHelper::ParametersType& parameters, const FFTDewarpHelper::PixelIndex& offset, const std::vector<uint16_t>& source)
+  {
+    std::vector<uint16_t> destination(source.size());
+    for(size_t y = 0; y < k_Height; y++)
+    {
+      for(size_t x = 0; x < k_Width; x++)
+      {
+        const size_t newIndex = y * k_Width + x;
+        const FFTDewarpHelper::PixelIndex oldPixelIndex = FFTDewarpHelper::getOldIndex(FFTDewarpHelper::pixelIndex(x, y), offset, parameters);
+        const bool inside = oldPixelIndex[0] >= 0 && oldPixelIndex[1] >= 0 && oldPixelIndex[0] < static_cast<int64_t>(k_Width) && oldPixelIndex[1] < static_cast<int64_t>(k_Height);
+        for(size_t comp = 0; comp < k_NumComps; comp++)
+        {
+          destination[newIndex * k_NumComps + comp] = inside ? source[(oldPixelIndex[1] * k_Width + oldPixelIndex[0]) * k_NumComps + comp] : k_InitValue;
+        }
+      }
+    }
+    return destination;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RequireGatherMatchesPerPixel(const FFTDewarpHelper::ParametersType& parameters, const FFTDewarpHelper::PixelIndex& offset, bool expectOutside)
+  {
+    std::vector<uint16_t> source(k_Width * k_Height * k_NumComps);
+    for(size_t i = 0; i < source.size(); i++)
+    {
+      source[i] = static_cast<uint16_t>(1 + (i * 7919) % 65521);
+    }
+    const std::vector<uint16_t> expected = TransformPerPixel(parameters, offset, source);
+
+    FFTDewarpHelper::IndexMap indexMap = FFTDewarpHelper::createIndexMap(parameters, k_Width, k_Height, offset);
+    DREAM3D_REQUIRE_EQUAL(indexMap.Width, k_Width)
+    DREAM3D_REQUIRE_EQUAL(indexMap.Height, k_Height)
+    DREAM3D_REQUIRE_EQUAL(indexMap.CompactIndices.size(), k_Width * k_Height)
+    DREAM3D_REQUIRE(indexMap.Indices.empty())
+    const bool hasOutside = std::find(indexMap.CompactIndices.begin(), indexMap.CompactIndices.end(), -1) != indexMap.CompactIndices.end();
+    DREAM3D_REQUIRE_EQUAL(hasOutside, expectOutside)
+
+    std::vector<uint16_t> destination(source.size());
+    FFTDewarpHelper::gatherTuples<uint16_t>(indexMap, source.data(), destination.data(), k_NumComps, k_InitValue);
+    DREAM3D_REQUIRE(destination == expected)
+
+    // The same map stored on 64 bits, as for tiles of 2^31 pixels or more
+    indexMap.Indices.assign(indexMap.CompactIndices.begin(), indexMap.CompactIndices.end());
+    indexMap.CompactIndices.clear();
+    std::fill(destination.begin(), destination.end(), 0);
+    FFTDewarpHelper::gatherTuples<uint16_t>(indexMap, source.data(), destination.data(), k_NumComps, k_InitValue);
+    DREAM3D_REQUIRE(destination == expected)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestGatherTuples()
+  {
+    const FFTDewarpHelper::PixelIndex center = FFTDewarpHelper::pixelIndex((k_Width - 1) / 2.0, (k_Height - 1) / 2.0);
+
+    // Identity
+    FFTDewarpHelper::ParametersType identity = CreateParameters({1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 0.0});
+    RequireGatherMatchesPerPixel(identity, center, false);
+
+    // A warp using every term of the polynomial, which reads pixels from outside of the tile near the borders
+    FFTDewarpHelper::ParametersType warp =
+        CreateParameters({1.04, 0.02, 1.5e-3, -2.0e-3, 3.0e-3, 4.0e-5, -3.0e-5, -0.015, 1.06, -1.0e-3, 2.5e-3, 1.0e-3, -2.0e-5, 5.0e-5});
+    RequireGatherMatchesPerPixel(warp, center, true);
+
+    // The same warp around an offset that is not the center of the tile
+    RequireGatherMatchesPerPixel(warp, FFTDewarpHelper::pixelIndex(static_cast<int64_t>(k_Width) - 5, int64_t(3)), true);
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "---------------- FFTDewarpHelperTest ---------------------" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestGatherTuples())
+  }
+
+private:
+};
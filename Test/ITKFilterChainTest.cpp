@@ -0,0 +1,165 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QStringList>
+
+#include "ITKTestBase.h"
+
+class ITKFilterChainTest : public ITKTestBase
+{
+
+public:
+  ITKFilterChainTest() = default;
+  ~ITKFilterChainTest() override = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QString WritePipelineFile(const QString& filename, const QStringList& filterNames)
+  {
+    // Only the filter names are written, every filter is read with its default parameters
+    QJsonObject root;
+    for(int i = 0; i < filterNames.size(); i++)
+    {
+      QJsonObject filterObject;
+      filterObject["Filter_Name"] = filterNames[i];
+      filterObject["Filter_Human_Label"] = filterNames[i];
+      filterObject["Filter_Enabled"] = true;
+      root[QString::number(i)] = filterObject;
+    }
+    QJsonObject builder;
+    builder["Name"] = filename;
+    builder["Number_Filters"] = filterNames.size();
+    builder["Version"] = 6;
+    root["PipelineBuilder"] = builder;
+
+    QString fileWithPath = UnitTest::TestTempDir + QString("/") + filename;
+    QFile file(fileWithPath);
+    DREAM3D_REQUIRE_EQUAL(file.open(QIODevice::WriteOnly), true);
+    file.write(QJsonDocument(root).toJson());
+    file.close();
+    FilesToRemove << fileWithPath;
+    return fileWithPath;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  AbstractFilter::Pointer CreateChain(const DataContainerArray::Pointer& containerArray, const QString& pipelineFile, const DataArrayPath& inputPath, const QString& outputName)
+  {
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName("ITKFilterChain");
+    DREAM3D_REQUIRE_NE(filterFactory.get(), 0);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    bool propWasSet;
+    var.setValue(pipelineFile);
+    propWasSet = filter->setProperty("PipelineFile", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(inputPath);
+    propWasSet = filter->setProperty("SelectedCellArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(outputName);
+    propWasSet = filter->setProperty("NewCellArrayName", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    filter->setDataContainerArray(containerArray);
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int RunFilter(const DataContainerArray::Pointer& containerArray, const QString& filtName, const DataArrayPath& inputPath, const QString& outputName)
+  {
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    DREAM3D_REQUIRE_NE(filterFactory.get(), 0);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    bool propWasSet;
+    var.setValue(inputPath);
+    propWasSet = filter->setProperty("SelectedCellArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(outputName);
+    propWasSet = filter->setProperty("NewCellArrayName", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0);
+    return 0;
+  }
+
+  int TestITKFilterChainMatchesFiltersTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Float.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    QString outputName = "TestAttributeArrayName_Output";
+    DataArrayPath output_path("TestContainer", "TestAttributeMatrixName", outputName);
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+
+    QString pipelineFile = WritePipelineFile("ITKFilterChainTest_MedianAbs.json", {"ITKMedianImage", "ITKAbsImage"});
+    AbstractFilter::Pointer chain = CreateChain(containerArray, pipelineFile, input_path, outputName);
+    chain->execute();
+    DREAM3D_REQUIRED(chain->getErrorCode(), >=, 0);
+    DREAM3D_REQUIRED(chain->getWarningCode(), >=, 0);
+    // The intermediate output of the median filter is not kept
+    DREAM3D_REQUIRE_EQUAL(containerArray->getAttributeMatrix(input_path)->getNumAttributeArrays(), 2);
+
+    // The same filters run one after the other
+    DataArrayPath median_path("TestContainer", "TestAttributeMatrixName", "Median");
+    DataArrayPath baseline_path("TestContainer", "TestAttributeMatrixName", "Baseline");
+    RunFilter(containerArray, "ITKMedianImage", input_path, median_path.getDataArrayName());
+    RunFilter(containerArray, "ITKAbsImage", median_path, baseline_path.getDataArrayName());
+
+    int res = this->CompareImages(containerArray, output_path, baseline_path, 0.0);
+    DREAM3D_REQUIRE_EQUAL(res, 0);
+    return 0;
+  }
+
+  int TestITKFilterChainAdditionalInputsTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Float.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    QString outputName = "TestAttributeArrayName_Output";
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+
+    // The reference, moving, marker and mask images of these filters are not connected by the chain
+    const QStringList filterNames = {"ITKHistogramMatchingImage", "ITKFFTNormalizedCorrelationImage", "ITKMorphologicalWatershedFromMarkersImage", "ITKMaskImage"};
+    for(const QString& filterName : filterNames)
+    {
+      QString pipelineFile = WritePipelineFile(QString("ITKFilterChainTest_%1.json").arg(filterName), {"ITKMedianImage", filterName});
+      AbstractFilter::Pointer chain = CreateChain(containerArray, pipelineFile, input_path, outputName);
+      chain->execute();
+      DREAM3D_REQUIRE_EQUAL(chain->getErrorCode(), -55588);
+      DREAM3D_REQUIRE_EQUAL(containerArray->getAttributeMatrix(input_path)->doesAttributeArrayExist(outputName), false);
+    }
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()() override
+  {
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(this->TestFilterAvailability("ITKFilterChain"));
+
+    DREAM3D_REGISTER_TEST(TestITKFilterChainMatchesFiltersTest());
+    DREAM3D_REGISTER_TEST(TestITKFilterChainAdditionalInputsTest());
+
+    if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
+    {
+      DREAM3D_REGISTER_TEST(this->RemoveTestFiles())
+    }
+  }
+
+private:
+  ITKFilterChainTest(const ITKFilterChainTest&); // Copy Constructor Not Implemented
+  void operator=(const ITKFilterChainTest&);     // Move assignment Not Implemented
+};
@@ -0,0 +1,178 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include <QtCore/QDir>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QStringList>
+#include <QtCore/QTextStream>
+
+#include "ITKTestBase.h"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/ITKFilterTelemetry.h"
+
+class ITKFilterTelemetryTest : public ITKTestBase
+{
+
+public:
+  ITKFilterTelemetryTest() = default;
+  ~ITKFilterTelemetryTest() override = default;
+
+  const QString k_FilterName = QString("ITKGradientMagnitudeImage");
+
+  // -----------------------------------------------------------------------------
+  // Runs the filter once on the test image with 'sinkFile' as the telemetry sink, returns the number of voxels
+  // -----------------------------------------------------------------------------
+  size_t ExecuteFilter(const QString& sinkFile, const QString& outputName)
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Float.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(k_FilterName);
+    DREAM3D_REQUIRE_NE(filterFactory.get(), 0);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    var.setValue(input_path);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("SelectedCellArrayPath", var), true);
+    var.setValue(outputName);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("NewCellArrayName", var), true);
+    filter->setDataContainerArray(containerArray);
+
+    ITKFilterTelemetry::SetSinkFile(sinkFile);
+    filter->execute();
+    ITKFilterTelemetry::SetSinkFile(QString());
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCode(), >=, 0);
+    return containerArray->getAttributeMatrix(input_path)->getNumberOfTuples();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QString GetSinkFilePath(const QString& extension)
+  {
+    QDir().mkpath(UnitTest::TestTempDir);
+    QString filePath = UnitTest::TestTempDir + QString("/ITKFilterTelemetryTest.") + extension;
+    QFile::remove(filePath);
+    FilesToRemove << filePath;
+    return filePath;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QStringList ReadLines(const QString& filePath)
+  {
+    QFile file(filePath);
+    DREAM3D_REQUIRE_EQUAL(file.open(QIODevice::ReadOnly | QIODevice::Text), true);
+    QStringList lines;
+    QTextStream in(&file);
+    while(!in.atEnd())
+    {
+      QString line = in.readLine();
+      if(!line.isEmpty())
+      {
+        lines << line;
+      }
+    }
+    return lines;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestITKFilterTelemetryJsonSinkTest()
+  {
+    const QString sinkFile = GetSinkFilePath("json");
+    const size_t numberOfVoxels = ExecuteFilter(sinkFile, "TestAttributeArrayName_First");
+    ExecuteFilter(sinkFile, "TestAttributeArrayName_Second");
+
+    // One JSON object per line, appended by each execution
+    const QStringList lines = ReadLines(sinkFile);
+    DREAM3D_REQUIRE_EQUAL(lines.size(), 2);
+    for(const QString& line : lines)
+    {
+      QJsonParseError parseError;
+      QJsonDocument document = QJsonDocument::fromJson(line.toUtf8(), &parseError);
+      DREAM3D_REQUIRE_EQUAL(parseError.error, QJsonParseError::NoError);
+      DREAM3D_REQUIRE_EQUAL(document.isObject(), true);
+      QJsonObject record = document.object();
+      DREAM3D_REQUIRE_EQUAL(record["Filter"].toString(), k_FilterName);
+      DREAM3D_REQUIRE_EQUAL(record["ErrorCode"].toInt(), 0);
+      DREAM3D_REQUIRE_EQUAL(static_cast<size_t>(record["Voxels"].toDouble()), numberOfVoxels);
+      DREAM3D_REQUIRED(record["WallTime"].toDouble(), >, 0.0);
+      DREAM3D_REQUIRED(record["CpuTime"].toDouble(), >=, 0.0);
+      DREAM3D_REQUIRED(record["PeakResidentMemory"].toDouble(), >, 0.0);
+      DREAM3D_REQUIRED(record["AllocatedBytes"].toDouble(), >, 0.0);
+      DREAM3D_REQUIRED(record["VoxelsPerSecond"].toDouble(), >, 0.0);
+
+      QStringList phaseNames;
+      for(const QJsonValue& phase : record["Phases"].toArray())
+      {
+        phaseNames << phase.toObject()["Name"].toString();
+        DREAM3D_REQUIRED(phase.toObject()["WallTime"].toDouble(), >=, 0.0);
+      }
+      DREAM3D_REQUIRE_EQUAL(phaseNames.contains("ToITK"), true);
+      DREAM3D_REQUIRE_EQUAL(phaseNames.contains("Update"), true);
+    }
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestITKFilterTelemetryCsvSinkTest()
+  {
+    const QString sinkFile = GetSinkFilePath("csv");
+    const size_t numberOfVoxels = ExecuteFilter(sinkFile, "TestAttributeArrayName_Csv");
+
+    // A header, then one row per execution
+    const QStringList lines = ReadLines(sinkFile);
+    DREAM3D_REQUIRE_EQUAL(lines.size(), 2);
+    const QStringList header = lines[0].split(',');
+    const QStringList row = lines[1].split(',');
+    DREAM3D_REQUIRE_EQUAL(header.size(), row.size());
+    DREAM3D_REQUIRE_EQUAL(row[header.indexOf("Filter")], k_FilterName);
+    DREAM3D_REQUIRE_EQUAL(row[header.indexOf("ErrorCode")].toInt(), 0);
+    DREAM3D_REQUIRE_EQUAL(row[header.indexOf("Voxels")].toULongLong(), numberOfVoxels);
+    DREAM3D_REQUIRED(row[header.indexOf("WallTime")].toDouble(), >, 0.0);
+
+    // Phases are written as Name:WallTime:CpuTime, separated by semicolons
+    QStringList phaseNames;
+    for(const QString& phase : row[header.indexOf("Phases")].split(';'))
+    {
+      const QStringList fields = phase.split(':');
+      DREAM3D_REQUIRE_EQUAL(fields.size(), 3);
+      phaseNames << fields[0];
+    }
+    DREAM3D_REQUIRE_EQUAL(phaseNames.contains("ToITK"), true);
+    DREAM3D_REQUIRE_EQUAL(phaseNames.contains("Update"), true);
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()() override
+  {
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(this->TestFilterAvailability(k_FilterName));
+
+    DREAM3D_REGISTER_TEST(TestITKFilterTelemetryJsonSinkTest());
+    DREAM3D_REGISTER_TEST(TestITKFilterTelemetryCsvSinkTest());
+
+    if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
+    {
+      DREAM3D_REGISTER_TEST(this->RemoveTestFiles())
+    }
+  }
+
+private:
+  ITKFilterTelemetryTest(const ITKFilterTelemetryTest&); // Copy Constructor Not Implemented
+  void operator=(const ITKFilterTelemetryTest&);         // Move assignment Not Implemented
+};
@@ -7,6 +7,7 @@
 #include "ITKTestBase.h"
 // Auto includes
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
 
 class ITKGradientMagnitudeImageTest : public ITKTestBase
 {
@@ -49,6 +50,285 @@ public:
     return 0;
   }
 
+  int TestITKGradientMagnitudeImagestreamedTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Float.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    QString outputName = "TestAttributeArrayName_Output";
+    DataArrayPath output_path("TestContainer", "TestAttributeMatrixName", outputName);
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    QString filtName = "ITKGradientMagnitudeImage";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    DREAM3D_REQUIRE_NE(filterFactory.get(), 0);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    bool propWasSet;
+    var.setValue(input_path);
+    propWasSet = filter->setProperty("SelectedCellArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(outputName);
+    propWasSet = filter->setProperty("NewCellArrayName", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(4);
+    propWasSet = filter->setProperty("StreamSubdivisions", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCode(), >=, 0);
+    WriteImage("ITKGradientMagnitudeImagestreamed.nrrd", containerArray, output_path);
+    QString baseline_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Baseline/BasicFilters_GradientMagnitudeImageFilter_default.nrrd");
+    DataArrayPath baseline_path("BContainer", "BAttributeMatrixName", "BAttributeArrayName");
+    this->ReadImage(baseline_filename, containerArray, baseline_path);
+    int res = this->CompareImages(containerArray, output_path, baseline_path, 1e-05);
+    DREAM3D_REQUIRE_EQUAL(res, 0);
+    return 0;
+  }
+
+  int TestITKGradientMagnitudeImageExecutionSettingsTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Float.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    QString outputName = "TestAttributeArrayName_Output";
+    DataArrayPath output_path("TestContainer", "TestAttributeMatrixName", outputName);
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    QString filtName = "ITKGradientMagnitudeImage";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    DREAM3D_REQUIRE_NE(filterFactory.get(), 0);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    bool propWasSet;
+    var.setValue(input_path);
+    propWasSet = filter->setProperty("SelectedCellArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(outputName);
+    propWasSet = filter->setProperty("NewCellArrayName", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(1);
+    propWasSet = filter->setProperty("MaximumNumberOfThreads", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(7);
+    propWasSet = filter->setProperty("NumberOfWorkUnits", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCode(), >=, 0);
+    QString baseline_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Baseline/BasicFilters_GradientMagnitudeImageFilter_default.nrrd");
+    DataArrayPath baseline_path("BContainer", "BAttributeMatrixName", "BAttributeArrayName");
+    this->ReadImage(baseline_filename, containerArray, baseline_path);
+    int res = this->CompareImages(containerArray, output_path, baseline_path, 1e-05);
+    DREAM3D_REQUIRE_EQUAL(res, 0);
+
+    // Negative settings are refused
+    var.setValue(-1);
+    propWasSet = filter->setProperty("MemoryBudget", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -55590);
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  AbstractFilter::Pointer CreateRegionOfInterestFilter(const DataArrayPath& input_path, const QString& outputName, bool saveAsNewArray, int mode)
+  {
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName("ITKGradientMagnitudeImage");
+    DREAM3D_REQUIRE_NE(filterFactory.get(), 0);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    bool propWasSet;
+    var.setValue(input_path);
+    propWasSet = filter->setProperty("SelectedCellArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(outputName);
+    propWasSet = filter->setProperty("NewCellArrayName", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(saveAsNewArray);
+    propWasSet = filter->setProperty("SaveAsNewArray", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(mode);
+    propWasSet = filter->setProperty("RegionOfInterestMode", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(k_RegionFillValue);
+    propWasSet = filter->setProperty("RegionOfInterestFillValue", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Filters the whole image into 'outputName', the reference for the regions of interest
+  // -----------------------------------------------------------------------------
+  void FilterWholeImage(const DataContainerArray::Pointer& containerArray, const DataArrayPath& input_path, const QString& outputName)
+  {
+    AbstractFilter::Pointer filter = CreateRegionOfInterestFilter(input_path, outputName, true, 0);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCode(), >=, 0);
+  }
+
+  // -----------------------------------------------------------------------------
+  // Requires the values of the whole image result inside the box and 'outside' values outside of it
+  // -----------------------------------------------------------------------------
+  void RequireRegionOfInterest(const DataContainerArray::Pointer& containerArray, const DataArrayPath& input_path, const QString& regionName, const QString& fullName,
+                               const FloatArrayType::Pointer& outsideArray, const std::array<size_t, 3>& regionIndex, const std::array<size_t, 3>& regionSize)
+  {
+    AttributeMatrix::Pointer am = containerArray->getAttributeMatrix(input_path);
+    FloatArrayType::Pointer fullArray = std::dynamic_pointer_cast<FloatArrayType>(am->getAttributeArray(fullName));
+    FloatArrayType::Pointer regionArray = std::dynamic_pointer_cast<FloatArrayType>(am->getAttributeArray(regionName));
+    DREAM3D_REQUIRE_VALID_POINTER(fullArray.get());
+    DREAM3D_REQUIRE_VALID_POINTER(regionArray.get());
+    SizeVec3Type dims = containerArray->getDataContainer(input_path.getDataContainerName())->getGeometryAs<ImageGeom>()->getDimensions();
+    size_t pixel = 0;
+    for(size_t z = 0; z < dims[2]; z++)
+    {
+      for(size_t y = 0; y < dims[1]; y++)
+      {
+        for(size_t x = 0; x < dims[0]; x++, pixel++)
+        {
+          const std::array<size_t, 3> position = {{x, y, z}};
+          bool inside = true;
+          for(size_t i = 0; i < 3; i++)
+          {
+            inside = inside && position[i] >= regionIndex[i] && position[i] < regionIndex[i] + regionSize[i];
+          }
+          const float expected = inside ? fullArray->getValue(pixel) : (nullptr == outsideArray ? static_cast<float>(k_RegionFillValue) : outsideArray->getValue(pixel));
+          DREAM3D_REQUIRE_EQUAL(regionArray->getValue(pixel), expected);
+        }
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // A box in the middle of the image, away from its borders
+  // -----------------------------------------------------------------------------
+  void GetCenteredRegion(const DataContainerArray::Pointer& containerArray, const DataArrayPath& input_path, std::array<size_t, 3>& regionIndex, std::array<size_t, 3>& regionSize)
+  {
+    SizeVec3Type dims = containerArray->getDataContainer(input_path.getDataContainerName())->getGeometryAs<ImageGeom>()->getDimensions();
+    for(size_t i = 0; i < 3; i++)
+    {
+      regionIndex[i] = dims[i] / 4;
+      regionSize[i] = std::max<size_t>(dims[i] / 2, 1);
+    }
+  }
+
+  int TestITKGradientMagnitudeImageRegionOfInterestTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Float.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    const QString fullName = "TestAttributeArrayName_Full";
+    const QString regionName = "TestAttributeArrayName_Region";
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    FilterWholeImage(containerArray, input_path, fullName);
+
+    std::array<size_t, 3> regionIndex;
+    std::array<size_t, 3> regionSize;
+    GetCenteredRegion(containerArray, input_path, regionIndex, regionSize);
+    AbstractFilter::Pointer filter = CreateRegionOfInterestFilter(input_path, regionName, true, 1);
+    QVariant var;
+    var.setValue(IntVec3Type(static_cast<int>(regionIndex[0]), static_cast<int>(regionIndex[1]), static_cast<int>(regionIndex[2])));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("RegionOfInterestIndex", var), true);
+    var.setValue(IntVec3Type(static_cast<int>(regionSize[0]), static_cast<int>(regionSize[1]), static_cast<int>(regionSize[2])));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("RegionOfInterestSize", var), true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCode(), >=, 0);
+
+    // Same result as the whole image inside the region, fill value outside
+    RequireRegionOfInterest(containerArray, input_path, regionName, fullName, FloatArrayType::NullPointer(), regionIndex, regionSize);
+    return 0;
+  }
+
+  int TestITKGradientMagnitudeImageRegionOfInterestInPlaceTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Float.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    const QString fullName = "TestAttributeArrayName_Full";
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    FilterWholeImage(containerArray, input_path, fullName);
+    AttributeMatrix::Pointer am = containerArray->getAttributeMatrix(input_path);
+    FloatArrayType::Pointer original = std::dynamic_pointer_cast<FloatArrayType>(am->getAttributeArray(input_path.getDataArrayName())->deepCopy());
+    DREAM3D_REQUIRE_VALID_POINTER(original.get());
+
+    // The input and output pixel types are the same, so the region is written into the input array in one piece
+    std::array<size_t, 3> regionIndex;
+    std::array<size_t, 3> regionSize;
+    GetCenteredRegion(containerArray, input_path, regionIndex, regionSize);
+    AbstractFilter::Pointer filter = CreateRegionOfInterestFilter(input_path, "", false, 1);
+    QVariant var;
+    var.setValue(IntVec3Type(static_cast<int>(regionIndex[0]), static_cast<int>(regionIndex[1]), static_cast<int>(regionIndex[2])));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("RegionOfInterestIndex", var), true);
+    var.setValue(IntVec3Type(static_cast<int>(regionSize[0]), static_cast<int>(regionSize[1]), static_cast<int>(regionSize[2])));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("RegionOfInterestSize", var), true);
+    var.setValue(4);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("StreamSubdivisions", var), true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCode(), >=, 0);
+
+    // Same result as the whole image inside the region, the input values outside
+    RequireRegionOfInterest(containerArray, input_path, input_path.getDataArrayName(), fullName, original, regionIndex, regionSize);
+    return 0;
+  }
+
+  int TestITKGradientMagnitudeImageRegionOfInterestMaskTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Float.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataArrayPath mask_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName_Mask");
+    const QString fullName = "TestAttributeArrayName_Full";
+    const QString regionName = "TestAttributeArrayName_Region";
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    FilterWholeImage(containerArray, input_path, fullName);
+
+    // Two pixels of the mask at opposite corners of the expected bounding box
+    std::array<size_t, 3> regionIndex;
+    std::array<size_t, 3> regionSize;
+    GetCenteredRegion(containerArray, input_path, regionIndex, regionSize);
+    SizeVec3Type dims = containerArray->getDataContainer(input_path.getDataContainerName())->getGeometryAs<ImageGeom>()->getDimensions();
+    AttributeMatrix::Pointer am = containerArray->getAttributeMatrix(input_path);
+    UInt8ArrayType::Pointer mask = UInt8ArrayType::CreateArray(am->getNumberOfTuples(), mask_path.getDataArrayName(), true);
+    mask->initializeWithZeros();
+    const size_t first = (regionIndex[2] * dims[1] + regionIndex[1]) * dims[0] + regionIndex[0];
+    const size_t last = ((regionIndex[2] + regionSize[2] - 1) * dims[1] + regionIndex[1] + regionSize[1] - 1) * dims[0] + regionIndex[0] + regionSize[0] - 1;
+    mask->setValue(first, 1);
+    mask->setValue(last, 255);
+    am->insertOrAssign(mask);
+
+    AbstractFilter::Pointer filter = CreateRegionOfInterestFilter(input_path, regionName, true, 2);
+    QVariant var;
+    var.setValue(mask_path);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("RegionOfInterestMaskArrayPath", var), true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCode(), >=, 0);
+
+    // Same result as the whole image inside the bounding box of the mask, fill value outside
+    RequireRegionOfInterest(containerArray, input_path, regionName, fullName, FloatArrayType::NullPointer(), regionIndex, regionSize);
+
+    // An empty mask has no bounding box
+    mask->initializeWithZeros();
+    filter = CreateRegionOfInterestFilter(input_path, "TestAttributeArrayName_Empty", true, 2);
+    filter->setProperty("RegionOfInterestMaskArrayPath", var);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -55574);
+    return 0;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -59,6 +339,11 @@ public:
     DREAM3D_REGISTER_TEST(this->TestFilterAvailability("ITKGradientMagnitudeImage"));
 
     DREAM3D_REGISTER_TEST(TestITKGradientMagnitudeImagedefaultTest());
+    DREAM3D_REGISTER_TEST(TestITKGradientMagnitudeImagestreamedTest());
+    DREAM3D_REGISTER_TEST(TestITKGradientMagnitudeImageExecutionSettingsTest());
+    DREAM3D_REGISTER_TEST(TestITKGradientMagnitudeImageRegionOfInterestTest());
+    DREAM3D_REGISTER_TEST(TestITKGradientMagnitudeImageRegionOfInterestInPlaceTest());
+    DREAM3D_REGISTER_TEST(TestITKGradientMagnitudeImageRegionOfInterestMaskTest());
 
     if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
     {
@@ -67,6 +352,8 @@ public:
   }
 
 private:
+  const double k_RegionFillValue = -1.0;
+
   ITKGradientMagnitudeImageTest(const ITKGradientMagnitudeImageTest&); // Copy Constructor Not Implemented
   void operator=(const ITKGradientMagnitudeImageTest&);                // Move assignment Not Implemented
 };
@@ -8,6 +8,8 @@
 // Auto includes
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 
+#include "ITKImageProcessingFilters/util/ITKExecutionPolicy.h"
+
 class ITKSignedDanielssonDistanceMapImageTest : public ITKTestBase
 {
 
@@ -49,6 +51,44 @@ public:
     return 0;
   }
 
+  int TestITKSignedDanielssonDistanceMapImageMemoryBudgetTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/2th_cthead1.png");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    QString outputName = "TestAttributeArrayName_Output";
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    QString filtName = "ITKSignedDanielssonDistanceMapImage";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    DREAM3D_REQUIRE_NE(filterFactory.get(), 0);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    bool propWasSet;
+    var.setValue(input_path);
+    propWasSet = filter->setProperty("SelectedCellArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(outputName);
+    propWasSet = filter->setProperty("NewCellArrayName", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    filter->setDataContainerArray(containerArray);
+
+    // The vector images of the filter need several MB for this 256x256 image
+    const int memoryBudget = ITKExecutionPolicy::GetMemoryBudget();
+    const bool refuseOverBudget = ITKExecutionPolicy::GetRefuseOverBudget();
+    ITKExecutionPolicy::SetMemoryBudget(1);
+    ITKExecutionPolicy::SetRefuseOverBudget(false);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), 0);
+    DREAM3D_REQUIRE_EQUAL(filter->getWarningCode(), -55571);
+    ITKExecutionPolicy::SetRefuseOverBudget(true);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -55570);
+    ITKExecutionPolicy::SetMemoryBudget(memoryBudget);
+    ITKExecutionPolicy::SetRefuseOverBudget(refuseOverBudget);
+    return 0;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -59,6 +99,7 @@ public:
     DREAM3D_REGISTER_TEST(this->TestFilterAvailability("ITKSignedDanielssonDistanceMapImage"));
 
     DREAM3D_REGISTER_TEST(TestITKSignedDanielssonDistanceMapImagedefaultTest());
+    DREAM3D_REGISTER_TEST(TestITKSignedDanielssonDistanceMapImageMemoryBudgetTest());
 
     if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
     {
@@ -0,0 +1,189 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+#pragma once
+
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+
+#include "itkAcosImageFilter.h"
+#include "itkAsinImageFilter.h"
+#include "itkAtanImageFilter.h"
+#include "itkBoundedReciprocalImageFilter.h"
+#include "itkCosImageFilter.h"
+#include "itkExpImageFilter.h"
+#include "itkExpNegativeImageFilter.h"
+#include "itkImage.h"
+#include "itkImportImageFilter.h"
+#include "itkLog10ImageFilter.h"
+#include "itkLogImageFilter.h"
+#include "itkSinImageFilter.h"
+#include "itkSquareImageFilter.h"
+#include "itkTanImageFilter.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/ITKUnaryKernels.h"
+
+class ITKUnaryKernelsTest
+{
+
+public:
+  ITKUnaryKernelsTest() = default;
+  ~ITKUnaryKernelsTest() = default;
+  ITKUnaryKernelsTest(const ITKUnaryKernelsTest&) = delete;            // Copy Constructor
+  ITKUnaryKernelsTest(ITKUnaryKernelsTest&&) = delete;                 // Move Constructor
+  ITKUnaryKernelsTest& operator=(const ITKUnaryKernelsTest&) = delete; // Copy Assignment
+  ITKUnaryKernelsTest& operator=(ITKUnaryKernelsTest&&) = delete;      // Move Assignment
+
+  // Several blocks per thread and a last block that is not full
+  const size_t k_Width = 211;
+  const size_t k_Height = 97;
+
+  using Operation = ITKUnaryKernels::Operation;
+
+  // -----------------------------------------------------------------------------
+  // Values spread over [minimum, maximum]
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  std::vector<T> CreateValues(double minimum, double maximum)
+  {
+    const size_t count = k_Width * k_Height;
+    std::vector<T> values(count);
+    for(size_t i = 0; i < count; i++)
+    {
+      const double t = static_cast<double>((i * 7919) % count) / static_cast<double>(count - 1);
+      values[i] = static_cast<T>(minimum + t * (maximum - minimum));
+    }
+    return values;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename InputType>
+  typename itk::Image<InputType, 2>::Pointer CreateImage(std::vector<InputType>& values)
+  {
+    using ImportType = itk::ImportImageFilter<InputType, 2>;
+    typename ImportType::Pointer importer = ImportType::New();
+    typename ImportType::RegionType region;
+    region.SetSize(0, k_Width);
+    region.SetSize(1, k_Height);
+    importer->SetRegion(region);
+    importer->SetImportPointer(values.data(), values.size(), false);
+    importer->Update();
+    return importer->GetOutput();
+  }
+
+  // -----------------------------------------------------------------------------
+  // Requires the kernel of 'operation' to give the values of the ITK filter 'FilterType', value for value
+  // -----------------------------------------------------------------------------
+  template <template <typename, typename> class FilterType, typename InputType, typename OutputType>
+  void RequireSameAsITK(Operation operation, std::vector<InputType> input, double parameter = 0.0)
+  {
+    using InputImageType = itk::Image<InputType, 2>;
+    using OutputImageType = itk::Image<OutputType, 2>;
+    typename FilterType<InputImageType, OutputImageType>::Pointer filter = FilterType<InputImageType, OutputImageType>::New();
+    SetFactor(filter.GetPointer(), parameter);
+    filter->SetInput(CreateImage<InputType>(input));
+    filter->Update();
+    const OutputType* expected = filter->GetOutput()->GetBufferPointer();
+
+    std::vector<OutputType> output(input.size());
+    ITKUnaryKernels::Apply<InputType, OutputType>(operation, parameter, input.data(), output.data(), input.size());
+    size_t mismatches = 0;
+    for(size_t i = 0; i < output.size(); i++)
+    {
+      mismatches += (output[i] != expected[i]) ? 1 : 0;
+    }
+    DREAM3D_REQUIRE_EQUAL(mismatches, 0)
+
+    // In place, as when the filter overwrites the selected array
+    if(std::is_same<InputType, OutputType>::value)
+    {
+      std::vector<InputType> values = input;
+      ITKUnaryKernels::Apply<InputType, InputType>(operation, parameter, values.data(), values.data(), values.size());
+      for(size_t i = 0; i < values.size(); i++)
+      {
+        mismatches += (static_cast<OutputType>(values[i]) != expected[i]) ? 1 : 0;
+      }
+      DREAM3D_REQUIRE_EQUAL(mismatches, 0)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename InputImageType, typename OutputImageType>
+  void SetFactor(itk::ExpNegativeImageFilter<InputImageType, OutputImageType>* filter, double factor)
+  {
+    filter->SetFactor(factor);
+  }
+  void SetFactor(...)
+  {
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestFloatKernels()
+  {
+    const std::vector<float> unit = CreateValues<float>(-1.0, 1.0);
+    const std::vector<float> wide = CreateValues<float>(-20.0, 20.0);
+    const std::vector<float> positive = CreateValues<float>(1.0e-3, 1.0e4);
+
+    RequireSameAsITK<itk::AcosImageFilter, float, float>(Operation::Acos, unit);
+    RequireSameAsITK<itk::AsinImageFilter, float, float>(Operation::Asin, unit);
+    RequireSameAsITK<itk::AtanImageFilter, float, float>(Operation::Atan, wide);
+    RequireSameAsITK<itk::CosImageFilter, float, float>(Operation::Cos, wide);
+    RequireSameAsITK<itk::SinImageFilter, float, float>(Operation::Sin, wide);
+    RequireSameAsITK<itk::TanImageFilter, float, float>(Operation::Tan, wide);
+    RequireSameAsITK<itk::ExpImageFilter, float, float>(Operation::Exp, wide);
+    RequireSameAsITK<itk::ExpNegativeImageFilter, float, float>(Operation::ExpNegative, wide, 0.75);
+    RequireSameAsITK<itk::LogImageFilter, float, float>(Operation::Log, positive);
+    RequireSameAsITK<itk::Log10ImageFilter, float, float>(Operation::Log10, positive);
+    RequireSameAsITK<itk::SquareImageFilter, float, float>(Operation::Square, wide);
+    RequireSameAsITK<itk::BoundedReciprocalImageFilter, float, float>(Operation::BoundedReciprocal, positive);
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Integer arrays are converted to double and the results cast back, which truncates like the ITK functors
+  // -----------------------------------------------------------------------------
+  int TestIntegerKernels()
+  {
+    const std::vector<int16_t> shorts = CreateValues<int16_t>(-1000.0, 1000.0);
+    const std::vector<uint8_t> bytes = CreateValues<uint8_t>(0.0, 255.0);
+    const std::vector<uint8_t> positiveBytes = CreateValues<uint8_t>(1.0, 255.0);
+
+    RequireSameAsITK<itk::AtanImageFilter, int16_t, int16_t>(Operation::Atan, shorts);
+    RequireSameAsITK<itk::CosImageFilter, int16_t, double>(Operation::Cos, shorts);
+    RequireSameAsITK<itk::SinImageFilter, int16_t, float>(Operation::Sin, shorts);
+    RequireSameAsITK<itk::ExpNegativeImageFilter, uint8_t, double>(Operation::ExpNegative, bytes, 0.05);
+    RequireSameAsITK<itk::LogImageFilter, uint8_t, float>(Operation::Log, positiveBytes);
+    RequireSameAsITK<itk::Log10ImageFilter, uint8_t, uint8_t>(Operation::Log10, positiveBytes);
+    RequireSameAsITK<itk::BoundedReciprocalImageFilter, uint8_t, double>(Operation::BoundedReciprocal, bytes);
+
+    // The squares stay in the range of the type, out of range conversions are undefined
+    RequireSameAsITK<itk::SquareImageFilter, int16_t, int16_t>(Operation::Square, CreateValues<int16_t>(-181.0, 181.0));
+    RequireSameAsITK<itk::SquareImageFilter, uint8_t, uint8_t>(Operation::Square, CreateValues<uint8_t>(0.0, 15.0));
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "---------------- ITKUnaryKernelsTest ---------------------" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestFloatKernels())
+    DREAM3D_REGISTER_TEST(TestIntegerKernels())
+  }
+
+private:
+};
@@ -0,0 +1,157 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+#pragma once
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/IncrementalStitching.h"
+
+class IncrementalStitchingTest
+{
+
+public:
+  IncrementalStitchingTest() = default;
+  ~IncrementalStitchingTest() = default;
+  IncrementalStitchingTest(const IncrementalStitchingTest&) = delete;            // Copy Constructor
+  IncrementalStitchingTest(IncrementalStitchingTest&&) = delete;                 // Move Constructor
+  IncrementalStitchingTest& operator=(const IncrementalStitchingTest&) = delete; // Copy Assignment
+  IncrementalStitchingTest& operator=(IncrementalStitchingTest&&) = delete;      // Move Assignment
+
+  using RegionType = IncrementalStitching::RegionType;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  RegionType CreateRegion(itk::IndexValueType x, itk::IndexValueType y, itk::SizeValueType width, itk::SizeValueType height)
+  {
+    RegionType region;
+    region.SetIndex(0, x);
+    region.SetIndex(1, y);
+    region.SetSize(0, width);
+    region.SetSize(1, height);
+    return region;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  bool ContainsRegion(const std::vector<RegionType>& regions, const RegionType& region)
+  {
+    return std::find(regions.begin(), regions.end(), region) != regions.end();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestAddChangedRegion()
+  {
+    std::vector<RegionType> regions;
+
+    // Empty regions are ignored
+    IncrementalStitching::AddChangedRegion(regions, CreateRegion(10, 10, 0, 5));
+    DREAM3D_REQUIRE_EQUAL(regions.size(), 0);
+
+    // Disjoint regions, including regions that only touch, are kept apart
+    IncrementalStitching::AddChangedRegion(regions, CreateRegion(0, 0, 10, 10));
+    IncrementalStitching::AddChangedRegion(regions, CreateRegion(10, 0, 10, 10));
+    IncrementalStitching::AddChangedRegion(regions, CreateRegion(50, 50, 5, 5));
+    DREAM3D_REQUIRE_EQUAL(regions.size(), 3);
+
+    // A region inside another one changes nothing
+    IncrementalStitching::AddChangedRegion(regions, CreateRegion(2, 2, 3, 3));
+    DREAM3D_REQUIRE_EQUAL(regions.size(), 3);
+    DREAM3D_REQUIRE(ContainsRegion(regions, CreateRegion(0, 0, 10, 10)));
+
+    // A region overlapping two regions merges all three into their bounding box
+    IncrementalStitching::AddChangedRegion(regions, CreateRegion(5, 8, 10, 4));
+    DREAM3D_REQUIRE_EQUAL(regions.size(), 2);
+    DREAM3D_REQUIRE(ContainsRegion(regions, CreateRegion(0, 0, 20, 12)));
+    DREAM3D_REQUIRE(ContainsRegion(regions, CreateRegion(50, 50, 5, 5)));
+
+    // The bounding box of a merge overlaps a region the added one did not overlap, which is merged too
+    IncrementalStitching::AddChangedRegion(regions, CreateRegion(30, 30, 5, 25));
+    IncrementalStitching::AddChangedRegion(regions, CreateRegion(18, 32, 40, 2));
+    DREAM3D_REQUIRE_EQUAL(regions.size(), 2);
+    DREAM3D_REQUIRE(ContainsRegion(regions, CreateRegion(0, 0, 20, 12)));
+    DREAM3D_REQUIRE(ContainsRegion(regions, CreateRegion(18, 30, 40, 25)));
+
+    // No pixel belongs to two regions
+    for(size_t i = 0; i < regions.size(); i++)
+    {
+      for(size_t j = i + 1; j < regions.size(); j++)
+      {
+        RegionType overlap = regions[i];
+        DREAM3D_REQUIRE_EQUAL(overlap.Crop(regions[j]), false);
+      }
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestComputeChecksum()
+  {
+    // Several blocks and a few trailing bytes that do not fill a word
+    const size_t byteCount = 3 * IncrementalStitching::ChecksumBlockBytes + 13;
+    std::vector<uint8_t> data(byteCount);
+    for(size_t i = 0; i < byteCount; i++)
+    {
+      data[i] = static_cast<uint8_t>((i * 2654435761u) >> 13);
+    }
+    const uint64_t checksum = IncrementalStitching::ComputeChecksum(data.data(), byteCount);
+
+    // Same bytes at another address
+    std::vector<uint8_t> copy(byteCount + 3);
+    std::copy(data.begin(), data.end(), copy.begin() + 3);
+    DREAM3D_REQUIRE_EQUAL(IncrementalStitching::ComputeChecksum(copy.data() + 3, byteCount), checksum);
+
+    // A single bit flipped anywhere, in the first and last word of a block, in the high bits of a word or in the
+    // trailing bytes, changes the checksum
+    const std::vector<size_t> positions = {0, 7, IncrementalStitching::ChecksumBlockBytes - 1, IncrementalStitching::ChecksumBlockBytes, 2 * IncrementalStitching::ChecksumBlockBytes + 12345,
+                                           byteCount - 1};
+    std::set<uint64_t> checksums = {checksum};
+    for(size_t position : positions)
+    {
+      for(uint8_t bit : {uint8_t(0x01), uint8_t(0x80)})
+      {
+        data[position] ^= bit;
+        checksums.insert(IncrementalStitching::ComputeChecksum(data.data(), byteCount));
+        data[position] ^= bit;
+      }
+    }
+    DREAM3D_REQUIRE_EQUAL(checksums.size(), 1 + 2 * positions.size());
+    DREAM3D_REQUIRE_EQUAL(IncrementalStitching::ComputeChecksum(data.data(), byteCount), checksum);
+
+    // Two blocks swapped
+    std::swap_ranges(data.begin(), data.begin() + IncrementalStitching::ChecksumBlockBytes, data.begin() + IncrementalStitching::ChecksumBlockBytes);
+    DREAM3D_REQUIRE(IncrementalStitching::ComputeChecksum(data.data(), byteCount) != checksum);
+
+    // Zero buffers of different lengths
+    std::vector<uint8_t> zeros(64, 0);
+    DREAM3D_REQUIRE(IncrementalStitching::ComputeChecksum(zeros.data(), 32) != IncrementalStitching::ComputeChecksum(zeros.data(), 64));
+    DREAM3D_REQUIRE(IncrementalStitching::ComputeChecksum(zeros.data(), 0) != IncrementalStitching::ComputeChecksum(zeros.data(), 1));
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "---------------- IncrementalStitchingTest ---------------------" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestAddChangedRegion())
+    DREAM3D_REGISTER_TEST(TestComputeChecksum())
+  }
+
+private:
+};
@@ -0,0 +1,142 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+#pragma once
+
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "itkRGBPixel.h"
+#include "itkRegionOfInterestImageFilter.h"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/MontageImportHelper.h"
+
+class MontageImportHelperTest
+{
+
+public:
+  MontageImportHelperTest() = default;
+  ~MontageImportHelperTest() = default;
+  MontageImportHelperTest(const MontageImportHelperTest&) = delete;            // Copy Constructor
+  MontageImportHelperTest(MontageImportHelperTest&&) = delete;                 // Move Constructor
+  MontageImportHelperTest& operator=(const MontageImportHelperTest&) = delete; // Copy Assignment
+  MontageImportHelperTest& operator=(MontageImportHelperTest&&) = delete;      // Move Assignment
+
+  const size_t k_TileWidth = 64;
+  const size_t k_TileHeight = 48;
+  const QString k_TileData = QString("Tile Data");
+  const QString k_Image = QString("Image");
+
+  using PixelType = itk::RGBPixel<uint8_t>;
+  using ScalarImageType = itk::Image<uint8_t, 2>;
+  using RegionType = ScalarImageType::RegionType;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainer::Pointer CreateColorTile()
+  {
+    DataContainer::Pointer dc = DataContainer::New("Tile");
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    std::vector<size_t> dims = {k_TileWidth, k_TileHeight, 1};
+    image->setDimensions(dims.data());
+    dc->setGeometry(image);
+    AttributeMatrix::Pointer am = dc->createAndAddAttributeMatrix(dims, k_TileData, AttributeMatrix::Type::Cell);
+    UInt8ArrayType::Pointer data = UInt8ArrayType::CreateArray(dims, std::vector<size_t>(1, 3), k_Image, true);
+    for(size_t i = 0; i < data->getSize(); i++)
+    {
+      data->setValue(i, static_cast<uint8_t>((i * 37) % 251));
+    }
+    am->insertOrAssign(data);
+    return dc;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  ScalarImageType::Pointer ExtractRegion(ScalarImageType* image, const RegionType& region)
+  {
+    using ROIType = itk::RegionOfInterestImageFilter<ScalarImageType, ScalarImageType>;
+    ROIType::Pointer roi = ROIType::New();
+    roi->SetInput(image);
+    roi->SetRegionOfInterest(region);
+    roi->Update();
+    return roi->GetOutput();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RequireLuminance(const DataContainer::Pointer& dc, ScalarImageType* extracted, const RegionType& region)
+  {
+    UInt8ArrayType::Pointer data = dc->getAttributeMatrix(k_TileData)->getAttributeArrayAs<UInt8ArrayType>(k_Image);
+    const RegionType extractedRegion = extracted->GetLargestPossibleRegion();
+    for(itk::SizeValueType y = 0; y < region.GetSize(1); y++)
+    {
+      for(itk::SizeValueType x = 0; x < region.GetSize(0); x++)
+      {
+        const size_t tuple = (region.GetIndex(1) + y) * k_TileWidth + region.GetIndex(0) + x;
+        PixelType pixel;
+        pixel.Set(data->getComponent(tuple, 0), data->getComponent(tuple, 1), data->getComponent(tuple, 2));
+        ScalarImageType::IndexType index = extractedRegion.GetIndex();
+        index[0] += static_cast<itk::IndexValueType>(x);
+        index[1] += static_cast<itk::IndexValueType>(y);
+        DREAM3D_REQUIRE_EQUAL(extracted->GetPixel(index), static_cast<uint8_t>(pixel.GetLuminance()))
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestTileLuminanceImage()
+  {
+    DataContainer::Pointer dc = CreateColorTile();
+    std::vector<itk::ProcessObject::Pointer> sources;
+    ScalarImageType::Pointer luminance = MontageImportHelper::CreateTileLuminanceImage<PixelType, 2>(dc, k_TileData, k_Image, sources);
+    DREAM3D_REQUIRE_EQUAL(sources.size(), 1)
+
+    // The right overlap strip, as read by the registration of the tile with its right neighbour. The luminance of
+    // the strip is released once it is read.
+    RegionType rightStrip;
+    rightStrip.SetIndex(0, 48);
+    rightStrip.SetIndex(1, 0);
+    rightStrip.SetSize(0, 16);
+    rightStrip.SetSize(1, k_TileHeight);
+    ScalarImageType::Pointer extracted = ExtractRegion(luminance, rightStrip);
+    RequireLuminance(dc, extracted, rightStrip);
+    DREAM3D_REQUIRE(luminance->GetDataReleased())
+
+    // Only the requested strip is converted
+    luminance->ReleaseDataFlagOff();
+    RegionType bottomStrip;
+    bottomStrip.SetIndex(0, 0);
+    bottomStrip.SetIndex(1, 36);
+    bottomStrip.SetSize(0, k_TileWidth);
+    bottomStrip.SetSize(1, 12);
+    extracted = ExtractRegion(luminance, bottomStrip);
+    RequireLuminance(dc, extracted, bottomStrip);
+    DREAM3D_REQUIRE_EQUAL(luminance->GetDataReleased(), false)
+    DREAM3D_REQUIRE_EQUAL(luminance->GetBufferedRegion(), bottomStrip)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "---------------- MontageImportHelperTest ---------------------" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestTileLuminanceImage())
+  }
+
+private:
+};
@@ -0,0 +1,248 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+#pragma once
+
+#include <cmath>
+
+#include <QtCore/QJsonObject>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Geometry/TransformContainer.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "ITKImageProcessing/ITKImageProcessingConstants.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKImportFijiMontage.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKPCMTileRegistration.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKStitchMontage.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/MontageImportHelper.h"
+#include "ITKImageProcessingTestFileLocations.h"
+
+class MontageTilesOnDemandTest
+{
+
+public:
+  MontageTilesOnDemandTest() = default;
+  ~MontageTilesOnDemandTest() = default;
+  MontageTilesOnDemandTest(const MontageTilesOnDemandTest&) = delete;            // Copy Constructor
+  MontageTilesOnDemandTest(MontageTilesOnDemandTest&&) = delete;                 // Move Constructor
+  MontageTilesOnDemandTest& operator=(const MontageTilesOnDemandTest&) = delete; // Copy Assignment
+  MontageTilesOnDemandTest& operator=(MontageTilesOnDemandTest&&) = delete;      // Move Assignment
+
+  // The SampleMosaic is 2 columns x 3 rows of RGB tiles
+  const int32_t k_ColEnd = 1;
+  const int32_t k_RowEnd = 2;
+  const QString k_EagerPrefix = QString("Eager_");
+  const QString k_OnDemandPrefix = QString("OnDemand_");
+  const QString k_TileData = QString("Tile Data");
+  const QString k_Image = QString("Image");
+  const QString k_MosaicData = QString("Mosaic Data");
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief ImportMontage Imports the SampleMosaic with the tiles prefixed by 'prefix'. The origin and the spacing
+   * are changed, so that the tiles loaded on demand are only placed like the imported tiles when they are read at
+   * the origin and spacing of their geometry.
+   */
+  void ImportMontage(const DataContainerArray::Pointer& dca, const QString& prefix, bool loadTilesOnDemand)
+  {
+    ITKImportFijiMontage::Pointer filter = ITKImportFijiMontage::New();
+    filter->setDataContainerArray(dca);
+    filter->setInputFile(UnitTest::ImportFijiConfigTest::InputFile);
+    filter->setMontageName(prefix + "Montage");
+    filter->setDataContainerPath(DataArrayPath(prefix, "", ""));
+    filter->setCellAttributeMatrixName(k_TileData);
+    filter->setImageDataArrayName(k_Image);
+    filter->setColumnMontageLimits({0, k_ColEnd});
+    filter->setRowMontageLimits({0, k_RowEnd});
+    filter->setChangeOrigin(true);
+    filter->setOrigin({234.34f, 948.389f, 0.0f});
+    filter->setChangeSpacing(true);
+    filter->setSpacing({0.25f, 0.5f, 1.0f});
+    filter->setLoadTilesOnDemand(loadTilesOnDemand);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void StitchMontage(const DataContainerArray::Pointer& dca, const QString& prefix)
+  {
+    ITKStitchMontage::Pointer filter = ITKStitchMontage::New();
+    QJsonObject selection;
+    selection["ColStart"] = 0;
+    selection["ColEnd"] = k_ColEnd;
+    selection["RowStart"] = 0;
+    selection["RowEnd"] = k_RowEnd;
+    selection["Padding"] = 1;
+    selection["PrefixStr"] = prefix;
+    selection["SuffixStr"] = QString("");
+    QJsonObject parameters;
+    parameters["MontageSelection"] = selection;
+    filter->readFilterParameters(parameters);
+
+    filter->setDataContainerArray(dca);
+    filter->setCommonAttributeMatrixName(k_TileData);
+    filter->setCommonDataArrayName(k_Image);
+    filter->setMontageDataContainerName(prefix + "Mosaic");
+    filter->setMontageAttributeMatrixName(k_MosaicData);
+    filter->setMontageDataArrayName(k_Image);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RegisterMontage(const DataContainerArray::Pointer& dca, const QString& prefix, int registrationMode)
+  {
+    ITKPCMTileRegistration::Pointer filter = ITKPCMTileRegistration::New();
+    filter->setDataContainerArray(dca);
+    filter->setDataContainerPrefix(prefix);
+    filter->setDataContainerPaddingDigits(1);
+    filter->setColumnMontageLimits({0, k_ColEnd});
+    filter->setRowMontageLimits({0, k_RowEnd});
+    filter->setCommonAttributeMatrixName(k_TileData);
+    filter->setCommonDataArrayName(k_Image);
+    filter->setRegistrationMode(registrationMode);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  std::vector<double> GetTileTranslation(const DataContainerArray::Pointer& dca, const QString& dcName)
+  {
+    ImageGeom::Pointer geom = dca->getDataContainer(dcName)->getGeometryAs<ImageGeom>();
+    TransformContainer::Pointer transform = std::dynamic_pointer_cast<TransformContainer>(geom->getTransformContainer());
+    DREAM3D_REQUIRE_VALID_POINTER(transform.get())
+    // The translation follows the 3x3 matrix in the parameters of the affine transform
+    std::vector<double> parameters = transform->getParameters();
+    DREAM3D_REQUIRE_EQUAL(parameters.size(), 12)
+    return {parameters[9], parameters[10], parameters[11]};
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestTilesOnDemandKeepNoImageArray()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    ImportMontage(dca, k_OnDemandPrefix, true);
+
+    for(int32_t row = 0; row <= k_RowEnd; row++)
+    {
+      for(int32_t col = 0; col <= k_ColEnd; col++)
+      {
+        DataContainer::Pointer dc = dca->getDataContainer(MontageImportHelper::GenerateDataContainerName(k_OnDemandPrefix, 1, row, col));
+        DREAM3D_REQUIRE_VALID_POINTER(dc.get())
+        DREAM3D_REQUIRE_EQUAL(dc->getAttributeMatrix(k_TileData)->doesAttributeArrayExist(k_Image), false)
+        DREAM3D_REQUIRE_EQUAL(MontageImportHelper::GetTileSourceFilePath(dc).isEmpty(), false)
+
+        // Only the type and the components of the image are known before the file is read
+        IDataArray::Pointer pixel = MontageImportHelper::GetTilePixelArray(dc, k_TileData, k_Image);
+        DREAM3D_REQUIRE_VALID_POINTER(pixel.get())
+        DREAM3D_REQUIRE_EQUAL(pixel->getNumberOfTuples(), 1)
+        DREAM3D_REQUIRE_EQUAL(pixel->getNumberOfComponents(), 3)
+        DREAM3D_REQUIRE_EQUAL(pixel->getTypeAsString(), QString("uint8_t"))
+      }
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestStitchTilesOnDemand()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    ImportMontage(dca, k_EagerPrefix, false);
+    ImportMontage(dca, k_OnDemandPrefix, true);
+
+    StitchMontage(dca, k_EagerPrefix);
+    StitchMontage(dca, k_OnDemandPrefix);
+
+    UInt8ArrayType::Pointer eager = dca->getDataContainer(k_EagerPrefix + "Mosaic")->getAttributeMatrix(k_MosaicData)->getAttributeArrayAs<UInt8ArrayType>(k_Image);
+    UInt8ArrayType::Pointer onDemand = dca->getDataContainer(k_OnDemandPrefix + "Mosaic")->getAttributeMatrix(k_MosaicData)->getAttributeArrayAs<UInt8ArrayType>(k_Image);
+    DREAM3D_REQUIRE_VALID_POINTER(eager.get())
+    DREAM3D_REQUIRE_VALID_POINTER(onDemand.get())
+    DREAM3D_REQUIRE_EQUAL(eager->getNumberOfTuples(), onDemand->getNumberOfTuples())
+
+    ImageGeom::Pointer eagerGeom = dca->getDataContainer(k_EagerPrefix + "Mosaic")->getGeometryAs<ImageGeom>();
+    ImageGeom::Pointer onDemandGeom = dca->getDataContainer(k_OnDemandPrefix + "Mosaic")->getGeometryAs<ImageGeom>();
+    for(size_t d = 0; d < 3; d++)
+    {
+      DREAM3D_REQUIRE_EQUAL(eagerGeom->getDimensions()[d], onDemandGeom->getDimensions()[d])
+      DREAM3D_REQUIRE_EQUAL(eagerGeom->getOrigin()[d], onDemandGeom->getOrigin()[d])
+      DREAM3D_REQUIRE_EQUAL(eagerGeom->getSpacing()[d], onDemandGeom->getSpacing()[d])
+    }
+
+    const size_t numValues = eager->getSize();
+    size_t mismatches = 0;
+    for(size_t i = 0; i < numValues; i++)
+    {
+      mismatches += eager->getValue(i) != onDemand->getValue(i) ? 1 : 0;
+    }
+    DREAM3D_REQUIRE_EQUAL(mismatches, 0)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestRegisterTilesOnDemand()
+  {
+    // Tile Montage, then Pair Batches
+    for(int registrationMode = 0; registrationMode < 2; registrationMode++)
+    {
+      DataContainerArray::Pointer dca = DataContainerArray::New();
+      ImportMontage(dca, k_EagerPrefix, false);
+      ImportMontage(dca, k_OnDemandPrefix, true);
+
+      RegisterMontage(dca, k_EagerPrefix, registrationMode);
+      RegisterMontage(dca, k_OnDemandPrefix, registrationMode);
+
+      for(int32_t row = 0; row <= k_RowEnd; row++)
+      {
+        for(int32_t col = 0; col <= k_ColEnd; col++)
+        {
+          std::vector<double> eager = GetTileTranslation(dca, MontageImportHelper::GenerateDataContainerName(k_EagerPrefix, 1, row, col));
+          std::vector<double> onDemand = GetTileTranslation(dca, MontageImportHelper::GenerateDataContainerName(k_OnDemandPrefix, 1, row, col));
+
+          // The reader converts the colors to luminance with slightly different weights than the importer, so the
+          // offsets may differ by a fraction of a pixel
+          ImageGeom::Pointer geom = dca->getDataContainer(MontageImportHelper::GenerateDataContainerName(k_EagerPrefix, 1, row, col))->getGeometryAs<ImageGeom>();
+          FloatVec3Type spacing = geom->getSpacing();
+          for(size_t d = 0; d < 2; d++)
+          {
+            DREAM3D_REQUIRED(std::abs(eager[d] - onDemand[d]), <=, spacing[d])
+          }
+        }
+      }
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "---------------- MontageTilesOnDemandTest ---------------------" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestTilesOnDemandKeepNoImageArray())
+    DREAM3D_REGISTER_TEST(TestStitchTilesOnDemand())
+    DREAM3D_REGISTER_TEST(TestRegisterTilesOnDemand())
+  }
+
+private:
+};
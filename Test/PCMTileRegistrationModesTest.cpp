@@ -0,0 +1,310 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Geometry/TransformContainer.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKPCMTileRegistration.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/MontageImportHelper.h"
+#include "ITKImageProcessingTestFileLocations.h"
+
+class PCMTileRegistrationModesTest
+{
+
+public:
+  PCMTileRegistrationModesTest() = default;
+  ~PCMTileRegistrationModesTest() = default;
+  PCMTileRegistrationModesTest(const PCMTileRegistrationModesTest&) = delete;            // Copy Constructor
+  PCMTileRegistrationModesTest(PCMTileRegistrationModesTest&&) = delete;                 // Move Constructor
+  PCMTileRegistrationModesTest& operator=(const PCMTileRegistrationModesTest&) = delete; // Copy Assignment
+  PCMTileRegistrationModesTest& operator=(PCMTileRegistrationModesTest&&) = delete;      // Move Assignment
+
+  const int32_t k_Rows = 2;
+  const int32_t k_Cols = 3;
+  const int64_t k_TileWidth = 96;
+  const int64_t k_TileHeight = 80;
+  const int64_t k_Overlap = 30;
+  const FloatVec3Type k_Spacing = FloatVec3Type(0.5f, 0.25f, 1.0f);
+  const QString k_Prefix = QString("Tile_");
+  const QString k_TileData = QString("Tile Data");
+  const QString k_Image = QString("Image");
+
+  const int k_TileMontageRegistration = 0;
+  const int k_PairBatchRegistration = 1;
+
+  // Shift (x, y) in pixels of each tile from its position in the grid, in row-major order
+  const std::vector<std::array<int64_t, 2>> k_TileShifts = {{0, 0}, {3, -2}, {-2, 1}, {1, 3}, {-3, -1}, {2, 2}};
+
+  // -----------------------------------------------------------------------------
+  // Noise over a smooth pattern, so that the correlation has a single sharp peak
+  // -----------------------------------------------------------------------------
+  uint8_t GetSceneValue(int64_t x, int64_t y)
+  {
+    uint32_t hash = (static_cast<uint32_t>(x) * 73856093u) ^ (static_cast<uint32_t>(y) * 19349663u);
+    hash ^= hash >> 13;
+    hash *= 0x5bd1e995u;
+    hash ^= hash >> 15;
+    const double smooth = 64.0 * std::sin(static_cast<double>(x) * 0.043) * std::cos(static_cast<double>(y) * 0.037);
+    const double value = 128.0 + smooth + static_cast<double>(hash & 0x3Fu) - 32.0;
+    return static_cast<uint8_t>(std::max(0.0, std::min(255.0, value)));
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QString GetTileName(int32_t row, int32_t col)
+  {
+    return MontageImportHelper::GenerateDataContainerName(k_Prefix, 1, row, col);
+  }
+
+  // -----------------------------------------------------------------------------
+  // Tiles of one scene with the origins of a regular grid, each showing the scene shifted by its k_TileShifts
+  // -----------------------------------------------------------------------------
+  void CreateMontage(const DataContainerArray::Pointer& dca)
+  {
+    for(int32_t row = 0; row < k_Rows; row++)
+    {
+      for(int32_t col = 0; col < k_Cols; col++)
+      {
+        const int64_t xStart = col * (k_TileWidth - k_Overlap);
+        const int64_t yStart = row * (k_TileHeight - k_Overlap);
+        const std::array<int64_t, 2>& shift = k_TileShifts[static_cast<size_t>(row * k_Cols + col)];
+
+        DataContainer::Pointer dc = DataContainer::New(GetTileName(row, col));
+        ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+        std::vector<size_t> dims = {static_cast<size_t>(k_TileWidth), static_cast<size_t>(k_TileHeight), 1};
+        image->setDimensions(dims.data());
+        image->setOrigin(FloatVec3Type(xStart * k_Spacing[0], yStart * k_Spacing[1], 0.0f));
+        image->setSpacing(k_Spacing);
+        dc->setGeometry(image);
+        AttributeMatrix::Pointer am = dc->createAndAddAttributeMatrix(dims, k_TileData, AttributeMatrix::Type::Cell);
+        UInt8ArrayType::Pointer data = UInt8ArrayType::CreateArray(dims, std::vector<size_t>(1, 1), k_Image, true);
+        for(int64_t y = 0; y < k_TileHeight; y++)
+        {
+          for(int64_t x = 0; x < k_TileWidth; x++)
+          {
+            data->setValue(static_cast<size_t>(y * k_TileWidth + x), GetSceneValue(xStart + shift[0] + x, yStart + shift[1] + y));
+          }
+        }
+        am->insertOrAssign(data);
+        dca->addOrReplaceDataContainer(dc);
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  ITKPCMTileRegistration::Pointer CreateRegistrationFilter(const DataContainerArray::Pointer& dca, int registrationMode, int coarseRegistrationFactor)
+  {
+    ITKPCMTileRegistration::Pointer filter = ITKPCMTileRegistration::New();
+    filter->setDataContainerArray(dca);
+    filter->setDataContainerPrefix(k_Prefix);
+    filter->setDataContainerPaddingDigits(1);
+    filter->setColumnMontageLimits({0, k_Cols - 1});
+    filter->setRowMontageLimits({0, k_Rows - 1});
+    filter->setCommonAttributeMatrixName(k_TileData);
+    filter->setCommonDataArrayName(k_Image);
+    filter->setRegistrationMode(registrationMode);
+    filter->setCoarseRegistrationFactor(coarseRegistrationFactor);
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  ITKPCMTileRegistration::Pointer RegisterMontage(const DataContainerArray::Pointer& dca, int registrationMode, int coarseRegistrationFactor = 1)
+  {
+    ITKPCMTileRegistration::Pointer filter = CreateRegistrationFilter(dca, registrationMode, coarseRegistrationFactor);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Translation (x, y) stored for each tile, relative to the first tile, in row-major order
+  // -----------------------------------------------------------------------------
+  std::vector<std::array<double, 2>> GetTileTranslations(const DataContainerArray::Pointer& dca)
+  {
+    std::vector<std::array<double, 2>> translations;
+    for(int32_t row = 0; row < k_Rows; row++)
+    {
+      for(int32_t col = 0; col < k_Cols; col++)
+      {
+        ImageGeom::Pointer geom = dca->getDataContainer(GetTileName(row, col))->getGeometryAs<ImageGeom>();
+        TransformContainer::Pointer transform = std::dynamic_pointer_cast<TransformContainer>(geom->getTransformContainer());
+        DREAM3D_REQUIRE_VALID_POINTER(transform.get())
+        // The translation follows the 3x3 matrix in the parameters of the affine transform
+        std::vector<double> parameters = transform->getParameters();
+        DREAM3D_REQUIRE_EQUAL(parameters.size(), 12)
+        translations.push_back({parameters[9], parameters[10]});
+      }
+    }
+    const std::array<double, 2> first = translations[0];
+    for(std::array<double, 2>& translation : translations)
+    {
+      translation[0] -= first[0];
+      translation[1] -= first[1];
+    }
+    return translations;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Whether the translations of 'tiles' are the physical shifts of k_TileShifts times 'sign', within a pixel
+  // -----------------------------------------------------------------------------
+  bool MatchesTileShifts(const std::vector<std::array<double, 2>>& translations, const std::vector<size_t>& tiles, double sign)
+  {
+    for(size_t i : tiles)
+    {
+      for(size_t d = 0; d < 2; d++)
+      {
+        const double expected = sign * static_cast<double>(k_TileShifts[i][d] - k_TileShifts[0][d]) * k_Spacing[d];
+        if(std::abs(translations[i][d] - expected) > k_Spacing[d])
+        {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  // -----------------------------------------------------------------------------
+  // The transforms may either move the tiles by their shifts or map the montage back into the tiles, so the
+  // translations must be all the shifts or all their opposites
+  // -----------------------------------------------------------------------------
+  void RequireTileShifts(const std::vector<std::array<double, 2>>& translations, const std::vector<size_t>& tiles)
+  {
+    DREAM3D_REQUIRE_EQUAL(translations.size(), k_TileShifts.size())
+    const size_t matchingSigns = (MatchesTileShifts(translations, tiles, 1.0) ? 1 : 0) + (MatchesTileShifts(translations, tiles, -1.0) ? 1 : 0);
+    DREAM3D_REQUIRE_EQUAL(matchingSigns, 1)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestRegistrationModesAgree()
+  {
+    const std::vector<size_t> allTiles = {0, 1, 2, 3, 4, 5};
+    std::array<std::vector<std::array<double, 2>>, 2> translations;
+    for(int registrationMode : {k_TileMontageRegistration, k_PairBatchRegistration})
+    {
+      DataContainerArray::Pointer dca = DataContainerArray::New();
+      CreateMontage(dca);
+      ITKPCMTileRegistration::Pointer filter = RegisterMontage(dca, registrationMode);
+      DREAM3D_REQUIRED(filter->getWarningCode(), >=, 0)
+
+      // The pair offsets are fitted in pixels, then scaled back by the spacing, which differs in x and y
+      translations[registrationMode] = GetTileTranslations(dca);
+      RequireTileShifts(translations[registrationMode], allTiles);
+    }
+
+    for(size_t i : allTiles)
+    {
+      for(size_t d = 0; d < 2; d++)
+      {
+        DREAM3D_REQUIRED(std::abs(translations[0][i][d] - translations[1][i][d]), <=, k_Spacing[d])
+      }
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestFailedPairsKeepTheirTilesPlaced()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    CreateMontage(dca);
+
+    // Tile r0c1 is read from a file that does not exist, so its three pairs cannot be registered
+    const QString missingFilePath = UnitTest::TestTempDir + "/PCMTileRegistrationModesTest_Missing.tif";
+    QDir().mkpath(UnitTest::TestTempDir);
+    QFile::remove(missingFilePath);
+    DataContainer::Pointer dc = dca->getDataContainer(GetTileName(0, 1));
+    MontageImportHelper::SetTileSourceFilePath(dc, missingFilePath, dc->getAttributeMatrix(k_TileData)->getAttributeArray(k_Image));
+
+    ITKPCMTileRegistration::Pointer filter = RegisterMontage(dca, k_PairBatchRegistration);
+    DREAM3D_REQUIRE_EQUAL(filter->getWarningCode(), -11009)
+
+    // The other tiles are still placed from their registered pairs
+    const std::vector<std::array<double, 2>> translations = GetTileTranslations(dca);
+    RequireTileShifts(translations, {0, 2, 3, 4, 5});
+
+    // The failed pairs keep the offsets of the tile origins with a tiny weight, which places their tile between its
+    // neighbours r0c0, r0c2 and r1c1
+    for(size_t d = 0; d < 2; d++)
+    {
+      const double low = std::min({translations[0][d], translations[2][d], translations[4][d]});
+      const double high = std::max({translations[0][d], translations[2][d], translations[4][d]});
+      DREAM3D_REQUIRED(translations[1][d], >=, low - 1.0e-3 * k_Spacing[d])
+      DREAM3D_REQUIRED(translations[1][d], <=, high + 1.0e-3 * k_Spacing[d])
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestCoarseRegistrationFactor()
+  {
+    const std::vector<size_t> allTiles = {0, 1, 2, 3, 4, 5};
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    CreateMontage(dca);
+    RegisterMontage(dca, k_PairBatchRegistration);
+    const std::vector<std::array<double, 2>> fullResolution = GetTileTranslations(dca);
+
+    // Registered bin-shrunk by 4, then refined at full resolution on a patch of each overlap
+    ITKPCMTileRegistration::Pointer filter = RegisterMontage(dca, k_PairBatchRegistration, 4);
+    DREAM3D_REQUIRED(filter->getWarningCode(), >=, 0)
+    const std::vector<std::array<double, 2>> coarseToFine = GetTileTranslations(dca);
+    RequireTileShifts(coarseToFine, allTiles);
+    for(size_t i : allTiles)
+    {
+      for(size_t d = 0; d < 2; d++)
+      {
+        DREAM3D_REQUIRED(std::abs(coarseToFine[i][d] - fullResolution[i][d]), <=, k_Spacing[d])
+      }
+    }
+
+    // The tile montage cannot be given a coarse estimate
+    filter = CreateRegistrationFilter(dca, k_TileMontageRegistration, 4);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -11012)
+
+    filter = CreateRegistrationFilter(dca, k_PairBatchRegistration, 0);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -11011)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "---------------- PCMTileRegistrationModesTest ---------------------" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestRegistrationModesAgree())
+    DREAM3D_REGISTER_TEST(TestFailedPairsKeepTheirTilesPlaced())
+    DREAM3D_REGISTER_TEST(TestCoarseRegistrationFactor())
+  }
+
+private:
+};
@@ -0,0 +1,350 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+#pragma once
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+#include "itkImage.h"
+#include "itkImageFileReader.h"
+#include "itkRGBPixel.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKImportFijiMontage.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKStitchMontage.h"
+#include "ITKImageProcessingTestFileLocations.h"
+
+class StitchMontageFileOutputTest
+{
+
+public:
+  StitchMontageFileOutputTest() = default;
+  ~StitchMontageFileOutputTest() = default;
+  StitchMontageFileOutputTest(const StitchMontageFileOutputTest&) = delete;            // Copy Constructor
+  StitchMontageFileOutputTest(StitchMontageFileOutputTest&&) = delete;                 // Move Constructor
+  StitchMontageFileOutputTest& operator=(const StitchMontageFileOutputTest&) = delete; // Copy Assignment
+  StitchMontageFileOutputTest& operator=(StitchMontageFileOutputTest&&) = delete;      // Move Assignment
+
+  // The SampleMosaic is 2 columns x 3 rows of RGB tiles
+  const int32_t k_ColEnd = 1;
+  const int32_t k_RowEnd = 2;
+  const QString k_Prefix = QString("Mosaic_");
+  const QString k_TileData = QString("Tile Data");
+  const QString k_Image = QString("Image");
+  const QString k_MosaicData = QString("Mosaic Data");
+  const QString k_MosaicName = QString("Mosaic");
+
+  using PixelType = itk::RGBPixel<uint8_t>;
+  using ImageType = itk::Image<PixelType, 2>;
+
+  // Output modes of ITKStitchMontage
+  const int k_DataArrayOutput = 0;
+  const int k_ImageFileOutput = 1;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QString GetOutputFilePath(const QString& name)
+  {
+    return UnitTest::TestTempDir + "/StitchMontageFileOutputTest_" + name + ".mha";
+  }
+
+  // -----------------------------------------------------------------------------
+  // Level 0 is the full resolution file itself
+  // -----------------------------------------------------------------------------
+  QString GetLevelFilePath(const QString& filePath, int level)
+  {
+    if(level == 0)
+    {
+      return filePath;
+    }
+    QFileInfo fi(filePath);
+    return fi.path() + QDir::separator() + QString("%1_Level%2.%3").arg(fi.completeBaseName()).arg(level).arg(fi.suffix());
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QString GetStitchRecordFilePath(const QString& filePath)
+  {
+    return filePath + ".stitch.json";
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void ImportMontage(const DataContainerArray::Pointer& dca)
+  {
+    ITKImportFijiMontage::Pointer filter = ITKImportFijiMontage::New();
+    filter->setDataContainerArray(dca);
+    filter->setInputFile(UnitTest::ImportFijiConfigTest::InputFile);
+    filter->setMontageName(k_Prefix + "Montage");
+    filter->setDataContainerPath(DataArrayPath(k_Prefix, "", ""));
+    filter->setCellAttributeMatrixName(k_TileData);
+    filter->setImageDataArrayName(k_Image);
+    filter->setColumnMontageLimits({0, k_ColEnd});
+    filter->setRowMontageLimits({0, k_RowEnd});
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  ITKStitchMontage::Pointer CreateStitchFilter(const DataContainerArray::Pointer& dca)
+  {
+    ITKStitchMontage::Pointer filter = ITKStitchMontage::New();
+    QJsonObject selection;
+    selection["ColStart"] = 0;
+    selection["ColEnd"] = k_ColEnd;
+    selection["RowStart"] = 0;
+    selection["RowEnd"] = k_RowEnd;
+    selection["Padding"] = 1;
+    selection["PrefixStr"] = k_Prefix;
+    selection["SuffixStr"] = QString("");
+    QJsonObject parameters;
+    parameters["MontageSelection"] = selection;
+    filter->readFilterParameters(parameters);
+
+    filter->setDataContainerArray(dca);
+    filter->setCommonAttributeMatrixName(k_TileData);
+    filter->setCommonDataArrayName(k_Image);
+    filter->setMontageDataContainerName(k_MosaicName);
+    filter->setMontageAttributeMatrixName(k_MosaicData);
+    filter->setMontageDataArrayName(k_Image);
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  ImageType::Pointer ReadImageFile(const QString& filePath)
+  {
+    using ReaderType = itk::ImageFileReader<ImageType>;
+    ReaderType::Pointer reader = ReaderType::New();
+    reader->SetFileName(filePath.toStdString());
+    reader->Update();
+    return reader->GetOutput();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RequireSameImage(const ImageType::Pointer& image, const UInt8ArrayType::Pointer& expected, const SizeVec3Type& expectedDims)
+  {
+    DREAM3D_REQUIRE_VALID_POINTER(expected.get())
+    const ImageType::SizeType size = image->GetLargestPossibleRegion().GetSize();
+    DREAM3D_REQUIRE_EQUAL(size[0], expectedDims[0])
+    DREAM3D_REQUIRE_EQUAL(size[1], expectedDims[1])
+    DREAM3D_REQUIRE_EQUAL(expected->getNumberOfComponents(), 3)
+    DREAM3D_REQUIRE_EQUAL(expected->getNumberOfTuples(), size[0] * size[1])
+
+    const PixelType* pixels = image->GetBufferPointer();
+    size_t mismatches = 0;
+    for(size_t i = 0; i < expected->getNumberOfTuples(); i++)
+    {
+      for(size_t c = 0; c < 3; c++)
+      {
+        mismatches += pixels[i][c] != expected->getComponent(i, c) ? 1 : 0;
+      }
+    }
+    DREAM3D_REQUIRE_EQUAL(mismatches, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RequireSameImageFile(const QString& filePath, const QString& expectedFilePath)
+  {
+    DREAM3D_REQUIRE(QFile::exists(filePath))
+    DREAM3D_REQUIRE(QFile::exists(expectedFilePath))
+    ImageType::Pointer image = ReadImageFile(filePath);
+    ImageType::Pointer expected = ReadImageFile(expectedFilePath);
+    DREAM3D_REQUIRE(image->GetLargestPossibleRegion() == expected->GetLargestPossibleRegion())
+
+    const PixelType* pixels = image->GetBufferPointer();
+    const PixelType* expectedPixels = expected->GetBufferPointer();
+    size_t mismatches = 0;
+    for(size_t i = 0; i < image->GetLargestPossibleRegion().GetNumberOfPixels(); i++)
+    {
+      mismatches += pixels[i] != expectedPixels[i] ? 1 : 0;
+    }
+    DREAM3D_REQUIRE_EQUAL(mismatches, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int WriteMontageFile(const DataContainerArray::Pointer& dca, const QString& filePath, int pyramidLevels, bool incrementalUpdate)
+  {
+    ITKStitchMontage::Pointer filter = CreateStitchFilter(dca);
+    filter->setOutputMode(k_ImageFileOutput);
+    filter->setOutputFilePath(filePath);
+    filter->setPyramidLevels(pyramidLevels);
+    filter->setIncrementalUpdate(incrementalUpdate);
+    filter->execute();
+    return filter->getErrorCode();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QJsonObject ReadStitchRecordTiles(const QString& filePath)
+  {
+    QFile recordFile(GetStitchRecordFilePath(filePath));
+    DREAM3D_REQUIRE(recordFile.open(QIODevice::ReadOnly))
+    QJsonDocument document = QJsonDocument::fromJson(recordFile.readAll());
+    DREAM3D_REQUIRE(document.isObject())
+    return document.object()["Tiles"].toObject();
+  }
+
+  // -----------------------------------------------------------------------------
+  // Inverts the first half of the rows of one tile
+  // -----------------------------------------------------------------------------
+  void ChangeTile(const DataContainerArray::Pointer& dca, const QString& tileName)
+  {
+    DataContainer::Pointer dc = dca->getDataContainer(tileName);
+    DREAM3D_REQUIRE_VALID_POINTER(dc.get())
+    UInt8ArrayType::Pointer data = dc->getAttributeMatrix(k_TileData)->getAttributeArrayAs<UInt8ArrayType>(k_Image);
+    DREAM3D_REQUIRE_VALID_POINTER(data.get())
+    for(size_t i = 0; i < data->getSize() / 2; i++)
+    {
+      data->setValue(i, 255 - data->getValue(i));
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveOutputFiles(const QString& filePath, int pyramidLevels = 0)
+  {
+    for(int level = 0; level <= pyramidLevels; level++)
+    {
+      QFile::remove(GetLevelFilePath(filePath, level));
+    }
+    QFile::remove(GetStitchRecordFilePath(filePath));
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestImageFileOutput()
+  {
+    const QString filePath = GetOutputFilePath("Image");
+    QDir().mkpath(UnitTest::TestTempDir);
+    RemoveOutputFiles(filePath);
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    ImportMontage(dca);
+
+    ITKStitchMontage::Pointer arrayFilter = CreateStitchFilter(dca);
+    arrayFilter->setOutputMode(k_DataArrayOutput);
+    arrayFilter->execute();
+    DREAM3D_REQUIRED(arrayFilter->getErrorCode(), >=, 0)
+
+    // The file is written from the same grid of tiles, piece by piece
+    ITKStitchMontage::Pointer fileFilter = CreateStitchFilter(dca);
+    fileFilter->setOutputMode(k_ImageFileOutput);
+    fileFilter->setOutputFilePath(filePath);
+    fileFilter->execute();
+    DREAM3D_REQUIRED(fileFilter->getErrorCode(), >=, 0)
+    DREAM3D_REQUIRE(QFile::exists(filePath))
+
+    DataContainer::Pointer mosaic = dca->getDataContainer(k_MosaicName);
+    UInt8ArrayType::Pointer expected = mosaic->getAttributeMatrix(k_MosaicData)->getAttributeArrayAs<UInt8ArrayType>(k_Image);
+    RequireSameImage(ReadImageFile(filePath), expected, mosaic->getGeometryAs<ImageGeom>()->getDimensions());
+
+#if REMOVE_TEST_FILES
+    RemoveOutputFiles(filePath);
+#endif
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestIncrementalPyramidUpdate()
+  {
+    const int pyramidLevels = 2;
+    const QString changedTile = k_Prefix + "r1c1";
+    const QString filePath = GetOutputFilePath("Incremental");
+    const QString scratchFilePath = GetOutputFilePath("Scratch");
+    QDir().mkpath(UnitTest::TestTempDir);
+    RemoveOutputFiles(filePath, pyramidLevels);
+    RemoveOutputFiles(scratchFilePath, pyramidLevels);
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    ImportMontage(dca);
+
+    DREAM3D_REQUIRED(WriteMontageFile(dca, filePath, pyramidLevels, true), >=, 0)
+    const QJsonObject previousTiles = ReadStitchRecordTiles(filePath);
+
+    // Only the regions covered by the changed tile are resampled and pasted into each file, which must then hold
+    // what a write from scratch gives
+    ChangeTile(dca, changedTile);
+    DREAM3D_REQUIRED(WriteMontageFile(dca, filePath, pyramidLevels, true), >=, 0)
+    DREAM3D_REQUIRED(WriteMontageFile(dca, scratchFilePath, pyramidLevels, false), >=, 0)
+    for(int level = 0; level <= pyramidLevels; level++)
+    {
+      RequireSameImageFile(GetLevelFilePath(filePath, level), GetLevelFilePath(scratchFilePath, level));
+    }
+    DREAM3D_REQUIRE(!QFile::exists(GetStitchRecordFilePath(scratchFilePath)))
+
+    // The record now holds the checksum of the changed tile only
+    const QJsonObject tiles = ReadStitchRecordTiles(filePath);
+    DREAM3D_REQUIRE(tiles.keys() == previousTiles.keys())
+    for(const QString& name : tiles.keys())
+    {
+      const bool sameChecksum = tiles[name].toObject()["Checksum"] == previousTiles[name].toObject()["Checksum"];
+      DREAM3D_REQUIRE_EQUAL(sameChecksum, name != changedTile)
+    }
+
+    // A directory in place of the last level makes the update fail after the full resolution file was written to.
+    // The record must not be saved, so the next update writes the whole montage again.
+    const QString lastLevelFilePath = GetLevelFilePath(filePath, pyramidLevels);
+    QFile::remove(lastLevelFilePath);
+    DREAM3D_REQUIRE(QDir().mkpath(lastLevelFilePath))
+    ChangeTile(dca, changedTile);
+    DREAM3D_REQUIRED(WriteMontageFile(dca, filePath, pyramidLevels, true), <, 0)
+    DREAM3D_REQUIRE(!QFile::exists(GetStitchRecordFilePath(filePath)))
+
+    DREAM3D_REQUIRE(QDir().rmdir(lastLevelFilePath))
+    DREAM3D_REQUIRED(WriteMontageFile(dca, filePath, pyramidLevels, true), >=, 0)
+    DREAM3D_REQUIRE(QFile::exists(GetStitchRecordFilePath(filePath)))
+    DREAM3D_REQUIRED(WriteMontageFile(dca, scratchFilePath, pyramidLevels, false), >=, 0)
+    for(int level = 0; level <= pyramidLevels; level++)
+    {
+      RequireSameImageFile(GetLevelFilePath(filePath, level), GetLevelFilePath(scratchFilePath, level));
+    }
+
+#if REMOVE_TEST_FILES
+    RemoveOutputFiles(filePath, pyramidLevels);
+    RemoveOutputFiles(scratchFilePath, pyramidLevels);
+#endif
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "---------------- StitchMontageFileOutputTest ---------------------" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestImageFileOutput())
+    DREAM3D_REGISTER_TEST(TestIncrementalPyramidUpdate())
+  }
+
+private:
+};
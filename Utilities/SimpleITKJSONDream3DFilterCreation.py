@@ -13,6 +13,10 @@ Usage:
 
 ./SimpleITKJSONDream3DFilterCreation.py  -j ~/Devel/SimpleITK/Code/BasicFilters/json/ -d .. -n -o -I ~/Devel/ITK
 
+The ITKImageProcessingBase reimplementations of each filter are not part of the SimpleITK JSON descriptions. They are
+read from SimpleITKJSONDream3DExecutionTraits.json, or from the file given with '-t', and added to the description of
+the filter of the same name.
+
 If errors occur, try creating a folder containing only the JSON descriptions of the filters that are currently
 supported by this script.
 
@@ -44,7 +48,11 @@ general={
                {'name':['template_code_filename'], 'type':str, 'required':True},  # 281
                {'name':['template_test_filename'], 'type':str, 'required':True}, # 280
                {'name':['filter_type'],'type':str,'required':False},  # 102 occurences
-               {'name':['measurements'],'type':str,'required':False}  # 109
+               {'name':['measurements'],'type':str,'required':False},  # 109
+               {'name':['streamable'],'type':bool,'required':False},  # Not in the original JSON file. See ExecutionTraits
+               {'name':['additional_inputs'],'type':bool,'required':False},  # Not in the original JSON file. See ExecutionTraits
+               {'name':['relative_cost'],'type':list,'required':False},  # Not in the original JSON file. See ExecutionTraits
+               {'name':['working_memory_per_pixel'],'type':list,'required':False}  # Not in the original JSON file. See ExecutionTraits
              ],
         'ignored':
              [
@@ -298,6 +306,43 @@ ValueAndDimensionTypes={
 
 CheckEntry=['CheckIntegerEntry','CheckVectorEntry']
 
+# Pixel-wise filters computed by ITKUnaryKernels on scalar arrays: ITKUnaryKernels::Operation and its parameter
+UnaryKernelOperations={
+'AcosImageFilter':('Acos',''),
+'AsinImageFilter':('Asin',''),
+'AtanImageFilter':('Atan',''),
+'CosImageFilter':('Cos',''),
+'SinImageFilter':('Sin',''),
+'TanImageFilter':('Tan',''),
+'ExpImageFilter':('Exp',''),
+'ExpNegativeImageFilter':('ExpNegative','filter->GetFactor()'),
+'LogImageFilter':('Log',''),
+'Log10ImageFilter':('Log10',''),
+'SquareImageFilter':('Square',''),
+'BoundedReciprocalImageFilter':('BoundedReciprocal',''),
+}
+
+# ITKImageProcessingBase reimplementations, read from the file given with '--ExecutionTraits' and added to the JSON
+# description of the filter of the same name:
+# 'streamable': the filter can be computed piece by piece (isStreamable)
+# 'additional_inputs': the filter reads other arrays than the selected one (hasAdditionalInputs)
+# 'relative_cost': lines of the body of getRelativeCost(unsigned int dimension)
+# 'working_memory_per_pixel': lines of the body of getWorkingMemoryPerPixel(size_t inputPixelSize, size_t outputPixelSize, unsigned int dimension)
+ExecutionTraitsMethods=[
+('working_memory_per_pixel','double','getWorkingMemoryPerPixel',[('size_t','inputPixelSize'),('size_t','outputPixelSize'),('unsigned int','dimension')]),
+('relative_cost','double','getRelativeCost',[('unsigned int','dimension')]),
+('streamable','bool','isStreamable',[]),
+('additional_inputs','bool','hasAdditionalInputs',[]),
+]
+
+# Headers of the functions used in the execution traits bodies
+ExecutionTraitsIncludes={
+'std::max':'algorithm',
+'std::min':'algorithm',
+'std::pow':'cmath',
+'std::ceil':'cmath',
+'std::floor':'cmath',
+}
 
 #
 def ExtractDescritpion(data_json, fields, filter_description, verbose=False, not_implemented=False):
@@ -550,7 +595,13 @@ def ImplementFilter(filter_description, filter_members, filter_measurements):
     # Code specific for each template
     if filter_description['template_code_filename'] == "KernelImageFilter":
         filt+='  filter->SetKernel(structuringElement);\n'
-    filt+='  this->ITKImageProcessingBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter);\n'
+    if filter_description['name'] in UnaryKernelOperations:
+        operation, parameter = UnaryKernelOperations[filter_description['name']]
+        if parameter != '':
+            parameter = ', '+parameter
+        filt+='  this->ITKImageProcessingBase::filterUnary<InputPixelType, OutputPixelType, Dimension, FilterType>(filter, ITKUnaryKernels::Operation::'+operation+parameter+');\n'
+    else:
+        filt+='  this->ITKImageProcessingBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter);\n'
     # Post processing (e.g. Print measurements)
     for filter_measurement in filter_measurements:
         filt+='{\n'
@@ -561,6 +612,52 @@ def ImplementFilter(filter_description, filter_members, filter_measurements):
         filt+='}\n'
     return filt
 
+def GetExecutionTraitsBody(filter_description, trait):
+    if filter_description[trait] == True:
+        return ['return true;']
+    return filter_description[trait]
+
+def GetExecutionTraitsDeclarations(filter_description):
+    declarations = ''
+    for trait, return_type, method, arguments in ExecutionTraitsMethods:
+        if not filter_description.get(trait):
+            continue
+        declarations += '\n  /**\n   * @brief '+method+' Reimplemented from @see ITKImageProcessingBase class\n   */\n'
+        declarations += '  '+return_type+' '+method+'('+', '.join([x[0]+' '+x[1] for x in arguments])+') const override;\n'
+    return declarations
+
+def GetExecutionTraitsImplementations(filter_description, filter_name):
+    implementations = ''
+    for trait, return_type, method, arguments in ExecutionTraitsMethods:
+        if not filter_description.get(trait):
+            continue
+        body = GetExecutionTraitsBody(filter_description, trait)
+        # Arguments the body does not use are commented out
+        signature = []
+        for argument_type, argument_name in arguments:
+            if len([x for x in body if re.search(r'\b'+argument_name+r'\b', x.split('//')[0])]):
+                signature.append(argument_type+' '+argument_name)
+            else:
+                signature.append(argument_type+' /*'+argument_name+'*/')
+        implementations += '\n// -----------------------------------------------------------------------------\n//\n'
+        implementations += '// -----------------------------------------------------------------------------\n'
+        implementations += return_type+' '+filter_name+'::'+method+'('+', '.join(signature)+') const\n{\n'
+        for line in body:
+            implementations += ('  '+line).rstrip()+'\n'
+        implementations += '}\n'
+    return implementations
+
+def GetExecutionTraitsIncludes(filter_description):
+    include_list = []
+    for trait, _, _, _ in ExecutionTraitsMethods:
+        if not filter_description.get(trait):
+            continue
+        for line in GetExecutionTraitsBody(filter_description, trait):
+            include_list += [include for function, include in ExecutionTraitsIncludes.items() if function+'(' in line]
+    if not include_list:
+        return ''
+    return '\n'+FormatIncludes(include_list)+'\n'
+
 def TypenameOutputPixelType(output_pixel_type):
     if 'InputImageType::' in output_pixel_type:
         return '1'
@@ -632,6 +729,9 @@ def InitializeParsingValues(DREAM3DFilter, filter_description):
     DREAM3DFilter['UUID'] = ''
     DREAM3DFilter['FilterInternal'] = ''
     DREAM3DFilter['TestsIncludeName'] = ''
+    DREAM3DFilter['ExecutionTraitsDeclarations'] = GetExecutionTraitsDeclarations(filter_description)
+    DREAM3DFilter['ExecutionTraitsImplementations'] = GetExecutionTraitsImplementations(filter_description, DREAM3DFilter['FilterName'])
+    DREAM3DFilter['ExecutionTraitsIncludes'] = GetExecutionTraitsIncludes(filter_description)
     if 'briefdescription' in filter_description:
         DREAM3DFilter['FilterDescription'] += filter_description['briefdescription']+'\n\n'
     if 'detaileddescription' in filter_description:
@@ -814,8 +914,13 @@ def main(argv=None):
     parser.add_argument('-o', '--Overwrite', dest='overwrite', action='store_true', help="Overwrite files previously generated automatically")
     parser.add_argument('-b', '--DisableVerifications', dest='disable_verifications', action='store_true', help="Disable Verifications")
     parser.add_argument('-I', '--ITK_SRC_DIR', dest='itk_dir', required=True, help="ITK source directory")
+    parser.add_argument('-t', '--ExecutionTraits', dest='execution_traits', help="JSON file of the ITKImageProcessingBase reimplementations of each filter")
     parser.set_defaults(verbose=False)
     options = parser.parse_args(argv[1:])
+    if options.execution_traits is None:
+        options.execution_traits = os.path.join(options.root_directory, 'Utilities/SimpleITKJSONDream3DExecutionTraits.json')
+    with open(options.execution_traits) as file_json:
+        execution_traits = json.load(file_json)
     documentation_directory = os.path.join(options.root_directory, 'Documentation/ITKImageProcessingFilters')
     template_directory = os.path.join(options.root_directory, 'Utilities/SimpleITKJSONDream3DFilterCreationTemplates')
     filters_output_directory = GetOutputDirectory(options.root_directory)
@@ -826,6 +931,7 @@ def main(argv=None):
         print("Template directory: %s"%template_directory)
         print("NotImplemented: %r"%options.not_implemented)
         print("ITK source directory: %s"%options.itk_dir)
+        print("Execution traits: %s"%options.execution_traits)
         print("Overwrite: %r"%options.overwrite)
         print("Verbose: %r"%options.verbose)
         print("Extra Verbose: %r"%options.extra_verbose)
@@ -838,6 +944,8 @@ def main(argv=None):
             print("Current JSON file: %s"%current_json)
             with open(current_json) as file_json:
                 data_json = json.load(file_json)
+            if 'name' in data_json and data_json['name'] in execution_traits:
+                data_json.update(execution_traits[data_json['name']])
             filter_description={}
             if not ExtractDescritpion(data_json, general, filter_description, options.extra_verbose, options.not_implemented):
                 continue
@@ -5,7 +5,7 @@
  */
 
 #include "ITKImageProcessing/ITKImageProcessingFilters/${FilterName}.h"
-#include "SIMPLib/Common/Constants.h"
+${ExecutionTraitsIncludes}#include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
@@ -62,6 +62,8 @@ void $
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::CreatedArray));
   parameters.push_back(SIMPL_NEW_STRING_FP("Filtered Array", NewCellArrayName, FilterParameter::Category::CreatedArray, ${FilterName}));
 
+  setupExecutionFilterParameters(parameters);
+
   setFilterParameters(parameters);
 }
 
@@ -78,6 +80,7 @@ void $
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
   ${ReadFilterParameters} reader->closeFilterGroup();
 }
 
@@ -147,7 +150,7 @@ void $
     FilterInternal
   }
 }
-
+${ExecutionTraitsImplementations}
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -109,7 +109,7 @@ protected:
    */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension>
   void filter();
-
+${ExecutionTraitsDeclarations}
 private:
   ${FilterName}(const ${FilterName}&) = delete;  // Copy Constructor Not Implemented
   void operator=(const ${FilterName}&) = delete; // Move assignment Not Implemented
@@ -5,7 +5,7 @@
  */
 
 #include "ITKImageProcessing/ITKImageProcessingFilters/${FilterName}.h"
-#include "SIMPLib/Common/Constants.h"
+${ExecutionTraitsIncludes}#include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
@@ -83,6 +83,8 @@ void $
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::CreatedArray));
   parameters.push_back(SIMPL_NEW_STRING_FP("Filtered Array", NewCellArrayName, FilterParameter::Category::CreatedArray, ${FilterName}));
 
+  setupExecutionFilterParameters(parameters);
+
   setFilterParameters(parameters);
 }
 
@@ -99,6 +101,7 @@ void $
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  readExecutionFilterParameters(reader);
   ${ReadFilterParameters} reader->closeFilterGroup();
 }
 
@@ -191,7 +194,7 @@ void $
     FilterInternal
   }
 }
-
+${ExecutionTraitsImplementations}
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------